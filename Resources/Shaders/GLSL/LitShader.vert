@@ -38,25 +38,28 @@ layout(binding = 0) uniform CameraBuffer
 	mat4 invViewProj;
 } camera;
 
-layout(binding = 1) uniform ObjectBuffer
+/// Indexed by gl_InstanceIndex: firstInstance of the draw commands written by InstanceCulling.comp.
+layout(std430, binding = 1) readonly buffer ObjectBuffer
 {
-	/// Object transformation matrix.
-	mat4 transform;
-} object;
+	/// Object transformation matrices.
+	mat4 transforms[];
+} objects;
 
 
 void main()
 {
+	const mat4 transform = objects.transforms[gl_InstanceIndex];
+
 	//---------- Position ----------
-	const vec4 worldPosition4 = object.transform * vec4(inPosition, 1.0);
+	const vec4 worldPosition4 = transform * vec4(inPosition, 1.0);
 	vsOut.worldPosition = worldPosition4.xyz / worldPosition4.w;
 	gl_Position = camera.invViewProj * worldPosition4;
 	vsOut.viewPosition = vec3(camera.view[3][0], camera.view[3][1], camera.view[3][2]);
 
 
 	//---------- Normal ----------
-	const vec3 normal = normalize(mat3(object.transform) * inNormal);
-	const vec3 tangent = normalize(mat3(object.transform) * inTangent);
+	const vec3 normal = normalize(mat3(transform) * inNormal);
+	const vec3 tangent = normalize(mat3(transform) * inTangent);
 	const vec3 bitangent = cross(normal, tangent);
 
 	vsOut.TBN = mat3(tangent, bitangent, normal);
@@ -0,0 +1,45 @@
+//-------------------- Compute Shader --------------------
+
+#define DEPTH_PYRAMID_GROUP_SIZE 8
+
+//---------- Bindings ----------
+cbuffer DepthPyramidConstants : register(b0)
+{
+	uint2 sourceSize;
+	uint2 destinationSize;
+};
+
+/// Scene depth for mip 0, previous mip otherwise.
+Texture2D<float> sourceDepth : register(t0);
+
+RWTexture2D<float> destinationDepth : register(u0);
+
+
+//---------- Main ----------
+/**
+*	One reduction of the depth pyramid (see depthPyramidTexture in mainDX12.cpp).
+*	Each destination texel keeps the farthest depth of the source texels it covers: an object is occluded
+*	only if it is behind every depth of its screen rectangle.
+*/
+[numthreads(DEPTH_PYRAMID_GROUP_SIZE, DEPTH_PYRAMID_GROUP_SIZE, 1)]
+void mainDepthPyramidCS(uint2 dtid : SV_DispatchThreadID)
+{
+	if (any(dtid >= destinationSize))
+		return;
+
+	// Covered source texels: 2x2 between two mips, up to 3x3 from the scene depth (non power of 2 ratio).
+	const uint2 first = (dtid * sourceSize) / destinationSize;
+	const uint2 last = min(((dtid + 1) * sourceSize + destinationSize - 1) / destinationSize, sourceSize) - 1;
+
+	float depth = 0.0;
+
+	for (uint y = first.y; y <= last.y; ++y)
+	{
+		for (uint x = first.x; x <= last.x; ++x)
+		{
+			depth = max(depth, sourceDepth.Load(int3(x, y, 0)));
+		}
+	}
+
+	destinationDepth[dtid] = depth;
+}
@@ -0,0 +1,136 @@
+//-------------------- Frustum Culling --------------------
+
+/**
+*	Frustum data and sphere tests, shared by the amplification path (MeshLitShader.hlsl) and the indirect draw path (LitShader.hlsl).
+*	Layouts must match MeshletCooker::FrustumData (FrustumCulling.hpp).
+*/
+
+#pragma once
+
+// CULLING_FLAG_* selecting the tests of VisibleFrustum().
+#include "MeshletCooker/CullingFlags.h"
+
+enum
+{
+	FRUSTUM_PLANE_LEFT = 0,
+	FRUSTUM_PLANE_RIGHT = 1,
+	FRUSTUM_PLANE_TOP = 2,
+	FRUSTUM_PLANE_BOTTOM = 3,
+	FRUSTUM_PLANE_NEAR = 4,
+	FRUSTUM_PLANE_FAR = 5,
+};
+struct FrustumPlane
+{
+	float3 normal;
+	float pad0;
+	float3 position;
+	float pad1;
+};
+struct FrustumCone
+{
+	float3 tipPosition;
+	float  height;
+	float3 direction;
+	float  angle;
+};
+struct FrustumData
+{
+	FrustumPlane planes[6];
+	float4       boundingSphere; // position = boundingSphere.xyz, radius = boundingSphere.w
+	FrustumCone  cone;
+};
+
+float SignedPointPlaneDistance(float3 position, float3 planeNormal, float3 planeCenter)
+{
+	return dot(normalize(planeNormal), position - planeCenter);
+};
+
+float SignedPointPlaneDistance(float3 position, FrustumPlane plane)
+{
+	return SignedPointPlaneDistance(position, plane.normal, plane.position);
+};
+
+bool VisibleFrustumCone(float3 position, float radius, in FrustumCone frustumCone)
+{
+	// Cone and sphere are within intersectable range
+	const float3 v0 = position - frustumCone.tipPosition;
+	const float  d0 = dot(v0, frustumCone.direction);
+	const bool   i0 = d0 <= (frustumCone.height + radius);
+
+	const float cs = cos(frustumCone.angle * 0.5);
+	const float sn = sin(frustumCone.angle * 0.5);
+	const float a = dot(v0, frustumCone.direction);
+	const float b = a * sn / cs;
+	const float c = sqrt(dot(v0, v0) - (a * a));
+	const float d = c - b;
+	const float e = d * cs;
+	const bool i1 = e < radius;
+
+	return i0 && i1;
+}
+
+bool VisibleFrustumSphere(float3 position, float radius, float4 frustumSphere)
+{
+	bool inside = (distance(position, frustumSphere.xyz) < (radius + frustumSphere.w));
+	return inside;
+}
+
+bool VisibleFrustumPlane(float3 position, float radius, FrustumPlane plane, bool visibleOnIntersection)
+{
+	const float signedPlaneDistance = SignedPointPlaneDistance(position, plane);
+
+	const bool positiveHalfSpace = signedPlaneDistance >= 0.0; // On positive half space of plane
+
+	if (!visibleOnIntersection)
+		return positiveHalfSpace;
+
+	const bool intersectPlane = abs(signedPlaneDistance) < radius;
+
+	return positiveHalfSpace || intersectPlane;
+}
+
+bool VisibleFrustumPlanes(float3 position, float radius, FrustumPlane frustumPlanes[6], bool visibleOnIntersection)
+{
+	// Determine if we're on the positive half space of frustum planes
+	const bool leftPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_LEFT], visibleOnIntersection);
+	const bool rightPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_RIGHT], visibleOnIntersection);
+	const bool topPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_TOP], visibleOnIntersection);
+	const bool bottomPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_BOTTOM], visibleOnIntersection);
+	const bool nearPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_NEAR], visibleOnIntersection);
+	const bool farPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_FAR], visibleOnIntersection);
+	
+	const bool insideFrustumPlanes = leftPlaneVisible && rightPlaneVisible && topPlaneVisible && bottomPlaneVisible && nearPlaneVisible && farPlaneVisible;
+	return insideFrustumPlanes;
+}
+
+/// Visible if the sphere passes every CULLING_FLAG_FRUSTUM_* test enabled in flags.
+bool VisibleFrustum(float3 position, float radius, FrustumData frustum, uint flags)
+{
+	bool visible = true;
+
+	if (flags & CULLING_FLAG_FRUSTUM_SPHERE)
+	{
+		const bool sphereVisibility = VisibleFrustumSphere(position, radius, frustum.boundingSphere);
+		visible &= sphereVisibility;
+	}
+
+	if (flags & CULLING_FLAG_FRUSTUM_CONE)
+	{
+		const bool coneVisibility = VisibleFrustumCone(position, radius, frustum.cone);
+		visible &= coneVisibility;
+	}
+
+	if (flags & CULLING_FLAG_FRUSTUM_SINGLE_PLANE)
+	{
+		const bool planeVisbility = VisibleFrustumPlane(position, radius, frustum.planes[CULLING_FLAGS_PLANE(flags)], true);
+		visible &= planeVisbility;
+	}
+
+	if (flags & CULLING_FLAG_FRUSTUM_ALL_PLANES)
+	{
+		const bool allPlanesVisibility = VisibleFrustumPlanes(position, radius, frustum.planes, false);
+		visible &= allPlanesVisibility;
+	}
+
+	return visible;
+}
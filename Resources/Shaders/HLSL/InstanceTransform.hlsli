@@ -0,0 +1,77 @@
+//-------------------- Instance Transform --------------------
+
+/**
+*	Instance records of the objects buffer, shared by the amplification path (MeshLitShader.hlsl) and the vertex shader path (LitShader.hlsl).
+*	USE_COMPACT_INSTANCES: position, rotation and uniform scale in 32 bytes (Renderer::CompactInstanceTransform, InstanceTransform.hpp).
+*/
+
+#pragma once
+
+struct Object
+{
+	/// Object transformation matrix.
+	float4x4 transform;
+};
+
+struct CompactObject
+{
+	float3 position;
+
+	/// Uniform scale.
+	float scale;
+
+	/// Unit quaternion: xyz = vector part, w = scalar part.
+	float4 rotation;
+};
+
+/// Translation * rotation * scale, same matrix as Renderer::ToMatrix().
+float4x4 DecodeObjectTransform(CompactObject object)
+{
+	const float4 q = object.rotation;
+	const float3 q2 = q.xyz * 2.0;
+	const float s = object.scale;
+
+	const float xx = q.x * q2.x;
+	const float yy = q.y * q2.y;
+	const float zz = q.z * q2.z;
+	const float xy = q.x * q2.y;
+	const float xz = q.x * q2.z;
+	const float yz = q.y * q2.z;
+	const float wx = q.w * q2.x;
+	const float wy = q.w * q2.y;
+	const float wz = q.w * q2.z;
+
+	return float4x4(
+		s * (1.0 - (yy + zz)),	s * (xy - wz),			s * (xz + wy),			object.position.x,
+		s * (xy + wz),			s * (1.0 - (xx + zz)),	s * (yz - wx),			object.position.y,
+		s * (xz - wy),			s * (yz + wx),			s * (1.0 - (xx + yy)),	object.position.z,
+		0.0,					0.0,					0.0,					1.0
+	);
+}
+
+#ifdef USE_COMPACT_INSTANCES
+/// Instance transforms (sphereObjectsBuffer, root SRV): 32 bytes per instance.
+StructuredBuffer<CompactObject> objects : register(t13);
+
+Object LoadObject(uint index)
+{
+	Object object;
+	object.transform = DecodeObjectTransform(objects[index]);
+
+	return object;
+}
+#else // USE_COMPACT_INSTANCES
+/// Instance transforms (sphereObjectsBuffer, root SRV): 64 bytes per instance.
+StructuredBuffer<Object> objects : register(t13);
+
+Object LoadObject(uint index)
+{
+	return objects[index];
+}
+#endif // USE_COMPACT_INSTANCES
+
+/// Uniform scale only: bounding sphere radii and LOD errors are multiplied by it.
+float GetObjectScale(float4x4 transform)
+{
+	return length(transform._11_21_31);
+}
@@ -1,3 +1,21 @@
+// Vertex Shader path (USE_MESHSHADER undefined): the USE_* toggles and their derivation are shared with mainDX12.cpp.
+// USE_INDIRECT_DRAW: instances are culled by mainIndirectCullingCS and drawn by ExecuteIndirect.
+#include "RendererFeatures.h"
+
+#ifdef USE_INDIRECT_DRAW
+// FrustumData, VisibleFrustum() and the CULLING_FLAG_* tests.
+#include "FrustumCulling.hlsli"
+
+/**
+*	Indirect draw buffer (see indirectDrawBuffer in mainDX12.cpp):
+*	D3D12_DRAW_INDEXED_ARGUMENTS (InstanceCount is the visible instance count), padding, then the visible instance indices.
+*/
+#define INDIRECT_DRAW_INSTANCE_COUNT_OFFSET 4
+#define INDIRECT_DRAW_LIST_OFFSET 32
+
+#define INDIRECT_CULLING_GROUP_SIZE 64
+#endif // USE_INDIRECT_DRAW
+
 //-------------------- Vertex Shader --------------------
 
 struct VertexFactory
@@ -43,37 +61,59 @@ struct Camera
 	*	projection * inverseView.
 	*/
 	float4x4 invViewProj;
+
+#ifdef USE_INDIRECT_DRAW
+	FrustumData frustum;
+#endif // USE_INDIRECT_DRAW
 };
 cbuffer CameraBuffer : register(b0)
 {
 	Camera camera;
 };
 
-struct Object
-{
-	/// Object transformation matrix.
-	float4x4 transform;
-};
-cbuffer ObjectBuffer : register(b1)
+// Instance transforms (sphereObjectsBuffer, root SRV): instanceCount entries sized at runtime, a single one without USE_INDIRECT_DRAW.
+#include "InstanceTransform.hlsli"
+
+#ifdef USE_INDIRECT_DRAW
+ByteAddressBuffer visibleInstances : register(t5); // indirectDrawBuffer (root SRV)
+RWByteAddressBuffer visibleInstancesRW : register(u0); // indirectDrawBuffer (root UAV)
+
+cbuffer IndirectCullingConstants : register(b2) // Root constants
 {
-	Object object;
+	float4 meshBoundingSphere; // position = meshBoundingSphere.xyz, radius = meshBoundingSphere.w
+
+	uint instanceCount;
+
+	/// CULLING_FLAG_* (CullingFlags.h): CULLING_FLAG_INSTANCE and the CULLING_FLAG_FRUSTUM_* tests.
+	uint cullingFlags;
+
+	/// Sphere index count, written in IndexCountPerInstance.
+	uint indexCount;
 };
+#endif // USE_INDIRECT_DRAW
 
 
-VertexOutput mainVS(VertexFactory _input)
+VertexOutput mainVS(VertexFactory _input, uint _instanceId : SV_InstanceID)
 {
 	VertexOutput output;
 
+#ifdef USE_INDIRECT_DRAW
+	// Only the visible instances are drawn: SV_InstanceID indexes the visible instance list.
+	const float4x4 transform = LoadObject(visibleInstances.Load(INDIRECT_DRAW_LIST_OFFSET + 4 * _instanceId)).transform;
+#else
+	const float4x4 transform = LoadObject(0).transform;
+#endif
+
 	//---------- Position ----------
-	const float4 worldPosition4 = mul(object.transform, float4(_input.position, 1.0));
+	const float4 worldPosition4 = mul(transform, float4(_input.position, 1.0));
 	output.worldPosition = worldPosition4.xyz / worldPosition4.w;
 	output.svPosition = mul(camera.invViewProj, worldPosition4);
 	output.viewPosition = float3(camera.view._14, camera.view._24, camera.view._34);
 
 
 	//---------- Normal ----------
-	const float3 normal = normalize(mul((float3x3)object.transform, _input.normal));
-	const float3 tangent = normalize(mul((float3x3)object.transform, _input.tangent));
+	const float3 normal = normalize(mul((float3x3)transform, _input.normal));
+	const float3 tangent = normalize(mul((float3x3)transform, _input.tangent));
 	const float3 bitangent = cross(normal, tangent);
 
 	/// HLSL uses row-major constructor: transpose to get TBN matrix.
@@ -86,6 +126,41 @@ VertexOutput mainVS(VertexFactory _input)
 	return output;
 }
 
+//-------------------- Compute Shader --------------------
+
+/**
+*	Instance culling of the vertex shader path: one thread per instance tests the world bounding sphere of the mesh.
+*	The visible instances are compacted in visibleInstances and their count is written in InstanceCount:
+*	the mesh is drawn indirectly (ExecuteIndirect) from the same buffer.
+*	IndexCountPerInstance is written by the first thread, InstanceCount must be reset to 0 before the dispatch.
+*	No wave intrinsics (cs_5_0): one atomic per visible instance.
+*/
+[numthreads(INDIRECT_CULLING_GROUP_SIZE, 1, 1)]
+void mainIndirectCullingCS(uint dtid : SV_DispatchThreadID)
+{
+#ifdef USE_INDIRECT_DRAW
+	if (dtid == 0)
+		visibleInstancesRW.Store(0, indexCount);
+
+	if (dtid >= instanceCount)
+		return;
+
+	const float4x4 transform = LoadObject(dtid).transform;
+
+	const float scale = GetObjectScale(transform);
+	const float3 center = mul(transform, float4(meshBoundingSphere.xyz, 1.0)).xyz;
+
+	const bool visible = !(cullingFlags & CULLING_FLAG_INSTANCE) || VisibleFrustum(center, meshBoundingSphere.w * scale, camera.frustum, cullingFlags);
+
+	if (!visible)
+		return;
+
+	uint slot = 0;
+	visibleInstancesRW.InterlockedAdd(INDIRECT_DRAW_INSTANCE_COUNT_OFFSET, 1, slot);
+	visibleInstancesRW.Store(INDIRECT_DRAW_LIST_OFFSET + 4 * slot, dtid);
+#endif // USE_INDIRECT_DRAW
+}
+
 //-------------------- Pixel Shader --------------------
 
 struct PixelInput : VertexOutput
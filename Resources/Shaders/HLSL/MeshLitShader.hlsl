@@ -1,74 +1,81 @@
 //#define USE_MESHLET_ID_AS_VERTEX_COLOR
 #define USE_MESH_SHADER_GROUP_ID_AS_VERTEX_COLOR
-#define USE_AMPLIFICATIONSHADER
-#define USE_INSTANCING
 #define DISPLAY_VERTEX_COLOR_ONLY
-#define USE_FRUSTUM_SINGLE_PLANE_CULLING FRUSTUM_PLANE_NEAR
-#define USE_FRUSTUM_CONE_CULLING
-//#define USE_FRUSTUM_ALL_PLANES_CULLING
-//#define USE_FRUSTUM_SPHERE_CULLING
-#define USE_CULLING
-#define MAX_INSTANCE_COUNT 10 * 40
+#define MAX_MESH_LOD_COUNT 8 // MeshletCooker::maxMeshLodCount
+
+// Mesh Shader path: the USE_* toggles and their derivation are shared with mainDX12.cpp.
+#define USE_MESHSHADER
+#include "RendererFeatures.h"
+
+// Culling tests selected at runtime (SceneBuffer::cullingFlags).
+#include "MeshletCooker/CullingFlags.h"
+
+// Meshlet limits shared with the cooker and the renderer.
+#include "MeshletCooker/MeshletLimits.h"
 
 //-------------------- Amplification Shader --------------------
 
+// One permutation per group size is compiled with -D AS_GROUP_SIZE=N (see CMakeLists.txt).
+#ifndef AS_GROUP_SIZE
 #define AS_GROUP_SIZE 32
+#endif
+#define INSTANCE_CULLING_GROUP_SIZE 64
+
+/// mainAS dispatches larger than the D3D12 limit of 65535 groups per dimension are split in rows of AS_DISPATCH_GROUP_COUNT_X groups.
+#define AS_DISPATCH_GROUP_COUNT_X 65535
+
+/**
+*	mainAS threads are dispatched by meshlet chunks: MESHLET_CHUNK_SIZE consecutive meshlets of one instance.
+*	Each instance dispatches the chunks of its own mesh only (see InstanceMesh), the last one is padded.
+*	Must match meshletChunkSize in mainDX12.cpp.
+*/
+#define MESHLET_CHUNK_SIZE 32
+
+#ifdef USE_INSTANCE_CULLING
+/**
+*	Visible instance buffer (see visibleInstanceBuffer in mainDX12.cpp):
+*	D3D12_DISPATCH_MESH_ARGUMENTS (ThreadGroupCountX, Y, Z), visible chunk count,
+*	then 1 uint2 per meshlet chunk of the visible instances: (instance index, chunk index in the instance).
+*/
+#define VISIBLE_CHUNK_COUNT_OFFSET 12
+#define VISIBLE_CHUNK_LIST_OFFSET 16
+#endif // USE_INSTANCE_CULLING
+
+#ifdef USE_OCCLUSION_CULLING
+/**
+*	Early phase: draws what was visible last frame (persistent visibility bits).
+*	Late phase: tests everything against the depth pyramid of the early phase, updates the bits and draws what the early phase missed.
+*/
+#define CULLING_PHASE_EARLY 0
+#define CULLING_PHASE_LATE 1
+
+/// Late phase: set on the visible instance indices drawn by the early phase.
+#define VISIBLE_INSTANCE_EARLY_BIT 0x80000000
+#endif // USE_OCCLUSION_CULLING
 
 struct Payload
 {
-#ifdef USE_INSTANCING
-	uint instanceIndices[AS_GROUP_SIZE];
-#endif
+	/// Visible (instance, meshlet) pairs: PackPayloadEntry().
+	uint entries[AS_GROUP_SIZE];
 
-	uint meshletIndices[AS_GROUP_SIZE];
+#ifdef USE_MULTI_VIEW
+	/// Bit v set if the meshlet is visible in views[v].
+	uint viewMasks[AS_GROUP_SIZE];
+#endif
 };
 
 groupshared Payload sPayload;
 
+/// Visible count of the group, when it spans several waves.
+groupshared uint sVisibleCount;
+
 //---------- Bindings ----------
-struct Object
-{
-	/// Object transformation matrix.
-	float4x4 transform;
-};
-cbuffer ObjectBuffer : register(b1)
-{
-#if defined(USE_AMPLIFICATIONSHADER) && defined(USE_INSTANCING)
-	Object objects[MAX_INSTANCE_COUNT];
-#else
-	Object object;
-#endif
-};
+// Instance transforms (sphereObjectsBuffer, root SRV): instanceCount entries sized at runtime, a single one without USE_INSTANCING.
+#include "InstanceTransform.hlsli"
+
+// FrustumData and the frustum tests, shared with mainIndirectCullingCS (LitShader.hlsl).
+#include "FrustumCulling.hlsli"
 
-enum
-{
-	FRUSTUM_PLANE_LEFT = 0,
-	FRUSTUM_PLANE_RIGHT = 1,
-	FRUSTUM_PLANE_TOP = 2,
-	FRUSTUM_PLANE_BOTTOM = 3,
-	FRUSTUM_PLANE_NEAR = 4,
-	FRUSTUM_PLANE_FAR = 5,
-};
-struct FrustumPlane
-{
-	float3 normal;
-	float pad0;
-	float3 position;
-	float pad1;
-};
-struct FrustumCone
-{
-	float3 tipPosition;
-	float  height;
-	float3 direction;
-	float  angle;
-};
-struct FrustumData
-{
-	FrustumPlane planes[6];
-	float4       boundingSphere; // position = boundingSphere.xyz, radius = boundingSphere.w
-	FrustumCone  cone;
-};
 struct Camera
 {
 	/// Camera transformation matrix.
@@ -84,162 +91,766 @@ struct Camera
 	FrustumData frustum;
 #endif
 };
+/// Mesh bounds of the quantized positions (see MeshletCooker::VertexQuantization).
+struct VertexQuantization
+{
+	float3 positionMin;
+	float pad0;
+	float3 positionExtent;
+	float pad1;
+};
+#if defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
+struct ScreenSettings
+{
+	/// Viewport size in pixels (of one view with USE_MULTI_VIEW): projected meshlet bounds to pixels.
+	float2 viewportSize;
+
+	/// CULLING_FLAG_SMALL_MESHLET: min projected size in pixels.
+	float smallMeshletThreshold;
+
+	float pad0;
+};
+#endif // USE_AMPLIFICATIONSHADER && USE_CULLING
+#if defined(USE_CLUSTER_LOD) || defined(USE_DISCRETE_LOD)
+struct LodSettings
+{
+	/// Object space error to pixels at distance 1: viewport height / (2 * tan(fovY / 2)).
+	float errorScale;
+
+	/// Max projected error in pixels.
+	float errorThreshold;
+
+	float pad0;
+	float pad1;
+};
+#endif // USE_CLUSTER_LOD || USE_DISCRETE_LOD
+#ifdef USE_DISCRETE_LOD
+/// Discrete LOD of the mesh (see MeshletCooker::MeshLod).
+struct MeshLod
+{
+	uint  meshletOffset;
+	uint  meshletCount;
+	uint  triangleCount;
+	float error;
+};
+#endif // USE_DISCRETE_LOD
 cbuffer SceneBuffer : register(b0)
 {
 	Camera camera;
-	uint meshletCount;
+
+#ifdef USE_MULTI_VIEW
+	/// Rendered views (SV_ViewID): culled per view by mainAS. LOD selection stays on camera.
+	Camera views[MULTI_VIEW_COUNT];
+#endif // USE_MULTI_VIEW
+
+#if defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
+	ScreenSettings screen;
+#endif // USE_AMPLIFICATIONSHADER && USE_CULLING
+#if defined(USE_CLUSTER_LOD) || defined(USE_DISCRETE_LOD)
+	LodSettings lod;
+#endif // USE_CLUSTER_LOD || USE_DISCRETE_LOD
+	/// Meshlet chunks of the direct mainAS dispatch: every chunk of every instance (USE_INSTANCING) or of mesh 0.
+	uint meshletChunkCount;
 
 #ifdef USE_INSTANCING
 	uint32_t instanceCount;
 
-	float pad0[2];
+	/// CULLING_FLAG_* (see MeshletCooker/CullingFlags.h).
+	uint cullingFlags;
+
+	/// mainAS group size of the selected permutation (AS_GROUP_SIZE is only known by mainAS and mainMS).
+	uint asGroupSize;
+
+	/// Payload entries: meshlet index in the low bits, instance index in the others (see PackPayloadEntry).
+	uint payloadMeshletIndexBits;
 #else // USE_INSTANCING
-	float pad0[3];
+	/// CULLING_FLAG_* (see MeshletCooker/CullingFlags.h).
+	uint cullingFlags;
+
+	/// Payload entries: meshlet index in the low bits (see PackPayloadEntry).
+	uint payloadMeshletIndexBits;
 #endif // USE_INSTANCING
 };
 
+/**
+*	Amplification payload entry: instance index in the high bits, meshlet index (every LOD included) in the low payloadMeshletIndexBits bits.
+*	The split is set by the renderer from the meshlet count, the remaining bits index the instances.
+*/
+uint PackPayloadEntry(uint instanceIndex, uint meshletIndex)
+{
+	return (instanceIndex << payloadMeshletIndexBits) | meshletIndex;
+}
+
+uint GetPayloadInstanceIndex(uint entry)
+{
+	return entry >> payloadMeshletIndexBits;
+}
+
+uint GetPayloadMeshletIndex(uint entry)
+{
+	return entry & ((1u << payloadMeshletIndexBits) - 1u);
+}
+
+//---------- Geometry Pool ----------
+/**
+*	Mesh of the geometry pool (see Renderer::MeshRecord): every mesh shares the meshlet, vertex and bounds buffers.
+*	Instances reference a mesh by ID, so a single dispatch renders different meshes.
+*/
+struct MeshRecord
+{
+	/// Every meshlet of the mesh: LOD 0, then the cluster LOD levels and the discrete LODs.
+	uint meshletOffset;
+	uint meshletCount;
+
+	/// USE_DISCRETE_LOD: range in meshLods, LOD 0 first.
+	uint lodOffset;
+	uint lodCount;
+
+	/// Bounding sphere of the mesh: position = boundingSphere.xyz, radius = boundingSphere.w
+	float4 boundingSphere;
+
+	/// USE_QUANTIZED_VERTICES: bounds of the quantized positions of the mesh file.
+	VertexQuantization quantization;
+};
+StructuredBuffer<MeshRecord> meshes : register(t14); // meshRecordBuffer (root SRV)
+
+/// Mesh of an instance (see InstanceMesh in mainDX12.cpp).
+struct InstanceMesh
+{
+	uint meshId;
+
+	/// First meshlet chunk of the instance: sum of GetMeshChunkCount() over the previous instances.
+	uint chunkOffset;
+};
+StructuredBuffer<InstanceMesh> instanceMeshes : register(t15); // instanceMeshBuffer (root SRV)
+
+#ifdef USE_DISCRETE_LOD
+/// Same slot as meshletLods (USE_CLUSTER_LOD is exclusive).
+StructuredBuffer<MeshLod> meshLods : register(t10); // meshLodBuffer
+#endif // USE_DISCRETE_LOD
+
+MeshRecord LoadInstanceMesh(uint instanceIndex)
+{
+	return meshes[instanceMeshes[instanceIndex].meshId];
+}
+
+/// Meshlets dispatched for the mesh: LOD 0 with USE_DISCRETE_LOD (the selected LOD is never larger).
+uint GetMeshDispatchMeshletCount(MeshRecord mesh)
+{
+#ifdef USE_DISCRETE_LOD
+	return meshLods[mesh.lodOffset].meshletCount;
+#else // USE_DISCRETE_LOD
+	return mesh.meshletCount;
+#endif // USE_DISCRETE_LOD
+}
+
+uint GetMeshChunkCount(MeshRecord mesh)
+{
+	return (GetMeshDispatchMeshletCount(mesh) + MESHLET_CHUNK_SIZE - 1) / MESHLET_CHUNK_SIZE;
+}
+
+#if defined(USE_INSTANCING) && !defined(USE_INSTANCE_CULLING)
+/// Instance of a meshlet chunk of the direct dispatch: binary search of the last instance with chunkOffset <= chunk.
+uint FindChunkInstance(uint chunk)
+{
+	uint first = 0;
+	uint count = instanceCount;
+
+	while (count > 1)
+	{
+		const uint half = count / 2;
+
+		if (instanceMeshes[first + half].chunkOffset <= chunk)
+		{
+			first += half;
+			count -= half;
+		}
+		else
+		{
+			count = half;
+		}
+	}
+
+	return first;
+}
+#endif // USE_INSTANCING && !USE_INSTANCE_CULLING
+
 #ifdef USE_CULLING
-StructuredBuffer<float4>	meshletBounds : register(t9); // boundsBuffer
+struct MeshletBounds
+{
+	float3 center;
+	float  radius;
+
+	/// Normal cone (see MeshletCooker::MeshletBounds).
+	float3 coneApex;
+	float  coneCutoff;
+	float3 coneAxis;
+	float  pad0;
+};
+StructuredBuffer<MeshletBounds>	meshletBounds : register(t9); // boundsBuffer
 #endif
 
-float SignedPointPlaneDistance(float3 position, float3 planeNormal, float3 planeCenter)
+#ifdef USE_CLUSTER_LOD
+/// Cluster LOD hierarchy node (see MeshletCooker::MeshletLod).
+struct MeshletLod
 {
-	return dot(normalize(planeNormal), position - planeCenter);
+	float4 selfSphere;   // center = selfSphere.xyz, radius = selfSphere.w
+	float4 parentSphere; // center = parentSphere.xyz, radius = parentSphere.w
+	float  selfError;
+	float  parentError;
+	uint   level;
+	uint   pad0;
 };
+StructuredBuffer<MeshletLod> meshletLods : register(t10); // meshletLodBuffer
+#endif // USE_CLUSTER_LOD
 
-float SignedPointPlaneDistance(float3 position, FrustumPlane plane)
+#ifdef USE_INSTANCE_CULLING
+ByteAddressBuffer visibleInstances : register(t11); // visibleInstanceBuffer (root SRV)
+RWByteAddressBuffer visibleInstancesRW : register(u0); // visibleInstanceBuffer (root UAV)
+#endif // USE_INSTANCE_CULLING
+
+#ifdef USE_OCCLUSION_CULLING
+cbuffer CullingPhaseBuffer : register(b2) // Root constant
 {
-	return SignedPointPlaneDistance(position, plane.normal, plane.position);
+	uint cullingPhase;
 };
 
-bool VisibleFrustumCone(float3 position, float radius, in FrustumCone frustumCone)
+/// Farthest depth per texel (see depthPyramidTexture in mainDX12.cpp).
+Texture2D<float> depthPyramid : register(t12);
+
+/// 1 bit per instance, then 1 word per meshlet chunk (1 bit per dispatched meshlet): visibility of the last late phase.
+RWByteAddressBuffer visibilityBits : register(u1); // visibilityBitsBuffer
+
+#define MESHLET_VISIBILITY_BIT_OFFSET (((instanceCount + 31) / 32) * 32)
+
+bool GetVisibilityBit(uint bit)
+{
+	return (visibilityBits.Load(4 * (bit >> 5)) >> (bit & 31)) & 1;
+}
+
+/**
+*	Writes the visibility bit of every lane with bWrite: the bits of a word are combined across the wave, and one lane writes it.
+*	A word wholly written by the wave (32 aligned lanes: an instance word of mainInstanceCullingCS, a meshlet chunk of mainAS)
+*	is stored directly. Otherwise other waves write the rest of the word (waves of less than 32 lanes): atomics are required.
+*	Must be called from wave-uniform control flow.
+*/
+void StoreVisibilityBits(uint bit, bool visible, bool bWrite)
 {
-	// Cone and sphere are within intersectable range
-	const float3 v0 = position - frustumCone.tipPosition;
-	const float  d0 = dot(v0, frustumCone.direction);
-	const bool   i0 = d0 <= (frustumCone.height + radius);
+	bool bPending = bWrite;
+
+	while (WaveActiveAnyTrue(bPending))
+	{
+		const uint word = WaveActiveMin(bPending ? (bit >> 5) : 0xFFFFFFFF);
+		const bool bInWord = bPending && (bit >> 5) == word;
+
+		const uint laneMask = bInWord ? 1u << (bit & 31) : 0;
+		const uint wordMask = WaveActiveBitOr(laneMask);
+		const uint visibleMask = WaveActiveBitOr(visible ? laneMask : 0);
+
+		if (WaveIsFirstLane())
+		{
+			if (wordMask == 0xFFFFFFFF)
+			{
+				visibilityBits.Store(4 * word, visibleMask);
+			}
+			else
+			{
+				visibilityBits.InterlockedAnd(4 * word, ~(wordMask & ~visibleMask));
+				visibilityBits.InterlockedOr(4 * word, visibleMask);
+			}
+		}
 
-	const float cs = cos(frustumCone.angle * 0.5);
-	const float sn = sin(frustumCone.angle * 0.5);
-	const float a = dot(v0, frustumCone.direction);
-	const float b = a * sn / cs;
-	const float c = sqrt(dot(v0, v0) - (a * a));
-	const float d = c - b;
-	const float e = d * cs;
-	const bool i1 = e < radius;
+		bPending = bPending && !bInWord;
+	}
+}
+#endif // USE_OCCLUSION_CULLING
+
+#ifdef USE_CULLING_STATS
+/// Counters of the frame, cleared before the first pass (see CullingStats in mainDX12.cpp).
+RWByteAddressBuffer cullingStats : register(u2); // cullingStatsBuffer (root UAV)
+
+#define CULLING_STATS_INSTANCES_TESTED 0
+#define CULLING_STATS_INSTANCES_VISIBLE 4
+#define CULLING_STATS_MESHLETS_TESTED 8
+#define CULLING_STATS_MESHLETS_VISIBLE 12
+#define CULLING_STATS_TRIANGLES_EMITTED 16
+#define CULLING_STATS_SMALL_MESHLETS_CULLED 20
+#define CULLING_STATS_TRIANGLES_CULLED 24
+
+/// One atomic per wave.
+void CountCullingStat(uint offset, bool counted)
+{
+	const uint waveCount = WaveActiveCountBits(counted);
 
-	return i0 && i1;
+	if (WaveIsFirstLane() && waveCount > 0)
+		cullingStats.InterlockedAdd(offset, waveCount);
 }
+#endif // USE_CULLING_STATS
 
-bool VisibleFrustumSphere(float3 position, float radius, float4 frustumSphere)
+bool VisibleMeshletCone(float3 coneApex, float3 coneAxis, float coneCutoff, float3 cameraPosition)
 {
-	bool inside = (distance(position, frustumSphere.xyz) < (radius + frustumSphere.w));
-	return inside;
+	// Every triangle of the meshlet faces away from the camera.
+	const bool backfacing = dot(normalize(coneApex - cameraPosition), coneAxis) >= coneCutoff;
+	return !backfacing;
 }
 
-bool VisibleFrustumPlane(float3 position, float radius, FrustumPlane plane, bool visibleOnIntersection)
+#if defined(USE_CLUSTER_LOD) || defined(USE_DISCRETE_LOD)
+float ProjectedLodError(float4 sphere, float error, float4x4 transform, float3 cameraPosition)
 {
-	const float signedPlaneDistance = SignedPointPlaneDistance(position, plane);
+	// Uniform scale only: the error and the radius scale with the transform.
+	const float scale = GetObjectScale(transform);
+	const float3 center = mul(transform, float4(sphere.xyz, 1.0)).xyz;
 
-	const bool positiveHalfSpace = signedPlaneDistance >= 0.0; // On positive half space of plane
+	// Closest point of the sphere: conservative, the camera inside the sphere gets the finest level.
+	const float sphereDistance = max(distance(center, cameraPosition) - sphere.w * scale, 1e-5);
 
-	if (!visibleOnIntersection)
-		return positiveHalfSpace;
+	return error * scale * lod.errorScale / sphereDistance;
+}
+#endif // USE_CLUSTER_LOD || USE_DISCRETE_LOD
 
-	const bool intersectPlane = abs(signedPlaneDistance) < radius;
+#ifdef USE_CLUSTER_LOD
+bool SelectedMeshletLod(MeshletLod meshletLod, float4x4 transform, float3 cameraPosition)
+{
+	// Coarsest cut under the threshold: the meshlet is precise enough but its parent group is not.
+	const bool selfPrecise = ProjectedLodError(meshletLod.selfSphere, meshletLod.selfError, transform, cameraPosition) <= lod.errorThreshold;
+	const bool parentPrecise = ProjectedLodError(meshletLod.parentSphere, meshletLod.parentError, transform, cameraPosition) <= lod.errorThreshold;
 
-	return positiveHalfSpace || intersectPlane;
+	return selfPrecise && !parentPrecise;
 }
+#endif // USE_CLUSTER_LOD
 
-bool VisibleFrustumPlanes(float3 position, float radius, FrustumPlane frustumPlanes[6], bool visibleOnIntersection)
+#ifdef USE_DISCRETE_LOD
+/// Coarsest LOD of the mesh whose projected error is under the threshold.
+MeshLod SelectMeshLod(MeshRecord mesh, float4x4 transform, float3 cameraPosition)
 {
-	// Determine if we're on the positive half space of frustum planes
-	const bool leftPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_LEFT], visibleOnIntersection);
-	const bool rightPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_RIGHT], visibleOnIntersection);
-	const bool topPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_TOP], visibleOnIntersection);
-	const bool bottomPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_BOTTOM], visibleOnIntersection);
-	const bool nearPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_NEAR], visibleOnIntersection);
-	const bool farPlaneVisible = VisibleFrustumPlane(position, radius, frustumPlanes[FRUSTUM_PLANE_FAR], visibleOnIntersection);
-	
-	const bool insideFrustumPlanes = leftPlaneVisible && rightPlaneVisible && topPlaneVisible && bottomPlaneVisible && nearPlaneVisible && farPlaneVisible;
-	return insideFrustumPlanes;
+	uint selected = 0;
+
+	for (uint i = 1; i < mesh.lodCount; ++i)
+	{
+		if (ProjectedLodError(mesh.boundingSphere, meshLods[mesh.lodOffset + i].error, transform, cameraPosition) <= lod.errorThreshold)
+			selected = i;
+	}
+
+	return meshLods[mesh.lodOffset + selected];
 }
+#endif // USE_DISCRETE_LOD
 
 #if defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
+#ifdef USE_MULTI_VIEW
+/// Bit v set if the sphere is visible in views[v].
+uint ComputeFrustumViewMask(float3 position, float radius)
+{
+	uint viewMask = 0;
+
+	[unroll]
+	for (uint v = 0; v < MULTI_VIEW_COUNT; ++v)
+	{
+		if (VisibleFrustum(position, radius, views[v].frustum, cullingFlags))
+			viewMask |= 1u << v;
+	}
+
+	return viewMask;
+}
+#endif // USE_MULTI_VIEW
+
 bool ComputeFrustumVisibility(float3 position, float radius)
 {
-	bool visible = true;
-#ifdef USE_FRUSTUM_SPHERE_CULLING
+#ifdef USE_MULTI_VIEW
+	// Visible in any view.
+	return ComputeFrustumViewMask(position, radius) != 0;
+#else
+	// cullingFlags is uniform: no divergence.
+	return VisibleFrustum(position, radius, camera.frustum, cullingFlags);
+#endif
+}
+
+/**
+*	Screen rectangle (uv, not clamped) and nearest depth of the bounding box of the sphere, projected by viewProj.
+*	False if the box crosses the camera plane: the projection is not bounded.
+*/
+bool ProjectSphere(float3 position, float radius, float4x4 viewProj, out float2 uvMin, out float2 uvMax, out float nearestDepth)
+{
+	uvMin = float2(1e30, 1e30);
+	uvMax = float2(-1e30, -1e30);
+	nearestDepth = 1.0;
 
-	const bool sphereVisibility = VisibleFrustumSphere(position, radius, camera.frustum.boundingSphere);
-	visible &= sphereVisibility;
-#endif // USE_FRUSTUM_SPHERE_CULLING
-#ifdef USE_FRUSTUM_CONE_CULLING
-	const bool coneVisibility = VisibleFrustumCone(position, radius, camera.frustum.cone);
-	visible &= coneVisibility;
-#endif // USE_FRUSTUM_CONE_CULLING
+	for (uint i = 0; i < 8; ++i)
+	{
+		const float3 corner = position + radius * float3((i & 1) ? 1.0 : -1.0, (i & 2) ? 1.0 : -1.0, (i & 4) ? 1.0 : -1.0);
+		const float4 clipPosition = mul(viewProj, float4(corner, 1.0));
 
-#ifdef USE_FRUSTUM_SINGLE_PLANE_CULLING
-	const bool planeVisbility = VisibleFrustumPlane(position, radius, camera.frustum.planes[USE_FRUSTUM_SINGLE_PLANE_CULLING], true);
-	visible &= planeVisbility;
-#endif // USE_FRUSTUM_SINGLE_PLANE_CULLING
+		if (clipPosition.w <= 1e-5)
+			return false;
 
-#ifdef USE_FRUSTUM_ALL_PLANES_CULLING
-	const bool allPlanesVisibility = VisibleFrustumPlanes(position, radius, camera.frustum.planes, false);
-	visible &= allPlanesVisibility;
-#endif // USE_FRUSTUM_ALL_PLANES_CULLING
-	return visible;
+		const float3 ndcPosition = clipPosition.xyz / clipPosition.w;
+		const float2 uv = ndcPosition.xy * float2(0.5, -0.5) + 0.5;
+
+		uvMin = min(uvMin, uv);
+		uvMax = max(uvMax, uv);
+		nearestDepth = min(nearestDepth, ndcPosition.z);
+	}
+
+	return true;
+}
+
+/**
+*	Conservative: false only if the projected rectangle is smaller than screen.smallMeshletThreshold pixels,
+*	or lies between the pixel centers (no sample can be covered).
+*/
+bool VisibleScreenSize(float3 position, float radius, float4x4 viewProj)
+{
+	float2 uvMin, uvMax;
+	float nearestDepth;
+
+	if (!ProjectSphere(position, radius, viewProj, uvMin, uvMax, nearestDepth))
+		return true;
+
+	const float2 pixelMin = uvMin * screen.viewportSize;
+	const float2 pixelMax = uvMax * screen.viewportSize;
+
+	if (max(pixelMax.x - pixelMin.x, pixelMax.y - pixelMin.y) < screen.smallMeshletThreshold)
+		return false;
+
+	// Samples at pixel centers: k + 0.5 in [pixelMin, pixelMax] on both axes.
+	return all(floor(pixelMax - 0.5) >= ceil(pixelMin - 0.5));
 }
 #endif // USE_AMPLIFICATIONSHADER && USE_CULLING
 
-[numthreads(AS_GROUP_SIZE, 1, 1)]
-void mainAS(uint gtid : SV_GroupThreadID, uint dtid : SV_DispatchThreadID, uint gid : SV_GroupID)
+#ifdef USE_OCCLUSION_CULLING
+/// Conservative: false only if the whole sphere is behind the depth pyramid.
+bool VisibleDepthPyramid(float3 position, float radius)
 {
-	const uint meshletIndex = dtid % meshletCount;
+	if (!(cullingFlags & CULLING_FLAG_OCCLUSION))
+		return true;
 
-	const bool meshletValid = meshletIndex < meshletCount;
+	float2 uvMin, uvMax;
+	float nearestDepth;
 
-#ifdef USE_INSTANCING
-	const uint instanceIndex = dtid / meshletCount;
-	
-	const bool instanceValid = instanceIndex < instanceCount;
+	if (!ProjectSphere(position, radius, camera.invViewProj, uvMin, uvMax, nearestDepth))
+		return true;
 
-	const bool valid = meshletValid && instanceValid;
-#else // USE_INSTANCING
-	const bool valid = meshletValid;
-#endif // USE_INSTANCING
+	uvMin = saturate(uvMin);
+	uvMax = saturate(uvMax);
 
-#if defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
+	uint width, height, mipCount;
+	depthPyramid.GetDimensions(0, width, height, mipCount);
+
+	// Mip where the rectangle is at most 1 texel wide: it covers at most 2x2 texels.
+	const float2 rectangleSize = (uvMax - uvMin) * float2(width, height);
+	const uint mip = min(uint(ceil(log2(max(max(rectangleSize.x, rectangleSize.y), 1.0)))), mipCount - 1);
+
+	const uint2 mipSize = uint2(max(width >> mip, 1u), max(height >> mip, 1u));
+	const uint2 texelMin = min(uint2(uvMin * mipSize), mipSize - 1);
+	const uint2 texelMax = min(uint2(uvMax * mipSize), mipSize - 1);
+
+	const float farthestDepth = max(
+		max(depthPyramid.Load(int3(texelMin.x, texelMin.y, mip)), depthPyramid.Load(int3(texelMax.x, texelMin.y, mip))),
+		max(depthPyramid.Load(int3(texelMin.x, texelMax.y, mip)), depthPyramid.Load(int3(texelMax.x, texelMax.y, mip))));
+
+	return nearestDepth <= farthestDepth;
+}
+#endif // USE_OCCLUSION_CULLING
+
+/**
+*	First culling level: one thread per instance tests the world bounding sphere of the mesh.
+*	The meshlet chunks of the visible instances are compacted in visibleInstances and ThreadGroupCountX, Y are set to cover them only:
+*	mainAS is dispatched indirectly (ExecuteIndirect) from the same buffer.
+*	ThreadGroupCountX and the count must be reset to 0, ThreadGroupCountY to 1, before the dispatch.
+*/
+[numthreads(INSTANCE_CULLING_GROUP_SIZE, 1, 1)]
+void mainInstanceCullingCS(uint dtid : SV_DispatchThreadID)
+{
+#ifdef USE_INSTANCE_CULLING
 	bool visible = false;
-	if (valid)
+	bool bDrawnEarly = false;
+	uint chunkCount = 0;
+	if (dtid < instanceCount)
+	{
+		const float4x4 transform = LoadObject(dtid).transform;
+		const float scale = GetObjectScale(transform);
+		const MeshRecord mesh = LoadInstanceMesh(dtid);
+		const float4 meshBoundingSphere = mesh.boundingSphere;
+		chunkCount = GetMeshChunkCount(mesh);
+		const float3 center = mul(transform, float4(meshBoundingSphere.xyz, 1.0)).xyz;
+
+		visible = !(cullingFlags & CULLING_FLAG_INSTANCE) || ComputeFrustumVisibility(center, meshBoundingSphere.w * scale);
+
+#ifdef USE_OCCLUSION_CULLING
+		bDrawnEarly = GetVisibilityBit(dtid);
+
+		if (cullingPhase == CULLING_PHASE_EARLY)
+		{
+			visible = visible && bDrawnEarly;
+		}
+		else
+		{
+			visible = visible && VisibleDepthPyramid(center, meshBoundingSphere.w * scale);
+		}
+#endif // USE_OCCLUSION_CULLING
+	}
+
+#ifdef USE_OCCLUSION_CULLING
+	// The threads past the last instance clear the padding bits: every instance word is wholly written by its wave.
+	if (cullingPhase == CULLING_PHASE_LATE)
+		StoreVisibilityBits(dtid, visible, dtid < MESHLET_VISIBILITY_BIT_OFFSET);
+#endif // USE_OCCLUSION_CULLING
+
+#ifdef USE_CULLING_STATS
+	CountCullingStat(CULLING_STATS_INSTANCES_TESTED, dtid < instanceCount);
+	CountCullingStat(CULLING_STATS_INSTANCES_VISIBLE, visible);
+#endif // USE_CULLING_STATS
+
+	// Chunks of the visible instances: one atomic per wave.
+	const uint visibleChunkCount = visible ? chunkCount : 0;
+	const uint waveChunkCount = WaveActiveSum(visibleChunkCount);
+	const uint chunkSlot = WavePrefixSum(visibleChunkCount);
+
+	uint waveOffset = 0;
+	if (WaveIsFirstLane() && waveChunkCount > 0)
+	{
+		visibleInstancesRW.InterlockedAdd(VISIBLE_CHUNK_COUNT_OFFSET, waveChunkCount, waveOffset);
+
+		// Amplification groups covering every visible chunk: the max over the waves is the final count.
+		const uint groupCount = ((waveOffset + waveChunkCount) * MESHLET_CHUNK_SIZE + asGroupSize - 1) / asGroupSize;
+		visibleInstancesRW.InterlockedMax(0, min(groupCount, AS_DISPATCH_GROUP_COUNT_X));
+		visibleInstancesRW.InterlockedMax(4, (groupCount + AS_DISPATCH_GROUP_COUNT_X - 1) / AS_DISPATCH_GROUP_COUNT_X);
+	}
+	waveOffset = WaveReadLaneFirst(waveOffset);
+
+	if (visible)
 	{
+#ifdef USE_OCCLUSION_CULLING
+		// The late phase skips the meshlets already drawn by the early phase.
+		const uint earlyBit = (cullingPhase == CULLING_PHASE_LATE && bDrawnEarly) ? VISIBLE_INSTANCE_EARLY_BIT : 0;
+		const uint visibleInstance = dtid | earlyBit;
+#else // USE_OCCLUSION_CULLING
+		const uint visibleInstance = dtid;
+#endif // USE_OCCLUSION_CULLING
+
+		const uint firstSlot = waveOffset + chunkSlot;
+		for (uint chunk = 0; chunk < chunkCount; ++chunk)
+			visibleInstancesRW.Store2(VISIBLE_CHUNK_LIST_OFFSET + 8 * (firstSlot + chunk), uint2(visibleInstance, chunk));
+	}
+#endif // USE_INSTANCE_CULLING
+}
+
+[numthreads(AS_GROUP_SIZE, 1, 1)]
+void mainAS(uint gtid : SV_GroupThreadID, uint2 gid : SV_GroupID)
+{
+	// (meshlet chunk, meshlet) pair index: the groups are dispatched in rows of AS_DISPATCH_GROUP_COUNT_X.
+	const uint dtid = (gid.y * AS_DISPATCH_GROUP_COUNT_X + gid.x) * AS_GROUP_SIZE + gtid;
+	const uint chunk = dtid / MESHLET_CHUNK_SIZE;
+
+	// Root SRVs have no bounds checking: the threads past the last chunk load instance 0.
+#ifdef USE_INSTANCE_CULLING
+	// Only the chunks of the visible instances are dispatched: chunk indexes the visible chunk list.
+	const bool chunkValid = chunk < visibleInstances.Load(VISIBLE_CHUNK_COUNT_OFFSET);
+	const uint2 visibleChunk = chunkValid ? visibleInstances.Load2(VISIBLE_CHUNK_LIST_OFFSET + 8 * chunk) : uint2(0, 0);
+
+#ifdef USE_OCCLUSION_CULLING
+	const uint instanceIndex = visibleChunk.x & ~VISIBLE_INSTANCE_EARLY_BIT;
+	const bool bInstanceDrawnEarly = (visibleChunk.x & VISIBLE_INSTANCE_EARLY_BIT) != 0;
+#else // USE_OCCLUSION_CULLING
+	const uint instanceIndex = visibleChunk.x;
+#endif // USE_OCCLUSION_CULLING
+
+	const uint instanceChunk = visibleChunk.y;
+#elif defined(USE_INSTANCING)
+	// Every chunk of every instance: the instance is found from the chunk offsets.
+	const bool chunkValid = chunk < meshletChunkCount;
+	const uint instanceIndex = chunkValid ? FindChunkInstance(chunk) : 0;
+
+	const uint instanceChunk = chunk - instanceMeshes[instanceIndex].chunkOffset;
+#else // USE_INSTANCING
+	const bool chunkValid = chunk < meshletChunkCount;
+	const uint instanceChunk = chunk;
+#endif // USE_INSTANCING
+
+	// meshletIndex is first relative to the mesh of the instance (to its selected LOD with USE_DISCRETE_LOD).
+	const uint dispatchMeshletIndex = instanceChunk * MESHLET_CHUNK_SIZE + dtid % MESHLET_CHUNK_SIZE;
+	uint meshletIndex = dispatchMeshletIndex;
+
+	// Loaded (and decoded with USE_COMPACT_INSTANCES) once per thread: shared by the LOD selection and the culling tests.
 #if defined(USE_INSTANCING)
-		Object currentObject = objects[instanceIndex];
+	const uint loadedInstanceIndex = instanceIndex;
 #else // USE_INSTANCING
-		Object currentObject = object;
+	const uint loadedInstanceIndex = 0;
 #endif // USE_INSTANCING
-		const float4x4 transform = currentObject.transform;
-		const float3 meshletBoundingSpherePosition = mul(transform, float4(meshletBounds[meshletIndex].xyz, 1.0)).xyz;
-		const float meshletBoundingSphereRadius = meshletBounds[meshletIndex].w;
+	const float4x4 instanceTransform = LoadObject(loadedInstanceIndex).transform;
+	const float instanceScale = GetObjectScale(instanceTransform);
+	const MeshRecord mesh = LoadInstanceMesh(loadedInstanceIndex);
+
+	// Padding of the last chunk of the instance (and coarser LODs): the remaining threads stay idle.
+#ifdef USE_DISCRETE_LOD
+	bool valid = chunkValid;
+	if (valid)
+	{
+		const float3 lodCameraPosition = float3(camera.view._14, camera.view._24, camera.view._34);
+
+		const MeshLod meshLod = SelectMeshLod(mesh, instanceTransform, lodCameraPosition);
+
+		valid = meshletIndex < meshLod.meshletCount;
+		meshletIndex += meshLod.meshletOffset;
+	}
+#else // USE_DISCRETE_LOD
+	bool valid = chunkValid && meshletIndex < mesh.meshletCount;
+	meshletIndex += mesh.meshletOffset;
+#endif // USE_DISCRETE_LOD
 
+#if defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
+	bool visible = false;
+#ifdef USE_MULTI_VIEW
+	uint viewMask = 0;
+#endif
+	if (valid)
+	{
+		const float4x4 transform = instanceTransform;
+		const MeshletBounds bounds = meshletBounds[meshletIndex];
+		const float3 meshletBoundingSpherePosition = mul(transform, float4(bounds.center, 1.0)).xyz;
+		const float meshletBoundingSphereRadius = bounds.radius * instanceScale;
+
+#ifdef USE_MULTI_VIEW
+		// Bounds loaded once, tested against every view.
+		viewMask = ComputeFrustumViewMask(meshletBoundingSpherePosition, meshletBoundingSphereRadius);
+#else
 		visible = ComputeFrustumVisibility(meshletBoundingSpherePosition, meshletBoundingSphereRadius);
+#endif
+
+		if (cullingFlags & CULLING_FLAG_MESHLET_CONE)
+		{
+			const float3 meshletConeApex = mul(transform, float4(bounds.coneApex, 1.0)).xyz;
+			const float3 meshletConeAxis = normalize(mul((float3x3)transform, bounds.coneAxis));
+#ifdef USE_MULTI_VIEW
+			[unroll]
+			for (uint v = 0; v < MULTI_VIEW_COUNT; ++v)
+			{
+				const float3 viewPosition = float3(views[v].view._14, views[v].view._24, views[v].view._34);
+
+				if (!VisibleMeshletCone(meshletConeApex, meshletConeAxis, bounds.coneCutoff, viewPosition))
+					viewMask &= ~(1u << v);
+			}
+#else
+			const float3 cameraPosition = float3(camera.view._14, camera.view._24, camera.view._34);
+
+			visible = visible && VisibleMeshletCone(meshletConeApex, meshletConeAxis, bounds.coneCutoff, cameraPosition);
+#endif
+		}
+
+#ifdef USE_MULTI_VIEW
+		visible = viewMask != 0;
+#endif
 	}
 
 #else // USE_AMPLIFICATIONSHADER
 	bool visible = valid;
 #endif // USE_AMPLIFICATIONSHADER
 
+#ifdef USE_CLUSTER_LOD
 	if (visible)
 	{
-		uint index = WavePrefixCountBits(visible);
-		sPayload.meshletIndices[index] = meshletIndex;
+		const float3 lodCameraPosition = float3(camera.view._14, camera.view._24, camera.view._34);
+
+		visible = SelectedMeshletLod(meshletLods[meshletIndex], instanceTransform, lodCameraPosition);
+	}
+#endif // USE_CLUSTER_LOD
+
+#if defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
+	// After the LOD selection: only the meshlets that would be drawn are tested and counted.
+	if (visible && (cullingFlags & CULLING_FLAG_SMALL_MESHLET))
+	{
+		const MeshletBounds bounds = meshletBounds[meshletIndex];
+
+		const float3 smallPosition = mul(instanceTransform, float4(bounds.center, 1.0)).xyz;
+#ifdef USE_MULTI_VIEW
+		// Small in a view: culled for this view only.
+		[unroll]
+		for (uint v = 0; v < MULTI_VIEW_COUNT; ++v)
+		{
+			if ((viewMask & (1u << v)) && !VisibleScreenSize(smallPosition, bounds.radius * instanceScale, views[v].invViewProj))
+				viewMask &= ~(1u << v);
+		}
+
+		const bool bSmall = viewMask == 0;
+#else
+		const bool bSmall = !VisibleScreenSize(smallPosition, bounds.radius * instanceScale, camera.invViewProj);
+#endif
+
+#ifdef USE_CULLING_STATS
+		CountCullingStat(CULLING_STATS_SMALL_MESHLETS_CULLED, bSmall);
+#endif // USE_CULLING_STATS
+
+		visible = !bSmall;
+	}
+#endif // USE_AMPLIFICATIONSHADER && USE_CULLING
+
+#ifdef USE_OCCLUSION_CULLING
+	// Relative to the dispatch (USE_DISCRETE_LOD): the LOD selection is the same in both phases of a frame.
+	// The threads past the last chunk read the first chunk of instance 0 (visibleChunk is 0).
+	const uint meshletBit = MESHLET_VISIBILITY_BIT_OFFSET + instanceMeshes[instanceIndex].chunkOffset * MESHLET_CHUNK_SIZE + dispatchMeshletIndex;
+
+	// cullingPhase is uniform: StoreVisibilityBits is reached by the whole wave.
+	if (cullingPhase == CULLING_PHASE_EARLY)
+	{
+		visible = visible && GetVisibilityBit(meshletBit);
+	}
+	else
+	{
+		if (visible)
+		{
+			const MeshletBounds bounds = meshletBounds[meshletIndex];
+			visible = VisibleDepthPyramid(mul(instanceTransform, float4(bounds.center, 1.0)).xyz, bounds.radius * instanceScale);
+		}
+
+		const bool bDrawnEarly = valid && bInstanceDrawnEarly && GetVisibilityBit(meshletBit);
+
+		// Every thread of a dispatched chunk writes its bit (0 past the meshlets of the selected LOD): the chunk word is whole.
+		StoreVisibilityBits(meshletBit, visible, chunkValid);
+
+		visible = visible && !bDrawnEarly;
+	}
+#endif // USE_OCCLUSION_CULLING
+
+#ifdef USE_CULLING_STATS
+	CountCullingStat(CULLING_STATS_MESHLETS_TESTED, valid);
+	CountCullingStat(CULLING_STATS_MESHLETS_VISIBLE, visible);
+#endif // USE_CULLING_STATS
 
+	// Payload compaction: slot of each visible thread and visible count of the group.
+	uint index = WavePrefixCountBits(visible);
+	uint visibleCount = WaveActiveCountBits(visible);
+
+	// WaveGetLaneCount() is uniform: the whole group takes the same path.
+	if (WaveGetLaneCount() < AS_GROUP_SIZE)
+	{
+		// Several waves per group (smaller wave size than the selected permutation): one groupshared atomic per wave.
+		if (gtid == 0)
+			sVisibleCount = 0;
+
+		GroupMemoryBarrierWithGroupSync();
+
+		uint waveOffset = 0;
+		if (WaveIsFirstLane() && visibleCount > 0)
+			InterlockedAdd(sVisibleCount, visibleCount, waveOffset);
+
+		index += WaveReadLaneFirst(waveOffset);
+
+		GroupMemoryBarrierWithGroupSync();
+
+		visibleCount = sVisibleCount;
+	}
+
+	if (visible)
+	{
 #ifdef USE_INSTANCING
-		sPayload.instanceIndices[index] = instanceIndex;
+		sPayload.entries[index] = PackPayloadEntry(instanceIndex, meshletIndex);
+#else
+		sPayload.entries[index] = PackPayloadEntry(0, meshletIndex);
+#endif
+#ifdef USE_MULTI_VIEW
+		sPayload.viewMasks[index] = viewMask;
 #endif
 	}
 
-	const uint visibleCount = WaveActiveCountBits(visible);
 	DispatchMesh(visibleCount, 1, 1, sPayload);
 }
 
@@ -281,8 +892,25 @@ struct VertexOutput
 
 //-------------------- Mesh Shader --------------------
 
-#define MAX_NUM_VERTS 252
-#define MAX_NUM_PRIMS (MAX_NUM_VERTS / 3)
+// Meshlet limits shared with the cooker (MeshletLimits.h): one permutation per preset is compiled with -D MESHLET_PRESET=N (see CMakeLists.txt).
+#ifndef MESHLET_PRESET
+#define MESHLET_PRESET MESHLET_PRESET_DEFAULT
+#endif
+
+#define MAX_NUM_VERTS MESHLET_PRESET_VALUE(MESHLET_PRESET, MAX_VERTICES)
+#define MAX_NUM_PRIMS MESHLET_PRESET_VALUE(MESHLET_PRESET, MAX_TRIANGLES)
+#define MS_GROUP_SIZE MESHLET_PRESET_VALUE(MESHLET_PRESET, GROUP_SIZE)
+
+#ifdef USE_COMPACT_MESHLETS
+/// See MeshletCooker::CompactMeshlet.
+struct CompactMeshlet
+{
+	uint vertexBase;
+	uint vertexOffset;   // In uint16 vertex indices.
+	uint triangleOffset; // In bytes.
+	uint counts;         // vertexCount | (triangleCount << 16)
+};
+#endif // USE_COMPACT_MESHLETS
 
 struct Meshlet
 {
@@ -292,55 +920,242 @@ struct Meshlet
 	uint triangleCount;
 };
 
+#ifdef USE_COMPACT_MESHLETS
+StructuredBuffer<CompactMeshlet> meshlets : register(t5); // meshletBuffer
+StructuredBuffer<uint>      vertexIndices : register(t6); // meshletVerticesBuffer: 2 uint16 per uint
+StructuredBuffer<uint>    triangleIndices : register(t7); // meshletTrianglesBuffer: 4 bytes per uint
+#else // USE_COMPACT_MESHLETS
 StructuredBuffer<Meshlet>        meshlets : register(t5); // meshletBuffer
 StructuredBuffer<uint>      vertexIndices : register(t6); // meshletVerticesBuffer
 StructuredBuffer<uint>    triangleIndices : register(t7); // meshletTrianglesBuffer
+#endif // USE_COMPACT_MESHLETS
+#ifdef USE_QUANTIZED_VERTICES
+/// See MeshletCooker::QuantizedVertex.
+struct QuantizedVertex
+{
+	uint positionXY;       // unorm16 x | unorm16 y
+	uint positionZTangent; // unorm16 z | octahedral snorm8 tangent
+	uint normal;           // octahedral snorm16 normal
+	uint uv;               // half x | half y
+};
+StructuredBuffer<QuantizedVertex> vertices : register(t8); // vertexBuffer
+#else // USE_QUANTIZED_VERTICES
 StructuredBuffer<VertexFactory>  vertices : register(t8); // vertexBuffer
+#endif // USE_QUANTIZED_VERTICES
 
-[numthreads(128, 1, 1)]
+#ifdef USE_QUANTIZED_VERTICES
+float DecodeSnorm(uint value, uint bits)
+{
+	// Sign extension.
+	const int signedValue = int(value << (32 - bits)) >> (32 - bits);
+	return max(float(signedValue) / float((1u << (bits - 1)) - 1), -1.0);
+}
+
+float3 OctDecode(float2 e)
+{
+	float3 n = float3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+
+	if (n.z < 0.0)
+	{
+		const float wrappedX = (1.0 - abs(n.y)) * (n.x >= 0.0 ? 1.0 : -1.0);
+		const float wrappedY = (1.0 - abs(n.x)) * (n.y >= 0.0 ? 1.0 : -1.0);
+		n.xy = float2(wrappedX, wrappedY);
+	}
+
+	return normalize(n);
+}
+
+VertexFactory DecodeVertex(QuantizedVertex quantized, VertexQuantization vertexQuantization)
+{
+	const float3 unormPosition = float3(quantized.positionXY & 0xFFFF, quantized.positionXY >> 16, quantized.positionZTangent & 0xFFFF) / 65535.0;
+
+	VertexFactory vertex;
+	vertex.position = vertexQuantization.positionMin + unormPosition * vertexQuantization.positionExtent;
+	vertex.normal = OctDecode(float2(DecodeSnorm(quantized.normal & 0xFFFF, 16), DecodeSnorm(quantized.normal >> 16, 16)));
+	vertex.tangent = OctDecode(float2(DecodeSnorm((quantized.positionZTangent >> 16) & 0xFF, 8), DecodeSnorm(quantized.positionZTangent >> 24, 8)));
+	vertex.uv = float2(f16tof32(quantized.uv & 0xFFFF), f16tof32(quantized.uv >> 16));
+
+	return vertex;
+}
+#endif // USE_QUANTIZED_VERTICES
+
+#ifdef USE_COMPACT_MESHLETS
+uint ReadTriangleByte(uint byteOffset)
+{
+	return (triangleIndices[byteOffset >> 2] >> ((byteOffset & 3) * 8)) & 0xFF;
+}
+#endif // USE_COMPACT_MESHLETS
+
+uint3 GetMeshletTriangle(Meshlet meshlet, uint triangleIndex)
+{
+#ifdef USE_COMPACT_MESHLETS
+	const uint byteOffset = meshlet.triangleOffset + 3 * triangleIndex;
+	return uint3(ReadTriangleByte(byteOffset), ReadTriangleByte(byteOffset + 1), ReadTriangleByte(byteOffset + 2));
+#else // USE_COMPACT_MESHLETS
+	uint packedIdx = triangleIndices[meshlet.triangleOffset + triangleIndex];
+	uint vertIdx0 = (packedIdx >> 0) & 0xFF;
+	uint vertIdx1 = (packedIdx >> 8) & 0xFF;
+	uint vertIdx2 = (packedIdx >> 16) & 0xFF;
+	return uint3(vertIdx0, vertIdx1, vertIdx2);
+#endif // USE_COMPACT_MESHLETS
+}
+
+#ifdef USE_COMPACT_MESHLETS
+uint GetMeshletVertexIndex(Meshlet meshlet, uint vertexBase, uint localIndex)
+{
+	const uint offset = meshlet.vertexOffset + localIndex;
+	return vertexBase + ((vertexIndices[offset >> 1] >> ((offset & 1) * 16)) & 0xFFFF);
+}
+#else // USE_COMPACT_MESHLETS
+uint GetMeshletVertexIndex(Meshlet meshlet, uint localIndex)
+{
+	return vertexIndices[meshlet.vertexOffset + localIndex];
+}
+#endif // USE_COMPACT_MESHLETS
+
+#ifdef USE_PRIMITIVE_CULLING
+struct PrimitiveOutput
+{
+	/// Discarded before rasterization.
+	bool cull : SV_CullPrimitive;
+};
+
+/// Clip positions of the meshlet vertices: outputs can't be read back.
+groupshared float4 sClipPositions[MAX_NUM_VERTS];
+
+/**
+*	Backface (FrontCounterClockwise = FALSE), zero area, outside one frustum plane, or between the pixel centers.
+*	Conservative: triangles crossing the camera plane are kept.
+*/
+bool CulledTriangle(float4 clip0, float4 clip1, float4 clip2)
+{
+	if (min(clip0.w, min(clip1.w, clip2.w)) <= 1e-5)
+		return false;
+
+	const float3 ndc0 = clip0.xyz / clip0.w;
+	const float3 ndc1 = clip1.xyz / clip1.w;
+	const float3 ndc2 = clip2.xyz / clip2.w;
+
+	// Every vertex outside the same plane.
+	const float3 ndcMin = min(ndc0, min(ndc1, ndc2));
+	const float3 ndcMax = max(ndc0, max(ndc1, ndc2));
+
+	if (any(ndcMax.xy < -1.0) || any(ndcMin.xy > 1.0) || ndcMax.z < 0.0 || ndcMin.z > 1.0)
+		return true;
+
+	// Pixels, y down: clockwise triangles have a positive area.
+	const float2 pixel0 = (ndc0.xy * float2(0.5, -0.5) + 0.5) * screen.viewportSize;
+	const float2 pixel1 = (ndc1.xy * float2(0.5, -0.5) + 0.5) * screen.viewportSize;
+	const float2 pixel2 = (ndc2.xy * float2(0.5, -0.5) + 0.5) * screen.viewportSize;
+
+	const float2 edge0 = pixel1 - pixel0;
+	const float2 edge1 = pixel2 - pixel0;
+
+	if (edge0.x * edge1.y - edge0.y * edge1.x <= 0.0)
+		return true;
+
+	// Samples at pixel centers: k + 0.5 in [pixelMin, pixelMax] on both axes.
+	const float2 pixelMin = min(pixel0, min(pixel1, pixel2));
+	const float2 pixelMax = max(pixel0, max(pixel1, pixel2));
+
+	return any(floor(pixelMax - 0.5) < ceil(pixelMin - 0.5));
+}
+#endif // USE_PRIMITIVE_CULLING
+
+#ifdef USE_MULTI_VIEW
+/// View instancing: mainMS runs once per view for each meshlet of the payload.
+#define MS_VIEW_ID_INPUT , uint viewId : SV_ViewID
+#else
+#define MS_VIEW_ID_INPUT
+#endif
+
+[numthreads(MS_GROUP_SIZE, 1, 1)]
 [outputtopology("triangle")]
 #ifndef USE_AMPLIFICATIONSHADER
 void mainMS(uint gtid : SV_GroupThreadID, uint gid : SV_GroupID, out vertices VertexOutput outVertices[MAX_NUM_VERTS], out indices uint3 outTriangles[MAX_NUM_PRIMS])
+#elif defined(USE_PRIMITIVE_CULLING)
+void mainMS(uint gtid : SV_GroupThreadID, uint gid : SV_GroupID, in payload Payload payload, out vertices VertexOutput outVertices[MAX_NUM_VERTS], out indices uint3 outTriangles[MAX_NUM_PRIMS],
+	out primitives PrimitiveOutput outPrimitives[MAX_NUM_PRIMS] MS_VIEW_ID_INPUT)
 #else 
-void mainMS(uint gtid : SV_GroupThreadID, uint gid : SV_GroupID, in payload Payload payload, out vertices VertexOutput outVertices[MAX_NUM_VERTS], out indices uint3 outTriangles[MAX_NUM_PRIMS])
+void mainMS(uint gtid : SV_GroupThreadID, uint gid : SV_GroupID, in payload Payload payload, out vertices VertexOutput outVertices[MAX_NUM_VERTS], out indices uint3 outTriangles[MAX_NUM_PRIMS]
+	MS_VIEW_ID_INPUT)
 #endif
 {
 #ifndef USE_AMPLIFICATIONSHADER
-	uint meshletIndex = gid;
+	// Single instance of mesh 0: one group per meshlet of mesh 0.
+	uint meshletIndex = LoadInstanceMesh(0).meshletOffset + gid;
 #else // USE_AMPLIFICATIONSHADER
-	uint meshletIndex = payload.meshletIndices[gid];
+	const uint payloadEntry = payload.entries[gid];
+	uint meshletIndex = GetPayloadMeshletIndex(payloadEntry);
 #endif // USE_AMPLIFICATIONSHADER
 
+#ifdef USE_MULTI_VIEW
+	// Culled in this view by mainAS: viewId is uniform in the group.
+	if (!(payload.viewMasks[gid] & (1u << viewId)))
+	{
+		SetMeshOutputCounts(0, 0);
+		return;
+	}
+
+	const float4x4 viewProj = views[viewId].invViewProj;
+	const float3 cameraPosition = float3(views[viewId].view._14, views[viewId].view._24, views[viewId].view._34);
+#else // USE_MULTI_VIEW
+	const float4x4 viewProj = camera.invViewProj;
+	const float3 cameraPosition = float3(camera.view._14, camera.view._24, camera.view._34);
+#endif // USE_MULTI_VIEW
+
 #if defined(USE_AMPLIFICATIONSHADER) && defined(USE_INSTANCING)
-	uint instanceIndex = payload.instanceIndices[gid];
-	Object currentObject = objects[instanceIndex];
+	uint instanceIndex = GetPayloadInstanceIndex(payloadEntry);
 #else
-	Object currentObject = object;
+	uint instanceIndex = 0;
 #endif
-
+	Object currentObject = LoadObject(instanceIndex);
+#ifdef USE_QUANTIZED_VERTICES
+	// Positions are quantized on the bounds of the file the mesh comes from.
+	const VertexQuantization vertexQuantization = LoadInstanceMesh(instanceIndex).quantization;
+#endif // USE_QUANTIZED_VERTICES
+
+#ifdef USE_COMPACT_MESHLETS
+	const CompactMeshlet compactMeshlet = meshlets[meshletIndex];
+
+	Meshlet meshlet;
+	meshlet.vertexOffset = compactMeshlet.vertexOffset;
+	meshlet.triangleOffset = compactMeshlet.triangleOffset;
+	meshlet.vertexCount = compactMeshlet.counts & 0xFFFF;
+	meshlet.triangleCount = compactMeshlet.counts >> 16;
+#else // USE_COMPACT_MESHLETS
 	Meshlet meshlet = meshlets[meshletIndex];
+#endif // USE_COMPACT_MESHLETS
 
 	SetMeshOutputCounts(meshlet.vertexCount, meshlet.triangleCount);
 
-	if (gtid < meshlet.triangleCount)
-	{
-		uint packedIdx = triangleIndices[meshlet.triangleOffset + gtid];
-		uint vertIdx0 = (packedIdx >> 0) & 0xFF;
-		uint vertIdx1 = (packedIdx >> 8) & 0xFF;
-		uint vertIdx2 = (packedIdx >> 16) & 0xFF;
-		outTriangles[gtid] = uint3(vertIdx0, vertIdx1, vertIdx2);
-	}
+#ifdef USE_CULLING_STATS
+	if (gtid == 0)
+		cullingStats.InterlockedAdd(CULLING_STATS_TRIANGLES_EMITTED, meshlet.triangleCount);
+#endif // USE_CULLING_STATS
 
-	if (gtid < meshlet.vertexCount)
+	// Presets can have more outputs than threads: each thread writes every MS_GROUP_SIZE-th output.
+	for (uint localIndex = gtid; localIndex < meshlet.vertexCount; localIndex += MS_GROUP_SIZE)
 	{
-		const uint vertexIndex = vertexIndices[meshlet.vertexOffset + gtid];
-
+#ifdef USE_COMPACT_MESHLETS
+		const uint vertexIndex = GetMeshletVertexIndex(meshlet, compactMeshlet.vertexBase, localIndex);
+#else // USE_COMPACT_MESHLETS
+		const uint vertexIndex = GetMeshletVertexIndex(meshlet, localIndex);
+#endif // USE_COMPACT_MESHLETS
+
+#ifdef USE_QUANTIZED_VERTICES
+		const VertexFactory vertex = DecodeVertex(vertices[vertexIndex], vertexQuantization);
+#else // USE_QUANTIZED_VERTICES
 		const VertexFactory vertex = vertices[vertexIndex];
+#endif // USE_QUANTIZED_VERTICES
 
 		const float4 worldPosition4 = mul(currentObject.transform, float4(vertex.position, 1.0));
-		outVertices[gtid].worldPosition = worldPosition4.xyz / worldPosition4.w;
-		outVertices[gtid].svPosition = mul(camera.invViewProj, worldPosition4);
-		outVertices[gtid].viewPosition = float3(camera.view._14, camera.view._24, camera.view._34);
+		outVertices[localIndex].worldPosition = worldPosition4.xyz / worldPosition4.w;
+		outVertices[localIndex].svPosition = mul(viewProj, worldPosition4);
+#ifdef USE_PRIMITIVE_CULLING
+		sClipPositions[localIndex] = outVertices[localIndex].svPosition;
+#endif // USE_PRIMITIVE_CULLING
+		outVertices[localIndex].viewPosition = cameraPosition;
 
 #if defined(USE_MESHLET_ID_AS_VERTEX_COLOR) || defined(USE_MESH_SHADER_GROUP_ID_AS_VERTEX_COLOR)
 #ifdef USE_MESHLET_ID_AS_VERTEX_COLOR
@@ -349,9 +1164,9 @@ void mainMS(uint gtid : SV_GroupThreadID, uint gid : SV_GroupID, in payload Payl
 		int colorId = gid;
 #endif // USE_MESHLET_ID_AS_VERTEX_COLOR
 		float3 meshletColor = float3(float(colorId & 1), float(colorId & 3) / 4, float(colorId & 7) / 8);
-		outVertices[gtid].color = meshletColor;
+		outVertices[localIndex].color = meshletColor;
 #else // USE_MESHLET_ID_AS_VERTEX_COLOR || USE_MESH_SHADER_GROUP_ID_AS_VERTEX_COLOR
-		outVertices[gtid].color = float3(1.0, 1.0, 1.0);
+		outVertices[localIndex].color = float3(1.0, 1.0, 1.0);
 #endif // USE_MESHLET_ID_AS_VERTEX_COLOR || USE_MESH_SHADER_GROUP_ID_AS_VERTEX_COLOR
 
 		//---------- Normal ----------
@@ -360,11 +1175,33 @@ void mainMS(uint gtid : SV_GroupThreadID, uint gid : SV_GroupID, in payload Payl
 		const float3 bitangent = cross(normal, tangent);
 
 		/// HLSL uses row-major constructor: transpose to get TBN matrix.
-		outVertices[gtid].TBN = transpose(float3x3(tangent, bitangent, normal));
+		outVertices[localIndex].TBN = transpose(float3x3(tangent, bitangent, normal));
 
 
 		//---------- UV ----------
-		outVertices[gtid].uv = float2(vertex.uv);
+		outVertices[localIndex].uv = float2(vertex.uv);
+	}
+
+#ifdef USE_PRIMITIVE_CULLING
+	// Clip positions of every vertex before the triangle tests.
+	GroupMemoryBarrierWithGroupSync();
+#endif // USE_PRIMITIVE_CULLING
+
+	for (uint triangleIndex = gtid; triangleIndex < meshlet.triangleCount; triangleIndex += MS_GROUP_SIZE)
+	{
+		const uint3 triangleVertices = GetMeshletTriangle(meshlet, triangleIndex);
+		outTriangles[triangleIndex] = triangleVertices;
+
+#ifdef USE_PRIMITIVE_CULLING
+		const bool bCulled = (cullingFlags & CULLING_FLAG_TRIANGLE) &&
+			CulledTriangle(sClipPositions[triangleVertices.x], sClipPositions[triangleVertices.y], sClipPositions[triangleVertices.z]);
+
+		outPrimitives[triangleIndex].cull = bCulled;
+
+#ifdef USE_CULLING_STATS
+		CountCullingStat(CULLING_STATS_TRIANGLES_CULLED, bCulled);
+#endif // USE_CULLING_STATS
+#endif // USE_PRIMITIVE_CULLING
 	}
 }
 
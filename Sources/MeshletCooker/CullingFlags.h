@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+* Runtime culling configuration: single source of truth of the culling tests.
+* Preprocessor only: included by the renderer (mainDX12.cpp) and by the shaders (MeshLitShader.hlsl, LitShader.hlsl),
+* and carried in SceneBuffer::cullingFlags (IndirectCullingConstants::cullingFlags in LitShader.hlsl). The tests can be switched without rebuilding the shaders.
+*
+* USE_CULLING (and USE_INSTANCE_CULLING, USE_OCCLUSION_CULLING) stay compile-time: they add the bindings and passes the tests need.
+*/
+
+/// Visible if the meshlet sphere intersects the sphere wrapping the frustum.
+#define CULLING_FLAG_FRUSTUM_SPHERE (1u << 0)
+
+/// Visible if the meshlet sphere intersects the cone wrapping the frustum.
+#define CULLING_FLAG_FRUSTUM_CONE (1u << 1)
+
+/// Visible if the meshlet sphere is on the positive side of, or intersects, the plane CULLING_FLAGS_PLANE(flags).
+#define CULLING_FLAG_FRUSTUM_SINGLE_PLANE (1u << 2)
+
+/// Visible if the meshlet center is on the positive side of the 6 frustum planes.
+#define CULLING_FLAG_FRUSTUM_ALL_PLANES (1u << 3)
+
+/// Meshlet normal cone: discards the meshlets whose triangles all face away from the camera.
+#define CULLING_FLAG_MESHLET_CONE (1u << 4)
+
+/// USE_INSTANCE_CULLING: frustum tests on the instance bounding spheres. Off: every instance is dispatched.
+#define CULLING_FLAG_INSTANCE (1u << 5)
+
+/// USE_OCCLUSION_CULLING: depth pyramid tests of the late phase. Off: the late phase only tests the frustum.
+#define CULLING_FLAG_OCCLUSION (1u << 6)
+
+/// Meshlets whose projected bounding sphere covers no pixel sample, or is smaller than SceneBuffer::screen.smallMeshletThreshold pixels.
+#define CULLING_FLAG_SMALL_MESHLET (1u << 7)
+
+/// After the plane bits. USE_PRIMITIVE_CULLING: mainMS culls the backfacing, zero area, out of frustum and sub-pixel triangles (SV_CullPrimitive).
+#define CULLING_FLAG_TRIANGLE (1u << 11)
+
+/// Plane tested by CULLING_FLAG_FRUSTUM_SINGLE_PLANE (FRUSTUM_PLANE_*), in bits 8 to 10.
+#define CULLING_FLAGS_PLANE_SHIFT 8
+#define CULLING_FLAGS_PLANE_MASK (7u << CULLING_FLAGS_PLANE_SHIFT)
+#define CULLING_FLAGS_PLANE(_flags) (((_flags) & CULLING_FLAGS_PLANE_MASK) >> CULLING_FLAGS_PLANE_SHIFT)
+
+/// Near plane and frustum cone, meshlet cone, instance, occlusion, small meshlet and triangle culling (FRUSTUM_PLANE_NEAR = 4).
+#define CULLING_FLAGS_DEFAULT (CULLING_FLAG_FRUSTUM_SINGLE_PLANE | CULLING_FLAG_FRUSTUM_CONE | CULLING_FLAG_MESHLET_CONE | \
+	CULLING_FLAG_INSTANCE | CULLING_FLAG_OCCLUSION | CULLING_FLAG_SMALL_MESHLET | CULLING_FLAG_TRIANGLE | (4u << CULLING_FLAGS_PLANE_SHIFT))
@@ -0,0 +1,405 @@
+#include <MeshletCooker/FrustumCulling.hpp>
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define FRUSTUM_CULLING_X64 1
+
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+
+// MSVC compiles intrinsics of any instruction set: the kernel is only called if the CPU supports it.
+#define FRUSTUM_CULLING_TARGET_AVX2
+#else
+#define FRUSTUM_CULLING_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace MeshletCooker
+{
+	void SphereBatch::Resize(size_t _size)
+	{
+		x.resize(_size);
+		y.resize(_size);
+		z.resize(_size);
+		radius.resize(_size);
+	}
+
+	void SphereBatch::Set(size_t _index, const SA::Vec3f& _center, float _radius)
+	{
+		x[_index] = _center.x;
+		y[_index] = _center.y;
+		z[_index] = _center.z;
+		radius[_index] = _radius;
+	}
+
+	/// Frustum values shared by every sphere of a CullSpheres() call.
+	struct CullingConstants
+	{
+		SA::Vec4f sphere;
+
+		SA::Vec3f coneTip;
+		SA::Vec3f coneDirection;
+		float coneHeight = 0.0f;
+		float coneCos = 0.0f;
+		float coneSin = 0.0f;
+
+		/// SignedPointPlaneDistance() normalizes the plane normal.
+		SA::Vec3f planeNormals[static_cast<size_t>(FrustumPlaneId::Count)];
+		SA::Vec3f planePositions[static_cast<size_t>(FrustumPlaneId::Count)];
+	};
+
+	static CullingConstants MakeCullingConstants(const FrustumData& _frustum)
+	{
+		CullingConstants constants;
+
+		constants.sphere = _frustum.boundingSphere;
+
+		constants.coneTip = _frustum.cone.tipPosition;
+		constants.coneDirection = _frustum.cone.direction;
+		constants.coneHeight = _frustum.cone.height;
+		constants.coneCos = std::cos(_frustum.cone.angle * 0.5f);
+		constants.coneSin = std::sin(_frustum.cone.angle * 0.5f);
+
+		for (size_t i = 0; i < static_cast<size_t>(FrustumPlaneId::Count); ++i)
+		{
+			constants.planeNormals[i] = _frustum.planes[i].normal.GetNormalized();
+			constants.planePositions[i] = _frustum.planes[i].position;
+		}
+
+		return constants;
+	}
+
+
+	// === Scalar ===
+
+	static float SignedPlaneDistance(const CullingConstants& _constants, size_t _plane, float _x, float _y, float _z)
+	{
+		const SA::Vec3f& normal = _constants.planeNormals[_plane];
+		const SA::Vec3f& position = _constants.planePositions[_plane];
+
+		return normal.x * (_x - position.x) + normal.y * (_y - position.y) + normal.z * (_z - position.z);
+	}
+
+	static bool IsSphereVisible(const CullingConstants& _constants, const FrustumCullingSettings& _settings, float _x, float _y, float _z, float _radius)
+	{
+		bool bVisible = true;
+
+		// VisibleFrustumSphere
+		if (_settings.bSphere)
+		{
+			const float dx = _x - _constants.sphere.x;
+			const float dy = _y - _constants.sphere.y;
+			const float dz = _z - _constants.sphere.z;
+
+			bVisible &= std::sqrt(dx * dx + dy * dy + dz * dz) < _radius + _constants.sphere.w;
+		}
+
+		// VisibleFrustumCone
+		if (_settings.bCone)
+		{
+			const float vx = _x - _constants.coneTip.x;
+			const float vy = _y - _constants.coneTip.y;
+			const float vz = _z - _constants.coneTip.z;
+
+			const float a = vx * _constants.coneDirection.x + vy * _constants.coneDirection.y + vz * _constants.coneDirection.z;
+			const bool i0 = a <= _constants.coneHeight + _radius;
+
+			const float b = a * _constants.coneSin / _constants.coneCos;
+			const float c = std::sqrt(vx * vx + vy * vy + vz * vz - a * a);
+			const float e = (c - b) * _constants.coneCos;
+			const bool i1 = e < _radius;
+
+			bVisible &= i0 && i1;
+		}
+
+		// VisibleFrustumPlane, visible on intersection.
+		if (_settings.bSinglePlane)
+		{
+			const float distance = SignedPlaneDistance(_constants, static_cast<size_t>(_settings.singlePlane), _x, _y, _z);
+			bVisible &= distance >= 0.0f || std::abs(distance) < _radius;
+		}
+
+		// VisibleFrustumPlanes, not visible on intersection.
+		if (_settings.bAllPlanes)
+		{
+			for (size_t plane = 0; plane < static_cast<size_t>(FrustumPlaneId::Count); ++plane)
+				bVisible &= SignedPlaneDistance(_constants, plane, _x, _y, _z) >= 0.0f;
+		}
+
+		return bVisible;
+	}
+
+	static size_t CullSpheresScalar(const CullingConstants& _constants, const FrustumCullingSettings& _settings, const SphereBatch& _spheres,
+		size_t _first, size_t _end, uint32_t* _outVisible)
+	{
+		size_t visibleCount = 0u;
+
+		for (size_t i = _first; i < _end; ++i)
+		{
+			if (IsSphereVisible(_constants, _settings, _spheres.x[i], _spheres.y[i], _spheres.z[i], _spheres.radius[i]))
+				_outVisible[visibleCount++] = static_cast<uint32_t>(i);
+		}
+
+		return visibleCount;
+	}
+
+#ifdef FRUSTUM_CULLING_X64
+
+	// === SSE (4 spheres) ===
+
+	static __m128 SignedPlaneDistanceSSE(const CullingConstants& _constants, size_t _plane, __m128 _x, __m128 _y, __m128 _z)
+	{
+		const SA::Vec3f& normal = _constants.planeNormals[_plane];
+		const SA::Vec3f& position = _constants.planePositions[_plane];
+
+		const __m128 dx = _mm_mul_ps(_mm_set1_ps(normal.x), _mm_sub_ps(_x, _mm_set1_ps(position.x)));
+		const __m128 dy = _mm_mul_ps(_mm_set1_ps(normal.y), _mm_sub_ps(_y, _mm_set1_ps(position.y)));
+		const __m128 dz = _mm_mul_ps(_mm_set1_ps(normal.z), _mm_sub_ps(_z, _mm_set1_ps(position.z)));
+
+		return _mm_add_ps(_mm_add_ps(dx, dy), dz);
+	}
+
+	static size_t CullSpheresSSE(const CullingConstants& _constants, const FrustumCullingSettings& _settings, const SphereBatch& _spheres,
+		size_t _first, size_t _end, uint32_t* _outVisible)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		size_t visibleCount = 0u;
+		size_t i = _first;
+
+		for (; i + 4 <= _end; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(&_spheres.x[i]);
+			const __m128 y = _mm_loadu_ps(&_spheres.y[i]);
+			const __m128 z = _mm_loadu_ps(&_spheres.z[i]);
+			const __m128 radius = _mm_loadu_ps(&_spheres.radius[i]);
+
+			__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+			if (_settings.bSphere)
+			{
+				const __m128 dx = _mm_sub_ps(x, _mm_set1_ps(_constants.sphere.x));
+				const __m128 dy = _mm_sub_ps(y, _mm_set1_ps(_constants.sphere.y));
+				const __m128 dz = _mm_sub_ps(z, _mm_set1_ps(_constants.sphere.z));
+				const __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+
+				visible = _mm_and_ps(visible, _mm_cmplt_ps(distance, _mm_add_ps(radius, _mm_set1_ps(_constants.sphere.w))));
+			}
+
+			if (_settings.bCone)
+			{
+				const __m128 vx = _mm_sub_ps(x, _mm_set1_ps(_constants.coneTip.x));
+				const __m128 vy = _mm_sub_ps(y, _mm_set1_ps(_constants.coneTip.y));
+				const __m128 vz = _mm_sub_ps(z, _mm_set1_ps(_constants.coneTip.z));
+
+				const __m128 a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_set1_ps(_constants.coneDirection.x)), _mm_mul_ps(vy, _mm_set1_ps(_constants.coneDirection.y))),
+					_mm_mul_ps(vz, _mm_set1_ps(_constants.coneDirection.z)));
+				const __m128 i0 = _mm_cmple_ps(a, _mm_add_ps(_mm_set1_ps(_constants.coneHeight), radius));
+
+				const __m128 b = _mm_div_ps(_mm_mul_ps(a, _mm_set1_ps(_constants.coneSin)), _mm_set1_ps(_constants.coneCos));
+				const __m128 lengthSqr = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+				const __m128 c = _mm_sqrt_ps(_mm_sub_ps(lengthSqr, _mm_mul_ps(a, a)));
+				const __m128 e = _mm_mul_ps(_mm_sub_ps(c, b), _mm_set1_ps(_constants.coneCos));
+				const __m128 i1 = _mm_cmplt_ps(e, radius);
+
+				visible = _mm_and_ps(visible, _mm_and_ps(i0, i1));
+			}
+
+			if (_settings.bSinglePlane)
+			{
+				const __m128 distance = SignedPlaneDistanceSSE(_constants, static_cast<size_t>(_settings.singlePlane), x, y, z);
+				const __m128 positive = _mm_cmpge_ps(distance, _mm_setzero_ps());
+				const __m128 intersect = _mm_cmplt_ps(_mm_andnot_ps(signMask, distance), radius);
+
+				visible = _mm_and_ps(visible, _mm_or_ps(positive, intersect));
+			}
+
+			if (_settings.bAllPlanes)
+			{
+				for (size_t plane = 0; plane < static_cast<size_t>(FrustumPlaneId::Count); ++plane)
+					visible = _mm_and_ps(visible, _mm_cmpge_ps(SignedPlaneDistanceSSE(_constants, plane, x, y, z), _mm_setzero_ps()));
+			}
+
+			const int mask = _mm_movemask_ps(visible);
+
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				if (mask & (1 << lane))
+					_outVisible[visibleCount++] = static_cast<uint32_t>(i + lane);
+			}
+		}
+
+		return visibleCount + CullSpheresScalar(_constants, _settings, _spheres, i, _end, _outVisible + visibleCount);
+	}
+
+
+	// === AVX2 (8 spheres) ===
+
+	FRUSTUM_CULLING_TARGET_AVX2
+	static __m256 SignedPlaneDistanceAVX2(const CullingConstants& _constants, size_t _plane, __m256 _x, __m256 _y, __m256 _z)
+	{
+		const SA::Vec3f& normal = _constants.planeNormals[_plane];
+		const SA::Vec3f& position = _constants.planePositions[_plane];
+
+		const __m256 dx = _mm256_mul_ps(_mm256_set1_ps(normal.x), _mm256_sub_ps(_x, _mm256_set1_ps(position.x)));
+		const __m256 dy = _mm256_mul_ps(_mm256_set1_ps(normal.y), _mm256_sub_ps(_y, _mm256_set1_ps(position.y)));
+		const __m256 dz = _mm256_mul_ps(_mm256_set1_ps(normal.z), _mm256_sub_ps(_z, _mm256_set1_ps(position.z)));
+
+		return _mm256_add_ps(_mm256_add_ps(dx, dy), dz);
+	}
+
+	/// No FMA: same rounding as the scalar and SSE kernels.
+	FRUSTUM_CULLING_TARGET_AVX2
+	static size_t CullSpheresAVX2(const CullingConstants& _constants, const FrustumCullingSettings& _settings, const SphereBatch& _spheres,
+		size_t _first, size_t _end, uint32_t* _outVisible)
+	{
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+		size_t visibleCount = 0u;
+		size_t i = _first;
+
+		for (; i + 8 <= _end; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(&_spheres.x[i]);
+			const __m256 y = _mm256_loadu_ps(&_spheres.y[i]);
+			const __m256 z = _mm256_loadu_ps(&_spheres.z[i]);
+			const __m256 radius = _mm256_loadu_ps(&_spheres.radius[i]);
+
+			__m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+			if (_settings.bSphere)
+			{
+				const __m256 dx = _mm256_sub_ps(x, _mm256_set1_ps(_constants.sphere.x));
+				const __m256 dy = _mm256_sub_ps(y, _mm256_set1_ps(_constants.sphere.y));
+				const __m256 dz = _mm256_sub_ps(z, _mm256_set1_ps(_constants.sphere.z));
+				const __m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz)));
+
+				visible = _mm256_and_ps(visible, _mm256_cmp_ps(distance, _mm256_add_ps(radius, _mm256_set1_ps(_constants.sphere.w)), _CMP_LT_OQ));
+			}
+
+			if (_settings.bCone)
+			{
+				const __m256 vx = _mm256_sub_ps(x, _mm256_set1_ps(_constants.coneTip.x));
+				const __m256 vy = _mm256_sub_ps(y, _mm256_set1_ps(_constants.coneTip.y));
+				const __m256 vz = _mm256_sub_ps(z, _mm256_set1_ps(_constants.coneTip.z));
+
+				const __m256 a = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, _mm256_set1_ps(_constants.coneDirection.x)), _mm256_mul_ps(vy, _mm256_set1_ps(_constants.coneDirection.y))),
+					_mm256_mul_ps(vz, _mm256_set1_ps(_constants.coneDirection.z)));
+				const __m256 i0 = _mm256_cmp_ps(a, _mm256_add_ps(_mm256_set1_ps(_constants.coneHeight), radius), _CMP_LE_OQ);
+
+				const __m256 b = _mm256_div_ps(_mm256_mul_ps(a, _mm256_set1_ps(_constants.coneSin)), _mm256_set1_ps(_constants.coneCos));
+				const __m256 lengthSqr = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)), _mm256_mul_ps(vz, vz));
+				const __m256 c = _mm256_sqrt_ps(_mm256_sub_ps(lengthSqr, _mm256_mul_ps(a, a)));
+				const __m256 e = _mm256_mul_ps(_mm256_sub_ps(c, b), _mm256_set1_ps(_constants.coneCos));
+				const __m256 i1 = _mm256_cmp_ps(e, radius, _CMP_LT_OQ);
+
+				visible = _mm256_and_ps(visible, _mm256_and_ps(i0, i1));
+			}
+
+			if (_settings.bSinglePlane)
+			{
+				const __m256 distance = SignedPlaneDistanceAVX2(_constants, static_cast<size_t>(_settings.singlePlane), x, y, z);
+				const __m256 positive = _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ);
+				const __m256 intersect = _mm256_cmp_ps(_mm256_andnot_ps(signMask, distance), radius, _CMP_LT_OQ);
+
+				visible = _mm256_and_ps(visible, _mm256_or_ps(positive, intersect));
+			}
+
+			if (_settings.bAllPlanes)
+			{
+				for (size_t plane = 0; plane < static_cast<size_t>(FrustumPlaneId::Count); ++plane)
+					visible = _mm256_and_ps(visible, _mm256_cmp_ps(SignedPlaneDistanceAVX2(_constants, plane, x, y, z), _mm256_setzero_ps(), _CMP_GE_OQ));
+			}
+
+			const int mask = _mm256_movemask_ps(visible);
+
+			for (int lane = 0; lane < 8; ++lane)
+			{
+				if (mask & (1 << lane))
+					_outVisible[visibleCount++] = static_cast<uint32_t>(i + lane);
+			}
+		}
+
+		return visibleCount + CullSpheresScalar(_constants, _settings, _spheres, i, _end, _outVisible + visibleCount);
+	}
+
+#endif // FRUSTUM_CULLING_X64
+
+
+	CullingKernel GetBestCullingKernel()
+	{
+#ifdef FRUSTUM_CULLING_X64
+		static const CullingKernel bestKernel = []()
+		{
+#ifdef _MSC_VER
+			int info[4];
+			__cpuid(info, 0);
+			const int maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			const bool bOSXSave = (info[2] & (1 << 27)) != 0;
+			const bool bAVX = (info[2] & (1 << 28)) != 0;
+
+			// The OS saves the YMM registers.
+			const bool bAVXState = bOSXSave && bAVX && (_xgetbv(0) & 0x6) == 0x6;
+
+			bool bAVX2 = false;
+			if (maxLeaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				bAVX2 = (info[1] & (1 << 5)) != 0;
+			}
+
+			return bAVXState && bAVX2 ? CullingKernel::AVX2 : CullingKernel::SSE;
+#else
+			return __builtin_cpu_supports("avx2") ? CullingKernel::AVX2 : CullingKernel::SSE;
+#endif
+		}();
+
+		return bestKernel;
+#else
+		return CullingKernel::Scalar;
+#endif
+	}
+
+	const char* GetCullingKernelName(CullingKernel _kernel)
+	{
+		switch (_kernel)
+		{
+			case CullingKernel::SSE:
+				return "SSE";
+			case CullingKernel::AVX2:
+				return "AVX2";
+			default:
+				return "Scalar";
+		}
+	}
+
+	size_t CullSpheres(const FrustumData& _frustum, const FrustumCullingSettings& _settings, const SphereBatch& _spheres,
+		size_t _first, size_t _count, uint32_t* _outVisible, CullingKernel _kernel)
+	{
+		const CullingConstants constants = MakeCullingConstants(_frustum);
+		const size_t end = _first + _count;
+
+#ifdef FRUSTUM_CULLING_X64
+		if (_kernel == CullingKernel::AVX2)
+			return CullSpheresAVX2(constants, _settings, _spheres, _first, end, _outVisible);
+
+		if (_kernel == CullingKernel::SSE)
+			return CullSpheresSSE(constants, _settings, _spheres, _first, end, _outVisible);
+#endif
+
+		return CullSpheresScalar(constants, _settings, _spheres, _first, end, _outVisible);
+	}
+
+	size_t CullSpheres(const FrustumData& _frustum, const FrustumCullingSettings& _settings, const SphereBatch& _spheres, std::vector<uint32_t>& _outVisible)
+	{
+		_outVisible.resize(_spheres.Size());
+		_outVisible.resize(CullSpheres(_frustum, _settings, _spheres, 0u, _spheres.Size(), _outVisible.data(), GetBestCullingKernel()));
+
+		return _outVisible.size();
+	}
+}
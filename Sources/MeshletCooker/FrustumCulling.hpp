@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+* Sapphire Suite Maths library:
+* Maxime's custom Maths library.
+*/
+#include <SA/Collections/Maths>
+
+/**
+* CPU frustum culling of bounding spheres, mirroring VisibleFrustum() of the shaders (FrustumCulling.hlsli).
+* Same tests as the shader, and the AVX2, SSE and scalar kernels agree bit-exactly with each other.
+* Results may differ from the GPU near plane boundaries (the shader normalizes the planes per test): pre-cull for devices without mesh shaders.
+* Spheres are processed in batches (structure of arrays) by AVX2, SSE or scalar kernels.
+*/
+namespace MeshletCooker
+{
+	// === Frustum data === /* Layouts must match FrustumData in FrustumCulling.hlsli */
+
+	struct FrustumPlane
+	{
+		SA::Vec3f normal;
+		float pad0[1]{ 0.f };
+		SA::Vec3f position;
+		float pad1[1]{ 0.f };
+	};
+
+	struct FrustumCone
+	{
+		SA::Vec3f tipPosition;
+		float height = 0.0f;
+		SA::Vec3f direction;
+		float angle = 0.0f;
+	};
+
+	/// FrustumData::planes order (FRUSTUM_PLANE_* in FrustumCulling.hlsli).
+	enum class FrustumPlaneId : uint32_t
+	{
+		Left = 0,
+		Right,
+		Top,
+		Bottom,
+		Near,
+		Far,
+
+		Count
+	};
+
+	struct FrustumData
+	{
+		FrustumPlane planes[static_cast<size_t>(FrustumPlaneId::Count)];
+		SA::Vec4f    boundingSphere; // position = boundingSphere.xyz, radius = boundingSphere.w
+		FrustumCone  cone;
+	};
+
+
+	// === Culling ===
+
+	/// Enabled tests, combined like the CULLING_FLAG_FRUSTUM_* flags (CullingFlags.h): a sphere is visible if it passes every enabled test.
+	struct FrustumCullingSettings
+	{
+		/// VisibleFrustumSphere (CULLING_FLAG_FRUSTUM_SPHERE).
+		bool bSphere = false;
+
+		/// VisibleFrustumCone (CULLING_FLAG_FRUSTUM_CONE).
+		bool bCone = false;
+
+		/// VisibleFrustumPlane of singlePlane, visible on intersection (CULLING_FLAG_FRUSTUM_SINGLE_PLANE).
+		bool bSinglePlane = false;
+
+		/// VisibleFrustumPlanes, not visible on intersection (CULLING_FLAG_FRUSTUM_ALL_PLANES).
+		bool bAllPlanes = false;
+
+		FrustumPlaneId singlePlane = FrustumPlaneId::Near;
+	};
+
+	/// Bounding spheres in structure of arrays: one SIMD load per component.
+	struct SphereBatch
+	{
+		std::vector<float> x;
+		std::vector<float> y;
+		std::vector<float> z;
+		std::vector<float> radius;
+
+		size_t Size() const { return radius.size(); }
+
+		void Resize(size_t _size);
+		void Set(size_t _index, const SA::Vec3f& _center, float _radius);
+	};
+
+	enum class CullingKernel : uint32_t
+	{
+		Scalar,
+		SSE,
+		AVX2,
+	};
+
+	/// Best kernel supported by the CPU (and the OS for the AVX registers).
+	CullingKernel GetBestCullingKernel();
+
+	const char* GetCullingKernelName(CullingKernel _kernel);
+
+	/**
+	* Tests the spheres [_first, _first + _count) of _spheres against _frustum.
+	* Writes the indices of the visible spheres in _outVisible (at least _count elements), in increasing order, and returns their count.
+	* Every kernel returns the same result.
+	*/
+	size_t CullSpheres(const FrustumData& _frustum, const FrustumCullingSettings& _settings, const SphereBatch& _spheres,
+		size_t _first, size_t _count, uint32_t* _outVisible, CullingKernel _kernel);
+
+	/// Every sphere, with the best kernel.
+	size_t CullSpheres(const FrustumData& _frustum, const FrustumCullingSettings& _settings, const SphereBatch& _spheres, std::vector<uint32_t>& _outVisible);
+}
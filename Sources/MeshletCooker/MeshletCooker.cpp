@@ -0,0 +1,1929 @@
+#include <MeshletCooker/MeshletCooker.hpp>
+#include <MeshletCooker/ParallelFor.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <thread>
+
+/**
+* Sapphire Suite Debugger:
+* Maxime's custom Log and Assert macros for easy debug.
+*/
+#include <SA/Collections/Debug>
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include <meshoptimizer.h>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(MeshletCooker::Meshlet) == sizeof(meshopt_Meshlet), "Meshlet layout must match meshopt_Meshlet");
+static_assert(sizeof(MeshletCooker::MeshletBounds) == 3 * 16, "MeshletBounds layout must match MeshLitShader.hlsl (3 float4)");
+static_assert(sizeof(MeshletCooker::MeshletLod) == 3 * 16, "MeshletLod layout must match MeshLitShader.hlsl (3 float4)");
+static_assert(sizeof(MeshletCooker::MeshLod) == 16, "MeshLod layout must match MeshLitShader.hlsl (uint4)");
+static_assert(sizeof(MeshletCooker::QuantizedVertex) == 16, "QuantizedVertex layout must match MeshLitShader.hlsl (uint4)");
+static_assert(sizeof(MeshletCooker::Settings) % 8 == 0, "Settings must not leave implicit padding in FileHeader");
+static_assert(MeshletCooker::meshletPresets.size() == MESHLET_PRESET_COUNT, "Every MeshletLimits.h preset must be listed in meshletPresets");
+static_assert(MeshletCooker::defaultMeshletPreset < MESHLET_PRESET_COUNT, "MESHLET_PRESET_DEFAULT out of range");
+static_assert([]()
+{
+	for (const MeshletCooker::MeshletPreset& preset : MeshletCooker::meshletPresets)
+	{
+		// D3D12 mesh shader limits, meshopt_buildMeshlets triangle limit alignment, 8-bit local triangle indices.
+		if (preset.maxVertices < 3u || preset.maxVertices > 256u || preset.maxTriangles == 0u || preset.maxTriangles > 256u ||
+			preset.maxTriangles % 4u != 0u || preset.groupSize == 0u || preset.groupSize > 128u)
+			return false;
+	}
+
+	return true;
+}(), "Meshlet presets must fit the D3D12 mesh shader limits");
+
+namespace MeshletCooker
+{
+	// === Cook ===
+
+	/// Meshlets built over a subset of the mesh, with meshlet vertices already remapped to the mesh vertices.
+	struct MeshletChunk
+	{
+		std::vector<Meshlet> meshlets;
+		std::vector<uint32_t> meshletVertices;
+		std::vector<uint32_t> meshletTriangles;
+		std::vector<MeshletBounds> meshletBounds;
+	};
+
+	static bool BuildMeshletChunk(std::span<const uint32_t> _indices, const float* _positions, size_t _vertexCount, size_t _positionStride,
+		const Settings& _settings, MeshletChunk& _out)
+	{
+		const size_t maxMeshlets = meshopt_buildMeshletsBound(_indices.size(), _settings.maxVertices, _settings.maxTriangles);
+		std::vector<meshopt_Meshlet> meshlets(maxMeshlets);
+		std::vector<unsigned int> meshletVertices(maxMeshlets * _settings.maxVertices);
+		std::vector<unsigned char> meshletTriangles(maxMeshlets * _settings.maxTriangles * 3u);
+
+		const size_t meshletCount = meshopt_buildMeshlets(meshlets.data(), meshletVertices.data(), meshletTriangles.data(), _indices.data(),
+			_indices.size(), _positions, _vertexCount, _positionStride, _settings.maxVertices, _settings.maxTriangles, _settings.coneWeight);
+
+		if (meshletCount == 0u)
+		{
+			SA_LOG(L"Meshlet build produced no meshlet!", Error, MeshletCooker);
+			return false;
+		}
+
+		const meshopt_Meshlet& last = meshlets[meshletCount - 1];
+		meshletVertices.resize(last.vertex_offset + last.vertex_count);
+		meshlets.resize(meshletCount);
+
+		_out.meshletVertices.assign(meshletVertices.begin(), meshletVertices.end());
+
+		_out.meshlets.reserve(meshletCount);
+		_out.meshletBounds.reserve(meshletCount);
+
+		for (const meshopt_Meshlet& meshlet : meshlets)
+		{
+			const meshopt_Bounds bounds = meshopt_computeMeshletBounds(&meshletVertices[meshlet.vertex_offset], &meshletTriangles[meshlet.triangle_offset],
+				meshlet.triangle_count, _positions, _vertexCount, _positionStride);
+
+			_out.meshletBounds.push_back(MeshletBounds{
+				.center = SA::Vec3f(bounds.center[0], bounds.center[1], bounds.center[2]),
+				.radius = bounds.radius,
+				.coneApex = SA::Vec3f(bounds.cone_apex[0], bounds.cone_apex[1], bounds.cone_apex[2]),
+				.coneCutoff = bounds.cone_cutoff,
+				.coneAxis = SA::Vec3f(bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2]),
+			});
+
+			// Save triangle offset for current meshlet
+			const uint32_t triangleOffset = static_cast<uint32_t>(_out.meshletTriangles.size());
+
+			// Repack to uint32_t
+			for (uint32_t i = 0; i < meshlet.triangle_count; ++i)
+			{
+				const uint8_t vertIdx0 = meshletTriangles[meshlet.triangle_offset + 3 * i + 0];
+				const uint8_t vertIdx1 = meshletTriangles[meshlet.triangle_offset + 3 * i + 1];
+				const uint8_t vertIdx2 = meshletTriangles[meshlet.triangle_offset + 3 * i + 2];
+				const uint32_t packedIdx = ((static_cast<uint32_t>(vertIdx0) & 0xFF) << 0) |
+										   ((static_cast<uint32_t>(vertIdx1) & 0xFF) << 8) |
+										   ((static_cast<uint32_t>(vertIdx2) & 0xFF) << 16);
+
+				_out.meshletTriangles.push_back(packedIdx);
+			}
+
+			_out.meshlets.push_back(Meshlet{
+				.vertexOffset = meshlet.vertex_offset,
+				.triangleOffset = triangleOffset,
+				.vertexCount = meshlet.vertex_count,
+				.triangleCount = meshlet.triangle_count,
+			});
+		}
+
+		return true;
+	}
+
+	/// Subset of the mesh vertices referenced by a list of mesh indices.
+	struct LocalGeometry
+	{
+		std::vector<uint32_t> indices;
+		std::vector<uint32_t> localToGlobal;
+		std::vector<SA::Vec3f> positions;
+	};
+
+	/// Compacts _indices (mesh vertex indices) on the vertices they use: meshoptimizer then works in O(subset) instead of O(mesh vertex count).
+	static void BuildLocalGeometry(std::span<const uint32_t> _indices, const std::vector<Vertex>& _vertices, LocalGeometry& _out)
+	{
+		// Scratch remap table of the worker, reset after use: O(subset) per call instead of O(mesh vertex count).
+		thread_local std::vector<uint32_t> globalToLocal;
+
+		if (globalToLocal.size() < _vertices.size())
+			globalToLocal.resize(_vertices.size(), ~0u);
+
+		_out.indices.clear();
+		_out.indices.reserve(_indices.size());
+		_out.localToGlobal.clear();
+
+		for (uint32_t vertex : _indices)
+		{
+			if (globalToLocal[vertex] == ~0u)
+			{
+				globalToLocal[vertex] = static_cast<uint32_t>(_out.localToGlobal.size());
+				_out.localToGlobal.push_back(vertex);
+			}
+
+			_out.indices.push_back(globalToLocal[vertex]);
+		}
+
+		for (uint32_t vertex : _out.localToGlobal)
+			globalToLocal[vertex] = ~0u;
+
+		_out.positions.clear();
+		_out.positions.reserve(_out.localToGlobal.size());
+
+		for (uint32_t vertex : _out.localToGlobal)
+			_out.positions.push_back(_vertices[vertex].position);
+	}
+
+	/// Builds the meshlets of the local triangles _indices of _geometry, then remaps the meshlet vertices to the mesh vertices.
+	static bool BuildMeshletChunk(std::span<const uint32_t> _indices, const LocalGeometry& _geometry, const Settings& _settings, MeshletChunk& _out)
+	{
+		if (!BuildMeshletChunk(_indices, &_geometry.positions[0].x, _geometry.positions.size(), sizeof(SA::Vec3f), _settings, _out))
+			return false;
+
+		for (uint32_t& meshletVertex : _out.meshletVertices)
+			meshletVertex = _geometry.localToGlobal[meshletVertex];
+
+		return true;
+	}
+
+	/// Builds the meshlets of the triangles _triangles of the mesh.
+	static bool BuildMeshletChunk(std::span<const uint32_t> _triangles, const std::vector<uint32_t>& _indices, const std::vector<Vertex>& _vertices,
+		const Settings& _settings, MeshletChunk& _out)
+	{
+		std::vector<uint32_t> chunkIndices;
+		chunkIndices.reserve(_triangles.size() * 3);
+
+		for (uint32_t triangle : _triangles)
+		{
+			chunkIndices.push_back(_indices[triangle * 3 + 0]);
+			chunkIndices.push_back(_indices[triangle * 3 + 1]);
+			chunkIndices.push_back(_indices[triangle * 3 + 2]);
+		}
+
+		LocalGeometry geometry;
+		BuildLocalGeometry(chunkIndices, _vertices, geometry);
+
+		return BuildMeshletChunk(geometry.indices, geometry, _settings, _out);
+	}
+
+	static void AppendMeshletChunk(const MeshletChunk& _chunk, CookedMesh& _out)
+	{
+		const uint32_t meshletVertexBase = static_cast<uint32_t>(_out.meshletVertices.size());
+		const uint32_t meshletTriangleBase = static_cast<uint32_t>(_out.meshletTriangles.size());
+
+		_out.meshletVertices.insert(_out.meshletVertices.end(), _chunk.meshletVertices.begin(), _chunk.meshletVertices.end());
+		_out.meshletTriangles.insert(_out.meshletTriangles.end(), _chunk.meshletTriangles.begin(), _chunk.meshletTriangles.end());
+		_out.meshletBounds.insert(_out.meshletBounds.end(), _chunk.meshletBounds.begin(), _chunk.meshletBounds.end());
+
+		for (Meshlet meshlet : _chunk.meshlets)
+		{
+			meshlet.vertexOffset += meshletVertexBase;
+			meshlet.triangleOffset += meshletTriangleBase;
+			_out.meshlets.push_back(meshlet);
+		}
+	}
+
+	/// Rewrites the meshlets of _out in _order: meshlet vertices and triangles follow, so that neighbour meshlets read neighbour memory.
+	static void ReorderMeshlets(std::span<const uint32_t> _order, CookedMesh& _out)
+	{
+		MeshletChunk chunk;
+		chunk.meshlets.reserve(_order.size());
+		chunk.meshletBounds.reserve(_order.size());
+		chunk.meshletVertices.reserve(_out.meshletVertices.size());
+		chunk.meshletTriangles.reserve(_out.meshletTriangles.size());
+
+		for (uint32_t meshletIndex : _order)
+		{
+			Meshlet meshlet = _out.meshlets[meshletIndex];
+
+			const auto vertexBegin = _out.meshletVertices.begin() + meshlet.vertexOffset;
+			const auto triangleBegin = _out.meshletTriangles.begin() + meshlet.triangleOffset;
+
+			meshlet.vertexOffset = static_cast<uint32_t>(chunk.meshletVertices.size());
+			meshlet.triangleOffset = static_cast<uint32_t>(chunk.meshletTriangles.size());
+
+			chunk.meshletVertices.insert(chunk.meshletVertices.end(), vertexBegin, vertexBegin + meshlet.vertexCount);
+			chunk.meshletTriangles.insert(chunk.meshletTriangles.end(), triangleBegin, triangleBegin + meshlet.triangleCount);
+			chunk.meshlets.push_back(meshlet);
+			chunk.meshletBounds.push_back(_out.meshletBounds[meshletIndex]);
+		}
+
+		_out.meshlets.clear();
+		_out.meshletVertices.clear();
+		_out.meshletTriangles.clear();
+		_out.meshletBounds.clear();
+
+		AppendMeshletChunk(chunk, _out);
+	}
+
+	/// Spreads the 10 lowest bits of _value every 3 bits.
+	static uint32_t ExpandMortonBits(uint32_t _value)
+	{
+		_value &= 0x3FF;
+		_value = (_value | (_value << 16)) & 0x030000FF;
+		_value = (_value | (_value << 8)) & 0x0300F00F;
+		_value = (_value | (_value << 4)) & 0x030C30C3;
+		_value = (_value | (_value << 2)) & 0x09249249;
+
+		return _value;
+	}
+
+	/// Triangle indices sorted by the 30 bits Morton code of their centroid (LSD radix sort: stable, the order is deterministic).
+	static std::vector<uint32_t> SortTrianglesByMortonCode(const std::vector<uint32_t>& _indices, const std::vector<Vertex>& _vertices, uint32_t _threadCount)
+	{
+		SA::Vec3f min = _vertices[0].position;
+		SA::Vec3f max = _vertices[0].position;
+
+		for (const Vertex& vertex : _vertices)
+		{
+			min = SA::Vec3f(std::min(min.x, vertex.position.x), std::min(min.y, vertex.position.y), std::min(min.z, vertex.position.z));
+			max = SA::Vec3f(std::max(max.x, vertex.position.x), std::max(max.y, vertex.position.y), std::max(max.z, vertex.position.z));
+		}
+
+		const float extent = std::max(std::max(max.x - min.x, max.y - min.y), std::max(max.z - min.z, 1e-12f));
+		const float scale = 1023.0f / extent;
+
+		const uint32_t triangleCount = static_cast<uint32_t>(_indices.size() / 3);
+
+		std::vector<uint32_t> codes(triangleCount);
+
+		constexpr uint32_t codeBlockSize = 1u << 16;
+
+		ParallelFor((triangleCount + codeBlockSize - 1) / codeBlockSize, _threadCount, [&](size_t _block)
+		{
+			const uint32_t end = std::min(triangleCount, static_cast<uint32_t>(_block + 1) * codeBlockSize);
+
+			for (uint32_t i = static_cast<uint32_t>(_block) * codeBlockSize; i < end; ++i)
+			{
+				const SA::Vec3f& p0 = _vertices[_indices[i * 3 + 0]].position;
+				const SA::Vec3f& p1 = _vertices[_indices[i * 3 + 1]].position;
+				const SA::Vec3f& p2 = _vertices[_indices[i * 3 + 2]].position;
+
+				const uint32_t x = static_cast<uint32_t>(((p0.x + p1.x + p2.x) / 3.0f - min.x) * scale);
+				const uint32_t y = static_cast<uint32_t>(((p0.y + p1.y + p2.y) / 3.0f - min.y) * scale);
+				const uint32_t z = static_cast<uint32_t>(((p0.z + p1.z + p2.z) / 3.0f - min.z) * scale);
+
+				codes[i] = ExpandMortonBits(x) | (ExpandMortonBits(y) << 1) | (ExpandMortonBits(z) << 2);
+			}
+		});
+
+		std::vector<uint32_t> triangles(triangleCount);
+		std::vector<uint32_t> sortedTriangles(triangleCount);
+
+		for (uint32_t i = 0; i < triangleCount; ++i)
+			triangles[i] = i;
+
+		// 3 passes of 10 bits.
+		for (uint32_t shift = 0; shift < 30; shift += 10)
+		{
+			std::array<uint32_t, 1024> histogram{};
+
+			for (uint32_t triangle : triangles)
+				++histogram[(codes[triangle] >> shift) & 0x3FF];
+
+			uint32_t sum = 0u;
+			for (uint32_t& bucket : histogram)
+			{
+				const uint32_t count = bucket;
+				bucket = sum;
+				sum += count;
+			}
+
+			for (uint32_t triangle : triangles)
+				sortedTriangles[histogram[(codes[triangle] >> shift) & 0x3FF]++] = triangle;
+
+			triangles.swap(sortedTriangles);
+		}
+
+		return triangles;
+	}
+
+	/// Grows the sphere (_center, _radius) to contain the sphere (_otherCenter, _otherRadius).
+	static void MergeSphere(SA::Vec3f& _center, float& _radius, const SA::Vec3f& _otherCenter, float _otherRadius)
+	{
+		const SA::Vec3f offset = _otherCenter - _center;
+		const float distance = offset.Length();
+
+		if (distance + _otherRadius <= _radius)
+			return;
+
+		if (distance + _radius <= _otherRadius)
+		{
+			_center = _otherCenter;
+			_radius = _otherRadius;
+			return;
+		}
+
+		const float radius = (distance + _radius + _otherRadius) * 0.5f;
+		_center += offset * ((radius - _radius) / distance);
+		_radius = radius;
+	}
+
+	/// _meshlets sorted by the 30 bits Morton code of their bounding sphere center: consecutive meshlets are neighbours.
+	static std::vector<uint32_t> SortMeshletsByMortonCode(std::vector<uint32_t> _meshlets, const std::vector<MeshletBounds>& _bounds)
+	{
+		SA::Vec3f min = _bounds[_meshlets[0]].center;
+		SA::Vec3f max = _bounds[_meshlets[0]].center;
+
+		for (uint32_t meshlet : _meshlets)
+		{
+			const SA::Vec3f& center = _bounds[meshlet].center;
+			min = SA::Vec3f(std::min(min.x, center.x), std::min(min.y, center.y), std::min(min.z, center.z));
+			max = SA::Vec3f(std::max(max.x, center.x), std::max(max.y, center.y), std::max(max.z, center.z));
+		}
+
+		const float extent = std::max(std::max(max.x - min.x, max.y - min.y), std::max(max.z - min.z, 1e-12f));
+		const float scale = 1023.0f / extent;
+
+		std::vector<std::pair<uint32_t, uint32_t>> codes;
+		codes.reserve(_meshlets.size());
+
+		for (uint32_t meshlet : _meshlets)
+		{
+			const SA::Vec3f& center = _bounds[meshlet].center;
+
+			const uint32_t x = static_cast<uint32_t>((center.x - min.x) * scale);
+			const uint32_t y = static_cast<uint32_t>((center.y - min.y) * scale);
+			const uint32_t z = static_cast<uint32_t>((center.z - min.z) * scale);
+
+			codes.emplace_back(ExpandMortonBits(x) | (ExpandMortonBits(y) << 1) | (ExpandMortonBits(z) << 2), meshlet);
+		}
+
+		std::sort(codes.begin(), codes.end());
+
+		for (size_t i = 0; i < codes.size(); ++i)
+			_meshlets[i] = codes[i].second;
+
+		return _meshlets;
+	}
+
+	/// A simplification removing less than this ratio of the triangles is not worth a new LOD (cluster LOD groups are kept as roots).
+	constexpr float lodMinReduction = 0.15f;
+	constexpr uint32_t clusterLodMaxLevels = 16u;
+
+	/**
+	* Appends the cluster LOD levels of the level 0 meshlets of _out (see MeshletLod).
+	* Each level: groups of _settings.clusterGroupSize neighbouring meshlets are simplified to half of their triangles (borders locked,
+	* so that neighbouring groups still match whatever level they are drawn at) and re-meshletized, on _threadCount workers.
+	*/
+	static bool BuildClusterLod(const Settings& _settings, uint32_t _threadCount, CookedMesh& _out)
+	{
+		struct LodGroup
+		{
+			MeshletChunk chunk;
+
+			SA::Vec3f center;
+			float radius = 0.0f;
+			float error = 0.0f;
+
+			bool bSimplified = false;
+		};
+
+		std::vector<uint32_t> levelMeshlets(_out.meshlets.size());
+		for (uint32_t i = 0; i < levelMeshlets.size(); ++i)
+			levelMeshlets[i] = i;
+
+		for (uint32_t level = 1; levelMeshlets.size() > 1u && level < clusterLodMaxLevels; ++level)
+		{
+			const std::vector<uint32_t> sortedMeshlets = SortMeshletsByMortonCode(std::move(levelMeshlets), _out.meshletBounds);
+			levelMeshlets.clear();
+
+			const size_t groupCount = (sortedMeshlets.size() + _settings.clusterGroupSize - 1) / _settings.clusterGroupSize;
+			std::vector<LodGroup> groups(groupCount);
+			std::vector<uint8_t> results(groupCount, 0u);
+
+			ParallelFor(groupCount, _threadCount, [&](size_t _groupIndex)
+			{
+				LodGroup& group = groups[_groupIndex];
+
+				const std::span<const uint32_t> members = std::span<const uint32_t>(sortedMeshlets).subspan(_groupIndex * _settings.clusterGroupSize,
+					std::min<size_t>(_settings.clusterGroupSize, sortedMeshlets.size() - _groupIndex * _settings.clusterGroupSize));
+
+				// Group bounds and error: contain the children's, so the projected error can only decrease from parent to child.
+				group.center = _out.meshletLods[members[0]].selfCenter;
+				group.radius = _out.meshletLods[members[0]].selfRadius;
+
+				std::vector<uint32_t> groupIndices;
+
+				for (uint32_t meshletIndex : members)
+				{
+					const Meshlet& meshlet = _out.meshlets[meshletIndex];
+					const MeshletLod& lod = _out.meshletLods[meshletIndex];
+
+					MergeSphere(group.center, group.radius, lod.selfCenter, lod.selfRadius);
+					group.error = std::max(group.error, lod.selfError);
+
+					for (uint32_t i = 0; i < meshlet.triangleCount; ++i)
+					{
+						const uint32_t packed = _out.meshletTriangles[meshlet.triangleOffset + i];
+
+						groupIndices.push_back(_out.meshletVertices[meshlet.vertexOffset + ((packed >> 0) & 0xFF)]);
+						groupIndices.push_back(_out.meshletVertices[meshlet.vertexOffset + ((packed >> 8) & 0xFF)]);
+						groupIndices.push_back(_out.meshletVertices[meshlet.vertexOffset + ((packed >> 16) & 0xFF)]);
+					}
+				}
+
+				LocalGeometry geometry;
+				BuildLocalGeometry(groupIndices, _out.vertices, geometry);
+
+				std::vector<uint32_t> simplifiedIndices(geometry.indices.size());
+				float simplificationError = 0.0f;
+
+				const size_t targetIndexCount = geometry.indices.size() / 6 * 3;
+				const size_t simplifiedIndexCount = meshopt_simplify(simplifiedIndices.data(), geometry.indices.data(), geometry.indices.size(),
+					&geometry.positions[0].x, geometry.positions.size(), sizeof(SA::Vec3f), targetIndexCount, 1.0f, meshopt_SimplifyLockBorder, &simplificationError);
+
+				results[_groupIndex] = true;
+
+				if (simplifiedIndexCount == 0u || static_cast<float>(simplifiedIndexCount) > static_cast<float>(geometry.indices.size()) * (1.0f - lodMinReduction))
+					return;
+
+				simplifiedIndices.resize(simplifiedIndexCount);
+
+				// meshopt error is relative to the extent of the group.
+				group.error += simplificationError * meshopt_simplifyScale(&geometry.positions[0].x, geometry.positions.size(), sizeof(SA::Vec3f));
+				group.bSimplified = true;
+
+				results[_groupIndex] = BuildMeshletChunk(simplifiedIndices, geometry, _settings, group.chunk);
+			});
+
+			// Appended in group order: the output does not depend on the scheduling.
+			for (size_t i = 0; i < groupCount; ++i)
+			{
+				if (!results[i])
+				{
+					SA_LOG((L"Failed to build cluster LOD level %1 group %2", level, i), Error, MeshletCooker);
+					return false;
+				}
+
+				const LodGroup& group = groups[i];
+
+				// Not simplified: the members stay roots.
+				if (!group.bSimplified)
+					continue;
+
+				for (size_t j = i * _settings.clusterGroupSize; j < std::min<size_t>((i + 1) * _settings.clusterGroupSize, sortedMeshlets.size()); ++j)
+				{
+					MeshletLod& child = _out.meshletLods[sortedMeshlets[j]];
+					child.parentCenter = group.center;
+					child.parentRadius = group.radius;
+					child.parentError = group.error;
+				}
+
+				const uint32_t meshletBase = static_cast<uint32_t>(_out.meshlets.size());
+				AppendMeshletChunk(group.chunk, _out);
+
+				for (uint32_t meshlet = meshletBase; meshlet < _out.meshlets.size(); ++meshlet)
+				{
+					_out.meshletLods.push_back(MeshletLod{
+						.selfCenter = group.center,
+						.selfRadius = group.radius,
+						.selfError = group.error,
+						.parentError = std::numeric_limits<float>::max(),
+						.level = level,
+					});
+
+					levelMeshlets.push_back(meshlet);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	* Appends the discrete LODs of the mesh (see MeshLod): LOD 0 is the _lod0MeshletCount first meshlets,
+	* LOD i is the whole mesh simplified to 1 / 2^i of its triangles then meshletized, on _threadCount workers.
+	* The chain stops at the first LOD the simplification cannot reduce enough.
+	*/
+	static bool BuildMeshLods(const Settings& _settings, uint32_t _lod0MeshletCount, uint32_t _threadCount, CookedMesh& _out)
+	{
+		_out.meshLods.push_back(MeshLod{
+			.meshletOffset = 0u,
+			.meshletCount = _lod0MeshletCount,
+			.triangleCount = static_cast<uint32_t>(_out.indices.size() / 3),
+		});
+
+		const uint32_t lodCount = std::min(_settings.lodCount, maxMeshLodCount);
+
+		if (lodCount <= 1u)
+			return true;
+
+		struct SimplifiedLod
+		{
+			std::vector<uint32_t> indices;
+			float error = 0.0f;
+
+			MeshletChunk chunk;
+		};
+
+		std::vector<SimplifiedLod> lods(lodCount - 1u);
+		std::vector<uint8_t> results(lods.size(), 0u);
+
+		const float errorScale = meshopt_simplifyScale(&_out.vertices[0].position.x, _out.vertices.size(), sizeof(Vertex));
+
+		// Every LOD is simplified from LOD 0: the errors don't accumulate and the LODs are independent jobs.
+		ParallelFor(lods.size(), _threadCount, [&](size_t _lodIndex)
+		{
+			SimplifiedLod& lod = lods[_lodIndex];
+
+			const size_t targetIndexCount = std::max<size_t>(1u, (_out.indices.size() / 3) >> (_lodIndex + 1)) * 3;
+
+			lod.indices.resize(_out.indices.size());
+			lod.indices.resize(meshopt_simplify(lod.indices.data(), _out.indices.data(), _out.indices.size(), &_out.vertices[0].position.x,
+				_out.vertices.size(), sizeof(Vertex), targetIndexCount, 1.0f, 0u, &lod.error));
+
+			// meshopt error is relative to the extent of the mesh.
+			lod.error *= errorScale;
+
+			if (lod.indices.empty())
+			{
+				results[_lodIndex] = true;
+				return;
+			}
+
+			LocalGeometry geometry;
+			BuildLocalGeometry(lod.indices, _out.vertices, geometry);
+
+			results[_lodIndex] = BuildMeshletChunk(geometry.indices, geometry, _settings, lod.chunk);
+		});
+
+		for (size_t i = 0; i < lods.size(); ++i)
+		{
+			if (!results[i])
+			{
+				SA_LOG((L"Failed to build meshlets of LOD %1", i + 1), Error, MeshletCooker);
+				return false;
+			}
+
+			const SimplifiedLod& lod = lods[i];
+			const uint32_t triangleCount = static_cast<uint32_t>(lod.indices.size() / 3);
+
+			if (triangleCount == 0u || static_cast<float>(triangleCount) > static_cast<float>(_out.meshLods.back().triangleCount) * (1.0f - lodMinReduction))
+				break;
+
+			const uint32_t meshletOffset = static_cast<uint32_t>(_out.meshlets.size());
+			AppendMeshletChunk(lod.chunk, _out);
+
+			// Not part of the cluster hierarchy.
+			for (size_t meshlet = meshletOffset; meshlet < _out.meshlets.size(); ++meshlet)
+			{
+				_out.meshletLods.push_back(MeshletLod{
+					.selfCenter = _out.meshletBounds[meshlet].center,
+					.selfRadius = _out.meshletBounds[meshlet].radius,
+					.selfError = std::numeric_limits<float>::max(),
+					.parentError = std::numeric_limits<float>::max(),
+				});
+			}
+
+			_out.meshLods.push_back(MeshLod{
+				.meshletOffset = meshletOffset,
+				.meshletCount = static_cast<uint32_t>(_out.meshlets.size()) - meshletOffset,
+				.triangleCount = triangleCount,
+				.error = lod.error,
+			});
+		}
+
+		return true;
+	}
+
+	bool CookMesh(const aiMesh& _mesh, const Settings& _settings, CookedMesh& _out, uint32_t _threadCount)
+	{
+		_out = CookedMesh{};
+
+		// Indices: points and lines are not rendered.
+		{
+			_out.indices.reserve(_mesh.mNumFaces * 3);
+
+			for (unsigned int i = 0; i < _mesh.mNumFaces; ++i)
+			{
+				const aiFace& face = _mesh.mFaces[i];
+
+				if (face.mNumIndices != 3u)
+					continue;
+
+				_out.indices.push_back(face.mIndices[0]);
+				_out.indices.push_back(face.mIndices[1]);
+				_out.indices.push_back(face.mIndices[2]);
+			}
+		}
+
+		if (_out.indices.empty())
+		{
+			SA_LOG(L"Mesh has no triangle: cooked as an empty submesh.", Warning, MeshletCooker);
+
+			_out.submeshes.push_back(Submesh{});
+			return true;
+		}
+
+		// Vertices: multi-part models can have parts without normals, tangents or uvs.
+		{
+			if (!_mesh.mNormals || !_mesh.mTangents || !_mesh.mTextureCoords[0])
+				SA_LOG(L"Mesh is missing normals, tangents or uvs: default to zero.", Warning, MeshletCooker);
+
+			_out.vertices.reserve(_mesh.mNumVertices);
+
+			for (uint32_t i = 0; i < _mesh.mNumVertices; ++i)
+			{
+				const aiVector3D& inPosition = _mesh.mVertices[i];
+				const aiVector3D inNormal = _mesh.mNormals ? _mesh.mNormals[i] : aiVector3D();
+				const aiVector3D inTangent = _mesh.mTangents ? _mesh.mTangents[i] : aiVector3D();
+				const aiVector3D inTexCoords = _mesh.mTextureCoords[0] ? _mesh.mTextureCoords[0][i] : aiVector3D();
+
+				Vertex vert;
+				vert.position = SA::Vec3f(inPosition.x, inPosition.y, inPosition.z);
+				vert.normal = SA::Vec3f(inNormal.x, inNormal.y, inNormal.z);
+				vert.tangent = SA::Vec3f(inTangent.x, inTangent.y, inTangent.z);
+				vert.uv = SA::Vec2f(inTexCoords.x, inTexCoords.y);
+				_out.vertices.push_back(vert);
+			}
+		}
+
+		if (_settings.bOptimize)
+			OptimizeMesh(_out.vertices, _out.indices);
+
+		// Meshlets
+		{
+			const uint32_t triangleCount = static_cast<uint32_t>(_out.indices.size() / 3);
+
+			if (_settings.chunkTriangleCount == 0u || triangleCount <= _settings.chunkTriangleCount)
+			{
+				MeshletChunk chunk;
+				if (!BuildMeshletChunk(_out.indices, &_out.vertices[0].position.x, _out.vertices.size(), sizeof(Vertex), _settings, chunk))
+					return false;
+
+				AppendMeshletChunk(chunk, _out);
+			}
+			else
+			{
+				const std::vector<uint32_t> sortedTriangles = SortTrianglesByMortonCode(_out.indices, _out.vertices, _threadCount);
+
+				const uint32_t chunkCount = (triangleCount + _settings.chunkTriangleCount - 1) / _settings.chunkTriangleCount;
+				std::vector<MeshletChunk> chunks(chunkCount);
+				std::vector<uint8_t> results(chunkCount, 0u);
+
+				ParallelFor(chunkCount, _threadCount, [&](size_t _chunkIndex)
+				{
+					const size_t first = _chunkIndex * _settings.chunkTriangleCount;
+					const size_t count = std::min<size_t>(_settings.chunkTriangleCount, triangleCount - first);
+
+					results[_chunkIndex] = BuildMeshletChunk(std::span<const uint32_t>(sortedTriangles).subspan(first, count), _out.indices, _out.vertices, _settings, chunks[_chunkIndex]);
+				});
+
+				for (uint32_t i = 0; i < chunkCount; ++i)
+				{
+					if (!results[i])
+					{
+						SA_LOG((L"Failed to build meshlets of chunk %1", i), Error, MeshletCooker);
+						return false;
+					}
+
+					AppendMeshletChunk(chunks[i], _out);
+				}
+			}
+		}
+
+		if (_settings.bOptimize)
+		{
+			std::vector<uint32_t> meshlets(_out.meshlets.size());
+			for (uint32_t i = 0; i < meshlets.size(); ++i)
+				meshlets[i] = i;
+
+			ReorderMeshlets(SortMeshletsByMortonCode(std::move(meshlets), _out.meshletBounds), _out);
+		}
+
+		const uint32_t lod0MeshletCount = static_cast<uint32_t>(_out.meshlets.size());
+
+		// Cluster LOD: level 0 leaves are the meshlets themselves, roots until simplified.
+		{
+			_out.meshletLods.reserve(_out.meshlets.size());
+
+			for (const MeshletBounds& bounds : _out.meshletBounds)
+			{
+				_out.meshletLods.push_back(MeshletLod{
+					.selfCenter = bounds.center,
+					.selfRadius = bounds.radius,
+					.parentError = std::numeric_limits<float>::max(),
+				});
+			}
+
+			if (_settings.clusterGroupSize > 1u && !BuildClusterLod(_settings, _threadCount, _out))
+				return false;
+		}
+
+		if (!BuildMeshLods(_settings, lod0MeshletCount, _threadCount, _out))
+			return false;
+
+		// Bounding sphere: bounding box center.
+		SA::Vec3f boundsCenter;
+		float boundsRadius = 0.0f;
+		{
+			SA::Vec3f min = _out.vertices[0].position;
+			SA::Vec3f max = _out.vertices[0].position;
+
+			for (const Vertex& vertex : _out.vertices)
+			{
+				min = SA::Vec3f(std::min(min.x, vertex.position.x), std::min(min.y, vertex.position.y), std::min(min.z, vertex.position.z));
+				max = SA::Vec3f(std::max(max.x, vertex.position.x), std::max(max.y, vertex.position.y), std::max(max.z, vertex.position.z));
+			}
+
+			boundsCenter = (min + max) * 0.5f;
+
+			for (const Vertex& vertex : _out.vertices)
+				boundsRadius = std::max(boundsRadius, (vertex.position - boundsCenter).Length());
+		}
+
+		_out.submeshes.push_back(Submesh{
+			.vertexOffset = 0u,
+			.vertexCount = static_cast<uint32_t>(_out.vertices.size()),
+			.indexOffset = 0u,
+			.indexCount = static_cast<uint32_t>(_out.indices.size()),
+			.meshletOffset = 0u,
+			.meshletCount = static_cast<uint32_t>(_out.meshlets.size()),
+			.lodOffset = 0u,
+			.lodCount = static_cast<uint32_t>(_out.meshLods.size()),
+			.boundsCenter = boundsCenter,
+			.boundsRadius = boundsRadius,
+		});
+
+		return true;
+	}
+
+	bool CookMeshes(std::span<const aiMesh* const> _meshes, const Settings& _settings, CookedMesh& _out, uint32_t _threadCount)
+	{
+		std::vector<CookedMesh> parts(_meshes.size());
+		std::vector<uint8_t> results(_meshes.size(), 0u);
+
+		// Largest meshes first: the last jobs picked by the workers are the smallest ones.
+		std::vector<size_t> jobOrder(_meshes.size());
+		for (size_t i = 0; i < jobOrder.size(); ++i)
+			jobOrder[i] = i;
+
+		std::stable_sort(jobOrder.begin(), jobOrder.end(), [&_meshes](size_t _lhs, size_t _rhs)
+		{
+			return _meshes[_lhs]->mNumFaces > _meshes[_rhs]->mNumFaces;
+		});
+
+		// Workers left once every mesh has its own are shared among the meshes to build their chunks.
+		const uint32_t threadCount = _threadCount ? _threadCount : GetDefaultThreadCount();
+		const uint32_t chunkThreadCount = std::max(1u, threadCount / static_cast<uint32_t>(std::max<size_t>(1u, _meshes.size())));
+
+		ParallelFor(jobOrder.size(), threadCount, [&](size_t _job)
+		{
+			const size_t meshIndex = jobOrder[_job];
+			results[meshIndex] = CookMesh(*_meshes[meshIndex], _settings, parts[meshIndex], chunkThreadCount);
+		});
+
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			if (!results[i])
+			{
+				SA_LOG((L"Failed to cook submesh %1", i), Error, MeshletCooker);
+				return false;
+			}
+		}
+
+		MergeCookedMeshes(parts, _out);
+
+		return true;
+	}
+
+	void MergeCookedMeshes(std::span<const CookedMesh> _parts, CookedMesh& _out)
+	{
+		_out = CookedMesh{};
+
+		// Reserve
+		{
+			size_t vertexCount = 0u, indexCount = 0u, meshletCount = 0u, meshletVertexCount = 0u, meshletTriangleCount = 0u, submeshCount = 0u;
+
+			for (const CookedMesh& part : _parts)
+			{
+				vertexCount += part.vertices.size();
+				indexCount += part.indices.size();
+				meshletCount += part.meshlets.size();
+				meshletVertexCount += part.meshletVertices.size();
+				meshletTriangleCount += part.meshletTriangles.size();
+				submeshCount += part.submeshes.size();
+			}
+
+			_out.vertices.reserve(vertexCount);
+			_out.indices.reserve(indexCount);
+			_out.meshlets.reserve(meshletCount);
+			_out.meshletVertices.reserve(meshletVertexCount);
+			_out.meshletTriangles.reserve(meshletTriangleCount);
+			_out.meshletBounds.reserve(meshletCount);
+			_out.meshletLods.reserve(meshletCount);
+			_out.meshLods.reserve(submeshCount);
+			_out.submeshes.reserve(submeshCount);
+		}
+
+		for (const CookedMesh& part : _parts)
+		{
+			const uint32_t vertexBase = static_cast<uint32_t>(_out.vertices.size());
+			const uint32_t indexBase = static_cast<uint32_t>(_out.indices.size());
+			const uint32_t meshletBase = static_cast<uint32_t>(_out.meshlets.size());
+			const uint32_t meshletVertexBase = static_cast<uint32_t>(_out.meshletVertices.size());
+			const uint32_t meshletTriangleBase = static_cast<uint32_t>(_out.meshletTriangles.size());
+			const uint32_t lodBase = static_cast<uint32_t>(_out.meshLods.size());
+
+			_out.vertices.insert(_out.vertices.end(), part.vertices.begin(), part.vertices.end());
+
+			for (uint32_t index : part.indices)
+				_out.indices.push_back(vertexBase + index);
+
+			for (uint32_t meshletVertex : part.meshletVertices)
+				_out.meshletVertices.push_back(vertexBase + meshletVertex);
+
+			// Packed triangles index the meshlet's own vertices: no rebase.
+			_out.meshletTriangles.insert(_out.meshletTriangles.end(), part.meshletTriangles.begin(), part.meshletTriangles.end());
+
+			for (Meshlet meshlet : part.meshlets)
+			{
+				meshlet.vertexOffset += meshletVertexBase;
+				meshlet.triangleOffset += meshletTriangleBase;
+				_out.meshlets.push_back(meshlet);
+			}
+
+			_out.meshletBounds.insert(_out.meshletBounds.end(), part.meshletBounds.begin(), part.meshletBounds.end());
+			_out.meshletLods.insert(_out.meshletLods.end(), part.meshletLods.begin(), part.meshletLods.end());
+
+			for (MeshLod lod : part.meshLods)
+			{
+				lod.meshletOffset += meshletBase;
+				_out.meshLods.push_back(lod);
+			}
+
+			for (Submesh submesh : part.submeshes)
+			{
+				submesh.vertexOffset += vertexBase;
+				submesh.indexOffset += indexBase;
+				submesh.meshletOffset += meshletBase;
+				submesh.lodOffset += lodBase;
+				_out.submeshes.push_back(submesh);
+			}
+		}
+	}
+
+	void OptimizeMesh(std::vector<Vertex>& _vertices, std::vector<uint32_t>& _indices)
+	{
+		if (_indices.empty())
+			return;
+
+		std::vector<uint32_t> sortedIndices(_indices.size());
+		meshopt_spatialSortTriangles(sortedIndices.data(), _indices.data(), _indices.size(), &_vertices[0].position.x, _vertices.size(), sizeof(Vertex));
+
+		meshopt_optimizeVertexCache(_indices.data(), sortedIndices.data(), _indices.size(), _vertices.size());
+
+		std::vector<Vertex> fetchVertices(_vertices.size());
+		fetchVertices.resize(meshopt_optimizeVertexFetch(fetchVertices.data(), _indices.data(), _indices.size(), _vertices.data(), _vertices.size(), sizeof(Vertex)));
+
+		_vertices.swap(fetchVertices);
+	}
+
+	/// LOD 0 meshlet range of _submesh (every meshlet of the submesh for meshes cooked without LOD).
+	static MeshLod GetLod0(const CookedMesh& _mesh, const Submesh& _submesh)
+	{
+		if (_submesh.lodCount)
+			return _mesh.meshLods[_submesh.lodOffset];
+
+		return MeshLod{ .meshletOffset = _submesh.meshletOffset, .meshletCount = _submesh.meshletCount };
+	}
+
+	MeshStatistics AnalyzeMesh(const CookedMesh& _mesh, const Settings& _settings)
+	{
+		MeshStatistics statistics;
+
+		if (_mesh.indices.empty())
+			return statistics;
+
+		const meshopt_VertexCacheStatistics cacheStatistics = meshopt_analyzeVertexCache(_mesh.indices.data(), _mesh.indices.size(), _mesh.vertices.size(), 16u, 0u, 0u);
+		const meshopt_VertexFetchStatistics fetchStatistics = meshopt_analyzeVertexFetch(_mesh.indices.data(), _mesh.indices.size(), _mesh.vertices.size(), sizeof(Vertex));
+
+		statistics.acmr = cacheStatistics.acmr;
+		statistics.atvr = cacheStatistics.atvr;
+		statistics.overfetch = fetchStatistics.overfetch;
+
+		size_t meshletCount = 0u;
+		size_t meshletVertexCount = 0u;
+		size_t meshletTriangleCount = 0u;
+
+		for (const Submesh& submesh : _mesh.submeshes)
+		{
+			const MeshLod lod0 = GetLod0(_mesh, submesh);
+
+			for (uint32_t i = lod0.meshletOffset; i < lod0.meshletOffset + lod0.meshletCount; ++i)
+			{
+				meshletVertexCount += _mesh.meshlets[i].vertexCount;
+				meshletTriangleCount += _mesh.meshlets[i].triangleCount;
+			}
+
+			meshletCount += lod0.meshletCount;
+		}
+
+		if (meshletCount)
+		{
+			statistics.meshletVertexFill = static_cast<float>(static_cast<double>(meshletVertexCount) / static_cast<double>(meshletCount * _settings.maxVertices));
+			statistics.meshletTriangleFill = static_cast<float>(static_cast<double>(meshletTriangleCount) / static_cast<double>(meshletCount * _settings.maxTriangles));
+		}
+
+		return statistics;
+	}
+
+	/**
+	* Convex hull volume of _points (incremental hull, O(n^2): meshlets have at most 256 vertices).
+	* 0 for flat or degenerate point sets, _tolerance is the plane distance under which a point lies on a face.
+	*/
+	static double ConvexHullVolume(std::span<const SA::Vec3f> _points, double _tolerance)
+	{
+		using Point = std::array<double, 3>;
+
+		auto sub = [](const Point& _lhs, const Point& _rhs) { return Point{ _lhs[0] - _rhs[0], _lhs[1] - _rhs[1], _lhs[2] - _rhs[2] }; };
+		auto dot = [](const Point& _lhs, const Point& _rhs) { return _lhs[0] * _rhs[0] + _lhs[1] * _rhs[1] + _lhs[2] * _rhs[2]; };
+		auto cross = [](const Point& _lhs, const Point& _rhs)
+		{
+			return Point{ _lhs[1] * _rhs[2] - _lhs[2] * _rhs[1], _lhs[2] * _rhs[0] - _lhs[0] * _rhs[2], _lhs[0] * _rhs[1] - _lhs[1] * _rhs[0] };
+		};
+
+		if (_points.size() < 4u)
+			return 0.0;
+
+		std::vector<Point> points(_points.size());
+		for (size_t i = 0; i < _points.size(); ++i)
+			points[i] = Point{ _points[i].x, _points[i].y, _points[i].z };
+
+		// Initial tetrahedron: farthest point from p0, from the line (p0, p1), then from the plane (p0, p1, p2).
+		auto farthest = [&](auto&& _distance)
+		{
+			size_t best = 0u;
+			double bestDistance = -1.0;
+
+			for (size_t i = 0; i < points.size(); ++i)
+			{
+				const double distance = _distance(points[i]);
+
+				if (distance > bestDistance)
+				{
+					best = i;
+					bestDistance = distance;
+				}
+			}
+
+			return std::pair<size_t, double>{ best, bestDistance };
+		};
+
+		const size_t i0 = 0u;
+		const std::pair<size_t, double> farthest1 = farthest([&](const Point& _p) { const Point d = sub(_p, points[i0]); return std::sqrt(dot(d, d)); });
+		if (farthest1.second <= _tolerance)
+			return 0.0;
+
+		const size_t i1 = farthest1.first;
+		const Point axis = sub(points[i1], points[i0]);
+		const double axisLength = farthest1.second;
+
+		const std::pair<size_t, double> farthest2 = farthest([&](const Point& _p) { const Point c = cross(axis, sub(_p, points[i0])); return std::sqrt(dot(c, c)) / axisLength; });
+		if (farthest2.second <= _tolerance)
+			return 0.0;
+
+		const size_t i2 = farthest2.first;
+		const Point baseNormal = cross(axis, sub(points[i2], points[i0]));
+		const double baseNormalLength = std::sqrt(dot(baseNormal, baseNormal));
+
+		const std::pair<size_t, double> farthest3 = farthest([&](const Point& _p) { return std::abs(dot(baseNormal, sub(_p, points[i0]))) / baseNormalLength; });
+		if (farthest3.second <= _tolerance)
+			return 0.0;
+
+		const size_t i3 = farthest3.first;
+
+		const Point interior{ (points[i0][0] + points[i1][0] + points[i2][0] + points[i3][0]) * 0.25,
+			(points[i0][1] + points[i1][1] + points[i2][1] + points[i3][1]) * 0.25,
+			(points[i0][2] + points[i1][2] + points[i2][2] + points[i3][2]) * 0.25 };
+
+		struct Face
+		{
+			std::array<size_t, 3> vertices;
+			Point normal{};
+			double offset = 0.0;
+		};
+
+		// Outward normal (towards the opposite side of the interior point).
+		auto makeFace = [&](size_t _a, size_t _b, size_t _c)
+		{
+			Face face{ .vertices = { _a, _b, _c } };
+			face.normal = cross(sub(points[_b], points[_a]), sub(points[_c], points[_a]));
+
+			// Sliver faces keep a null normal: never visible, no volume.
+			const double length = std::sqrt(dot(face.normal, face.normal));
+			if (length > 0.0)
+				face.normal = Point{ face.normal[0] / length, face.normal[1] / length, face.normal[2] / length };
+
+			face.offset = dot(face.normal, points[_a]);
+
+			if (dot(face.normal, interior) > face.offset)
+			{
+				std::swap(face.vertices[1], face.vertices[2]);
+				face.normal = Point{ -face.normal[0], -face.normal[1], -face.normal[2] };
+				face.offset = -face.offset;
+			}
+
+			return face;
+		};
+
+		std::vector<Face> faces{ makeFace(i0, i1, i2), makeFace(i0, i1, i3), makeFace(i0, i2, i3), makeFace(i1, i2, i3) };
+		std::vector<Face> nextFaces;
+		std::vector<std::pair<size_t, size_t>> visibleEdges;
+
+		for (size_t pointIndex = 0; pointIndex < points.size(); ++pointIndex)
+		{
+			const Point& point = points[pointIndex];
+
+			visibleEdges.clear();
+			nextFaces.clear();
+
+			for (const Face& face : faces)
+			{
+				if (dot(face.normal, point) - face.offset > _tolerance)
+				{
+					for (size_t i = 0; i < 3; ++i)
+						visibleEdges.emplace_back(face.vertices[i], face.vertices[(i + 1) % 3]);
+				}
+				else
+					nextFaces.push_back(face);
+			}
+
+			// Inside the hull.
+			if (visibleEdges.empty())
+				continue;
+
+			// Horizon: edges of the visible region whose opposite edge belongs to a hidden face.
+			for (const std::pair<size_t, size_t>& edge : visibleEdges)
+			{
+				const bool bInner = std::find(visibleEdges.begin(), visibleEdges.end(), std::pair<size_t, size_t>{ edge.second, edge.first }) != visibleEdges.end();
+
+				if (!bInner)
+					nextFaces.push_back(makeFace(edge.first, edge.second, pointIndex));
+			}
+
+			faces.swap(nextFaces);
+		}
+
+		// Sum of the tetrahedra (interior, face).
+		double volume = 0.0;
+
+		for (const Face& face : faces)
+		{
+			const Point a = sub(points[face.vertices[0]], interior);
+			const Point b = sub(points[face.vertices[1]], interior);
+			const Point c = sub(points[face.vertices[2]], interior);
+
+			volume += std::abs(dot(a, cross(b, c))) / 6.0;
+		}
+
+		return volume;
+	}
+
+	static Distribution MakeDistribution(std::vector<float>& _values)
+	{
+		Distribution distribution;
+
+		if (_values.empty())
+			return distribution;
+
+		std::sort(_values.begin(), _values.end());
+
+		auto percentile = [&](size_t _percent) { return _values[std::min(_values.size() - 1, (_values.size() * _percent) / 100u)]; };
+
+		double sum = 0.0;
+		for (float value : _values)
+			sum += value;
+
+		distribution.average = static_cast<float>(sum / static_cast<double>(_values.size()));
+		distribution.min = _values.front();
+		distribution.p10 = percentile(10u);
+		distribution.p50 = percentile(50u);
+		distribution.p90 = percentile(90u);
+		distribution.max = _values.back();
+
+		return distribution;
+	}
+
+	MeshletStatistics AnalyzeMeshlets(const CookedMesh& _mesh, std::span<const Submesh> _submeshes, const Settings& _settings, uint32_t _threadCount)
+	{
+		MeshletStatistics statistics;
+
+		std::vector<uint32_t> meshletIndices;
+
+		for (const Submesh& submesh : _submeshes)
+		{
+			const MeshLod lod0 = GetLod0(_mesh, submesh);
+
+			for (uint32_t i = lod0.meshletOffset; i < lod0.meshletOffset + lod0.meshletCount; ++i)
+				meshletIndices.push_back(i);
+		}
+
+		if (meshletIndices.empty())
+			return statistics;
+
+		statistics.meshletCount = static_cast<uint32_t>(meshletIndices.size());
+
+		std::vector<float> vertexFills;
+		std::vector<float> triangleFills;
+		std::vector<float> coneCutoffs;
+		vertexFills.reserve(meshletIndices.size());
+		triangleFills.reserve(meshletIndices.size());
+		coneCutoffs.reserve(meshletIndices.size());
+
+		std::vector<uint32_t> referencedVertices;
+
+		for (uint32_t meshletIndex : meshletIndices)
+		{
+			const Meshlet& meshlet = _mesh.meshlets[meshletIndex];
+			const MeshletBounds& bounds = _mesh.meshletBounds[meshletIndex];
+
+			statistics.triangleCount += meshlet.triangleCount;
+			statistics.meshletVertexCount += meshlet.vertexCount;
+
+			vertexFills.push_back(static_cast<float>(meshlet.vertexCount) / static_cast<float>(_settings.maxVertices));
+			triangleFills.push_back(static_cast<float>(meshlet.triangleCount) / static_cast<float>(_settings.maxTriangles));
+
+			if (bounds.coneCutoff >= 1.0f)
+				++statistics.unculledMeshletCount;
+
+			coneCutoffs.push_back(bounds.coneCutoff);
+
+			referencedVertices.insert(referencedVertices.end(), &_mesh.meshletVertices[meshlet.vertexOffset], &_mesh.meshletVertices[meshlet.vertexOffset] + meshlet.vertexCount);
+		}
+
+		std::sort(referencedVertices.begin(), referencedVertices.end());
+		statistics.vertexCount = static_cast<uint32_t>(std::unique(referencedVertices.begin(), referencedVertices.end()) - referencedVertices.begin());
+		statistics.vertexDuplication = static_cast<float>(statistics.meshletVertexCount) / static_cast<float>(std::max(1u, statistics.vertexCount));
+
+		statistics.vertexFill = MakeDistribution(vertexFills);
+		statistics.triangleFill = MakeDistribution(triangleFills);
+		statistics.coneCutoff = MakeDistribution(coneCutoffs);
+
+		// Bounding sphere against convex hull: 0 for flat meshlets.
+		std::vector<float> sphereHullRatios(meshletIndices.size(), 0.0f);
+
+		ParallelFor(meshletIndices.size(), _threadCount, [&](size_t _index)
+		{
+			thread_local std::vector<SA::Vec3f> positions;
+
+			const Meshlet& meshlet = _mesh.meshlets[meshletIndices[_index]];
+			const MeshletBounds& bounds = _mesh.meshletBounds[meshletIndices[_index]];
+
+			positions.clear();
+			for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+				positions.push_back(_mesh.vertices[_mesh.meshletVertices[meshlet.vertexOffset + i]].position);
+
+			// Points closer than 1e-4 radius to a face are on it: curved meshlets of fine meshes are nearly flat.
+			const double hullVolume = ConvexHullVolume(positions, 1e-4 * bounds.radius);
+			const double sphereVolume = 4.0 / 3.0 * SA::Maths::Pi<double> * static_cast<double>(bounds.radius) * bounds.radius * bounds.radius;
+
+			if (hullVolume > 1e-6 * sphereVolume)
+				sphereHullRatios[_index] = static_cast<float>(sphereVolume / hullVolume);
+		});
+
+		std::vector<float> validRatios;
+		validRatios.reserve(sphereHullRatios.size());
+
+		for (float ratio : sphereHullRatios)
+		{
+			if (ratio > 0.0f)
+				validRatios.push_back(ratio);
+			else
+				++statistics.flatMeshletCount;
+		}
+
+		statistics.sphereHullRatio = MakeDistribution(validRatios);
+
+		return statistics;
+	}
+
+	bool ValidateMeshletCoverage(const CookedMesh& _mesh)
+	{
+		// Rotated to start with the smallest index: keeps the winding.
+		auto canonicalTriangle = [](uint32_t _i0, uint32_t _i1, uint32_t _i2)
+		{
+			if (_i1 < _i0 && _i1 < _i2)
+				return std::array<uint32_t, 3>{ _i1, _i2, _i0 };
+			if (_i2 < _i0 && _i2 < _i1)
+				return std::array<uint32_t, 3>{ _i2, _i0, _i1 };
+
+			return std::array<uint32_t, 3>{ _i0, _i1, _i2 };
+		};
+
+		auto isDegenerate = [](uint32_t _i0, uint32_t _i1, uint32_t _i2)
+		{
+			return _i0 == _i1 || _i1 == _i2 || _i2 == _i0;
+		};
+
+		std::vector<std::array<uint32_t, 3>> sourceTriangles;
+		sourceTriangles.reserve(_mesh.indices.size() / 3);
+
+		for (size_t i = 0; i + 2 < _mesh.indices.size(); i += 3)
+		{
+			if (!isDegenerate(_mesh.indices[i], _mesh.indices[i + 1], _mesh.indices[i + 2]))
+				sourceTriangles.push_back(canonicalTriangle(_mesh.indices[i], _mesh.indices[i + 1], _mesh.indices[i + 2]));
+		}
+
+		std::vector<std::array<uint32_t, 3>> meshletTriangles;
+		meshletTriangles.reserve(sourceTriangles.size());
+
+		// LOD 0 only: the cluster LOD levels and the discrete LODs are simplified copies of the same surface.
+		for (const Submesh& submesh : _mesh.submeshes)
+		{
+			const MeshLod lod0 = GetLod0(_mesh, submesh);
+
+			for (uint32_t meshletIndex = lod0.meshletOffset; meshletIndex < lod0.meshletOffset + lod0.meshletCount; ++meshletIndex)
+			{
+				const Meshlet& meshlet = _mesh.meshlets[meshletIndex];
+
+				for (uint32_t i = 0; i < meshlet.triangleCount; ++i)
+				{
+					const uint32_t packed = _mesh.meshletTriangles[meshlet.triangleOffset + i];
+
+					const uint32_t i0 = _mesh.meshletVertices[meshlet.vertexOffset + ((packed >> 0) & 0xFF)];
+					const uint32_t i1 = _mesh.meshletVertices[meshlet.vertexOffset + ((packed >> 8) & 0xFF)];
+					const uint32_t i2 = _mesh.meshletVertices[meshlet.vertexOffset + ((packed >> 16) & 0xFF)];
+
+					if (!isDegenerate(i0, i1, i2))
+						meshletTriangles.push_back(canonicalTriangle(i0, i1, i2));
+				}
+			}
+		}
+
+		std::sort(sourceTriangles.begin(), sourceTriangles.end());
+		std::sort(meshletTriangles.begin(), meshletTriangles.end());
+
+		if (sourceTriangles != meshletTriangles)
+		{
+			SA_LOG((L"Meshlet coverage mismatch: %1 source triangles, %2 meshlet triangles.", sourceTriangles.size(), meshletTriangles.size()), Error, MeshletCooker);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool CookFile(const std::string& _sourcePath, const Settings& _settings, CookedMesh& _out, uint32_t _threadCount)
+	{
+		Assimp::Importer importer;
+
+		const aiScene* scene = importer.ReadFile(_sourcePath, aiProcess_CalcTangentSpace | aiProcess_Triangulate | aiProcess_ConvertToLeftHanded);
+		if (!scene || scene->mNumMeshes == 0u)
+		{
+			SA_LOG(L"Assimp loading failed!", Error, MeshletCooker, _sourcePath);
+			return false;
+		}
+
+		return CookMeshes(std::span<const aiMesh* const>(scene->mMeshes, scene->mNumMeshes), _settings, _out, _threadCount);
+	}
+
+
+	// === Compact encoding ===
+
+	bool EncodeCompactMeshlets(const CookedMesh& _mesh, CompactMeshletData& _out)
+	{
+		_out = CompactMeshletData{};
+		_out.meshlets.reserve(_mesh.meshlets.size());
+		_out.meshletVertices.reserve(_mesh.meshletVertices.size() + 1);
+		_out.meshletTriangles.reserve(_mesh.meshletTriangles.size() * 3 + 3);
+
+		for (const Meshlet& meshlet : _mesh.meshlets)
+		{
+			const std::span<const uint32_t> vertices(&_mesh.meshletVertices[meshlet.vertexOffset], meshlet.vertexCount);
+
+			const auto [minVertex, maxVertex] = std::minmax_element(vertices.begin(), vertices.end());
+			if (*maxVertex - *minVertex > 0xFFFF)
+			{
+				SA_LOG((L"Meshlet vertex range %1 does not fit in 16 bits: use MeshletEncoding::Uint32.", *maxVertex - *minVertex), Error, MeshletCooker);
+				return false;
+			}
+
+			_out.meshlets.push_back(CompactMeshlet{
+				.vertexBase = *minVertex,
+				.vertexOffset = static_cast<uint32_t>(_out.meshletVertices.size()),
+				.triangleOffset = static_cast<uint32_t>(_out.meshletTriangles.size()),
+				.counts = meshlet.vertexCount | (meshlet.triangleCount << 16),
+			});
+
+			for (uint32_t vertex : vertices)
+				_out.meshletVertices.push_back(static_cast<uint16_t>(vertex - *minVertex));
+
+			for (uint32_t i = 0; i < meshlet.triangleCount; ++i)
+			{
+				const uint32_t packed = _mesh.meshletTriangles[meshlet.triangleOffset + i];
+
+				_out.meshletTriangles.push_back(static_cast<uint8_t>(packed >> 0));
+				_out.meshletTriangles.push_back(static_cast<uint8_t>(packed >> 8));
+				_out.meshletTriangles.push_back(static_cast<uint8_t>(packed >> 16));
+			}
+		}
+
+		_out.meshletVertices.resize((_out.meshletVertices.size() + 1) & ~size_t(1), 0u);
+		_out.meshletTriangles.resize((_out.meshletTriangles.size() + 3) & ~size_t(3), 0u);
+
+		return true;
+	}
+
+	void DecodeCompactMeshlets(std::span<const CompactMeshlet> _meshlets, std::span<const uint16_t> _meshletVertices, std::span<const uint8_t> _meshletTriangles,
+		std::vector<Meshlet>& _outMeshlets, std::vector<uint32_t>& _outMeshletVertices, std::vector<uint32_t>& _outMeshletTriangles)
+	{
+		_outMeshlets.clear();
+		_outMeshletVertices.clear();
+		_outMeshletTriangles.clear();
+
+		for (const CompactMeshlet& compact : _meshlets)
+		{
+			const uint32_t vertexCount = compact.counts & 0xFFFF;
+			const uint32_t triangleCount = compact.counts >> 16;
+
+			_outMeshlets.push_back(Meshlet{
+				.vertexOffset = static_cast<uint32_t>(_outMeshletVertices.size()),
+				.triangleOffset = static_cast<uint32_t>(_outMeshletTriangles.size()),
+				.vertexCount = vertexCount,
+				.triangleCount = triangleCount,
+			});
+
+			for (uint32_t i = 0; i < vertexCount; ++i)
+				_outMeshletVertices.push_back(compact.vertexBase + _meshletVertices[compact.vertexOffset + i]);
+
+			for (uint32_t i = 0; i < triangleCount; ++i)
+			{
+				const uint32_t byteOffset = compact.triangleOffset + 3 * i;
+
+				_outMeshletTriangles.push_back((static_cast<uint32_t>(_meshletTriangles[byteOffset + 0]) << 0) |
+											   (static_cast<uint32_t>(_meshletTriangles[byteOffset + 1]) << 8) |
+											   (static_cast<uint32_t>(_meshletTriangles[byteOffset + 2]) << 16));
+			}
+		}
+	}
+
+
+	// === Quantized vertices ===
+
+	/// Octahedral mapping of a unit vector to [-1, 1]^2.
+	static SA::Vec2f OctEncode(SA::Vec3f _n)
+	{
+		const float l1Norm = std::abs(_n.x) + std::abs(_n.y) + std::abs(_n.z);
+		if (l1Norm <= 0.0f)
+			return SA::Vec2f(0.0f, 0.0f);
+
+		float x = _n.x / l1Norm;
+		float y = _n.y / l1Norm;
+
+		if (_n.z < 0.0f)
+		{
+			const float wrappedX = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+			const float wrappedY = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+			x = wrappedX;
+			y = wrappedY;
+		}
+
+		return SA::Vec2f(x, y);
+	}
+
+	static SA::Vec3f OctDecode(SA::Vec2f _e)
+	{
+		SA::Vec3f n(_e.x, _e.y, 1.0f - std::abs(_e.x) - std::abs(_e.y));
+
+		if (n.z < 0.0f)
+		{
+			const float wrappedX = (1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f);
+			const float wrappedY = (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f);
+			n.x = wrappedX;
+			n.y = wrappedY;
+		}
+
+		return n.GetNormalized();
+	}
+
+	static uint32_t EncodeSnorm(float _value, int _bits)
+	{
+		const int quantized = meshopt_quantizeSnorm(std::clamp(_value, -1.0f, 1.0f), _bits);
+		return static_cast<uint32_t>(quantized) & ((1u << _bits) - 1);
+	}
+
+	static float DecodeSnorm(uint32_t _value, int _bits)
+	{
+		// Sign extension.
+		const int32_t value = static_cast<int32_t>(_value << (32 - _bits)) >> (32 - _bits);
+		return std::max(static_cast<float>(value) / static_cast<float>((1 << (_bits - 1)) - 1), -1.0f);
+	}
+
+	static float DecodeHalf(uint32_t _half)
+	{
+		const uint32_t sign = (_half >> 15) & 0x1;
+		const uint32_t exponent = (_half >> 10) & 0x1F;
+		const uint32_t mantissa = _half & 0x3FF;
+
+		float value = 0.0f;
+
+		if (exponent == 0u)
+			value = std::ldexp(static_cast<float>(mantissa), -24);
+		else if (exponent == 31u)
+			value = mantissa ? NAN : INFINITY;
+		else
+			value = std::ldexp(static_cast<float>(mantissa | 0x400), static_cast<int>(exponent) - 25);
+
+		return sign ? -value : value;
+	}
+
+	static float AngleDegrees(const SA::Vec3f& _lhs, const SA::Vec3f& _rhs)
+	{
+		const float lhsLength = _lhs.Length();
+		const float rhsLength = _rhs.Length();
+
+		if (lhsLength <= 0.0f || rhsLength <= 0.0f)
+			return 0.0f;
+
+		const float cosAngle = std::clamp(SA::Vec3f::Dot(_lhs, _rhs) / (lhsLength * rhsLength), -1.0f, 1.0f);
+		return std::acos(cosAngle) * 180.0f / 3.14159265358979f;
+	}
+
+	void EncodeQuantizedVertices(std::span<const Vertex> _vertices, std::vector<QuantizedVertex>& _out, VertexQuantization& _outQuantization)
+	{
+		_out.clear();
+		_outQuantization = VertexQuantization{};
+
+		if (_vertices.empty())
+			return;
+
+		SA::Vec3f min = _vertices[0].position;
+		SA::Vec3f max = _vertices[0].position;
+
+		for (const Vertex& vertex : _vertices)
+		{
+			min = SA::Vec3f(std::min(min.x, vertex.position.x), std::min(min.y, vertex.position.y), std::min(min.z, vertex.position.z));
+			max = SA::Vec3f(std::max(max.x, vertex.position.x), std::max(max.y, vertex.position.y), std::max(max.z, vertex.position.z));
+		}
+
+		_outQuantization.positionMin = min;
+		_outQuantization.positionExtent = max - min;
+
+		// Flat axis: any value decodes to positionMin.
+		const SA::Vec3f extent = _outQuantization.positionExtent;
+		const SA::Vec3f invExtent(extent.x > 0.0f ? 1.0f / extent.x : 0.0f, extent.y > 0.0f ? 1.0f / extent.y : 0.0f, extent.z > 0.0f ? 1.0f / extent.z : 0.0f);
+
+		_out.reserve(_vertices.size());
+
+		for (const Vertex& vertex : _vertices)
+		{
+			const uint32_t x = static_cast<uint32_t>(meshopt_quantizeUnorm((vertex.position.x - min.x) * invExtent.x, 16));
+			const uint32_t y = static_cast<uint32_t>(meshopt_quantizeUnorm((vertex.position.y - min.y) * invExtent.y, 16));
+			const uint32_t z = static_cast<uint32_t>(meshopt_quantizeUnorm((vertex.position.z - min.z) * invExtent.z, 16));
+
+			const SA::Vec2f normal = OctEncode(vertex.normal);
+			const SA::Vec2f tangent = OctEncode(vertex.tangent);
+
+			_out.push_back(QuantizedVertex{
+				.positionXY = x | (y << 16),
+				.positionZTangent = z | (EncodeSnorm(tangent.x, 8) << 16) | (EncodeSnorm(tangent.y, 8) << 24),
+				.normal = EncodeSnorm(normal.x, 16) | (EncodeSnorm(normal.y, 16) << 16),
+				.uv = static_cast<uint32_t>(meshopt_quantizeHalf(vertex.uv.x)) | (static_cast<uint32_t>(meshopt_quantizeHalf(vertex.uv.y)) << 16),
+			});
+		}
+	}
+
+	Vertex DecodeQuantizedVertex(const QuantizedVertex& _vertex, const VertexQuantization& _quantization)
+	{
+		const float x = static_cast<float>(_vertex.positionXY & 0xFFFF) / 65535.0f;
+		const float y = static_cast<float>(_vertex.positionXY >> 16) / 65535.0f;
+		const float z = static_cast<float>(_vertex.positionZTangent & 0xFFFF) / 65535.0f;
+
+		Vertex vertex;
+		vertex.position = SA::Vec3f(_quantization.positionMin.x + x * _quantization.positionExtent.x,
+			_quantization.positionMin.y + y * _quantization.positionExtent.y,
+			_quantization.positionMin.z + z * _quantization.positionExtent.z);
+		vertex.normal = OctDecode(SA::Vec2f(DecodeSnorm(_vertex.normal & 0xFFFF, 16), DecodeSnorm(_vertex.normal >> 16, 16)));
+		vertex.tangent = OctDecode(SA::Vec2f(DecodeSnorm((_vertex.positionZTangent >> 16) & 0xFF, 8), DecodeSnorm(_vertex.positionZTangent >> 24, 8)));
+		vertex.uv = SA::Vec2f(DecodeHalf(_vertex.uv & 0xFFFF), DecodeHalf(_vertex.uv >> 16));
+
+		return vertex;
+	}
+
+	QuantizationError MeasureQuantizationError(std::span<const Vertex> _vertices, std::span<const QuantizedVertex> _quantizedVertices, const VertexQuantization& _quantization)
+	{
+		QuantizationError error;
+
+		for (size_t i = 0; i < _vertices.size() && i < _quantizedVertices.size(); ++i)
+		{
+			const Vertex& vertex = _vertices[i];
+			const Vertex decoded = DecodeQuantizedVertex(_quantizedVertices[i], _quantization);
+
+			error.maxPositionError = std::max(error.maxPositionError, SA::Vec3f::Dist(vertex.position, decoded.position));
+			error.maxNormalError = std::max(error.maxNormalError, AngleDegrees(vertex.normal, decoded.normal));
+			error.maxTangentError = std::max(error.maxTangentError, AngleDegrees(vertex.tangent, decoded.tangent));
+			error.maxUVError = std::max({ error.maxUVError, std::abs(vertex.uv.x - decoded.uv.x), std::abs(vertex.uv.y - decoded.uv.y) });
+		}
+
+		return error;
+	}
+
+
+	// === Hash ===
+
+	/// FNV-1a 64 bits.
+	static uint64_t HashBytes(const void* _data, size_t _size, uint64_t _hash = 0xcbf29ce484222325ull)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(_data);
+
+		for (size_t i = 0; i < _size; ++i)
+		{
+			_hash ^= bytes[i];
+			_hash *= 0x100000001b3ull;
+		}
+
+		return _hash;
+	}
+
+	bool HashSourceFile(const std::string& _path, uint64_t& _outHash)
+	{
+		std::ifstream file(_path, std::ios::binary);
+		if (!file.is_open())
+		{
+			SA_LOG((L"Failed to open source file {%1}", _path), Error, MeshletCooker);
+			return false;
+		}
+
+		uint64_t hash = HashBytes(nullptr, 0u);
+		std::vector<char> chunk(1u << 20);
+
+		while (file)
+		{
+			file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+			hash = HashBytes(chunk.data(), static_cast<size_t>(file.gcount()), hash);
+		}
+
+		_outHash = hash;
+
+		return true;
+	}
+
+	uint64_t HashSettings(const Settings& _settings)
+	{
+		uint64_t hash = HashBytes(&fileVersion, sizeof(fileVersion));
+		hash = HashBytes(&_settings.maxVertices, sizeof(_settings.maxVertices), hash);
+		hash = HashBytes(&_settings.maxTriangles, sizeof(_settings.maxTriangles), hash);
+		hash = HashBytes(&_settings.coneWeight, sizeof(_settings.coneWeight), hash);
+		hash = HashBytes(&_settings.chunkTriangleCount, sizeof(_settings.chunkTriangleCount), hash);
+		hash = HashBytes(&_settings.encoding, sizeof(_settings.encoding), hash);
+		hash = HashBytes(&_settings.vertexFormat, sizeof(_settings.vertexFormat), hash);
+		hash = HashBytes(&_settings.clusterGroupSize, sizeof(_settings.clusterGroupSize), hash);
+		hash = HashBytes(&_settings.lodCount, sizeof(_settings.lodCount), hash);
+		hash = HashBytes(&_settings.bOptimize, sizeof(_settings.bOptimize), hash);
+
+		return hash;
+	}
+
+
+	// === Write ===
+
+	bool WriteMeshletFile(const std::string& _path, const CookedMesh& _mesh, uint64_t _sourceHash, const Settings& _settings)
+	{
+		struct SectionData
+		{
+			const void* data = nullptr;
+			uint64_t count = 0u;
+			uint32_t elementSize = 0u;
+		};
+
+		CompactMeshletData compactData;
+		const bool bCompact = _settings.encoding == MeshletEncoding::Compact;
+
+		if (bCompact && !EncodeCompactMeshlets(_mesh, compactData))
+			return false;
+
+		std::vector<QuantizedVertex> quantizedVertices;
+		VertexQuantization quantization;
+		const bool bQuantized = _settings.vertexFormat == VertexFormat::Quantized;
+
+		if (bQuantized)
+			EncodeQuantizedVertices(_mesh.vertices, quantizedVertices, quantization);
+
+		const std::array<SectionData, static_cast<size_t>(Section::Count)> sectionDatas{
+			bQuantized ? SectionData{ quantizedVertices.data(), quantizedVertices.size(), sizeof(QuantizedVertex) } :
+				SectionData{ _mesh.vertices.data(), _mesh.vertices.size(), sizeof(Vertex) },
+			SectionData{ _mesh.indices.data(), _mesh.indices.size(), sizeof(uint32_t) },
+			bCompact ? SectionData{ compactData.meshlets.data(), compactData.meshlets.size(), sizeof(CompactMeshlet) } :
+				SectionData{ _mesh.meshlets.data(), _mesh.meshlets.size(), sizeof(Meshlet) },
+			bCompact ? SectionData{ compactData.meshletVertices.data(), compactData.meshletVertices.size(), sizeof(uint16_t) } :
+				SectionData{ _mesh.meshletVertices.data(), _mesh.meshletVertices.size(), sizeof(uint32_t) },
+			bCompact ? SectionData{ compactData.meshletTriangles.data(), compactData.meshletTriangles.size(), sizeof(uint8_t) } :
+				SectionData{ _mesh.meshletTriangles.data(), _mesh.meshletTriangles.size(), sizeof(uint32_t) },
+			SectionData{ _mesh.meshletBounds.data(), _mesh.meshletBounds.size(), sizeof(MeshletBounds) },
+			SectionData{ _mesh.meshletLods.data(), _mesh.meshletLods.size(), sizeof(MeshletLod) },
+			SectionData{ _mesh.meshLods.data(), _mesh.meshLods.size(), sizeof(MeshLod) },
+			SectionData{ _mesh.submeshes.data(), _mesh.submeshes.size(), sizeof(Submesh) },
+		};
+
+		FileHeader header;
+		header.sourceHash = _sourceHash;
+		header.settingsHash = HashSettings(_settings);
+		header.settings = _settings;
+		header.quantization = quantization;
+
+		uint64_t offset = sizeof(FileHeader);
+
+		for (size_t i = 0; i < sectionDatas.size(); ++i)
+		{
+			offset = (offset + fileSectionAlignment - 1) & ~(fileSectionAlignment - 1);
+
+			header.sections[i] = FileSection{
+				.offset = offset,
+				.count = sectionDatas[i].count,
+				.elementSize = sectionDatas[i].elementSize,
+			};
+
+			offset += sectionDatas[i].count * sectionDatas[i].elementSize;
+		}
+
+		/**
+		* Written next to the target then renamed over it:
+		* a crash or a concurrent cooker never leaves a truncated file at _path for the next run to map.
+		* The temporary name is unique per writer: concurrent cookers of the same entry never write the same file.
+		*/
+		std::random_device random;
+		const uint64_t writerKey = ((uint64_t(random()) << 32u) | random()) ^ std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+		char tmpSuffix[32];
+		std::snprintf(tmpSuffix, sizeof(tmpSuffix), ".%016llx.tmp", static_cast<unsigned long long>(writerKey));
+
+		const std::string tmpPath = _path + tmpSuffix;
+
+		{
+			std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+			if (!file.is_open())
+			{
+				SA_LOG((L"Failed to open meshlet file {%1} for writing", tmpPath), Error, MeshletCooker);
+				return false;
+			}
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+
+			const char zeros[fileSectionAlignment]{};
+
+			for (size_t i = 0; i < sectionDatas.size(); ++i)
+			{
+				const uint64_t padding = header.sections[i].offset - static_cast<uint64_t>(file.tellp());
+				file.write(zeros, static_cast<std::streamsize>(padding));
+
+				file.write(static_cast<const char*>(sectionDatas[i].data), static_cast<std::streamsize>(sectionDatas[i].count * sectionDatas[i].elementSize));
+			}
+
+			file.flush();
+
+			if (!file)
+			{
+				SA_LOG((L"Failed to write meshlet file {%1}", tmpPath), Error, MeshletCooker);
+
+				file.close();
+				std::error_code error;
+				std::filesystem::remove(tmpPath, error);
+
+				return false;
+			}
+		}
+
+		// Windows can't replace a file mapped by another process: retry while it is released, then fail (the stale cache is not used).
+		constexpr uint32_t renameAttemptCount = 10u;
+		std::error_code renameError;
+
+		for (uint32_t attempt = 0u; attempt < renameAttemptCount; ++attempt)
+		{
+			std::filesystem::rename(tmpPath, _path, renameError);
+
+			if (!renameError || attempt + 1u == renameAttemptCount)
+				break;
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		}
+
+		if (renameError)
+		{
+			SA_LOG((L"Failed to rename meshlet file {%1} to {%2}: the target may be mapped by another process.", tmpPath, _path), Error, MeshletCooker, renameError.message());
+
+			std::error_code error;
+			std::filesystem::remove(tmpPath, error);
+
+			return false;
+		}
+
+		SA_LOG((L"Write meshlet file {%1} success.", _path), Info, MeshletCooker, (L"%1 bytes", offset));
+
+		return true;
+	}
+
+
+	// === Read ===
+
+	MeshletFile::~MeshletFile()
+	{
+		Close();
+	}
+
+	bool MeshletFile::Open(const std::string& _path)
+	{
+		Close();
+
+#ifdef _WIN32
+		const HANDLE file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize{};
+		GetFileSizeEx(file, &fileSize);
+
+		const HANDLE mapping = fileSize.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+		CloseHandle(file);
+
+		if (!mapping)
+			return false;
+
+		mappedData = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		CloseHandle(mapping);
+
+		if (!mappedData)
+			return false;
+
+		mappedSize = static_cast<uint64_t>(fileSize.QuadPart);
+#else
+		const int file = open(_path.c_str(), O_RDONLY);
+		if (file < 0)
+			return false;
+
+		struct stat fileStat{};
+		fstat(file, &fileStat);
+
+		void* const mapping = fileStat.st_size > 0 ? mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+		close(file);
+
+		if (mapping == MAP_FAILED)
+			return false;
+
+		mappedData = static_cast<const uint8_t*>(mapping);
+		mappedSize = static_cast<uint64_t>(fileStat.st_size);
+#endif
+
+		// Validation
+		{
+			bool bValid = mappedSize >= sizeof(FileHeader) && Header().magic == fileMagic && Header().version == fileVersion;
+
+			const bool bCompact = bValid && Header().settings.encoding == MeshletEncoding::Compact;
+			const bool bQuantized = bValid && Header().settings.vertexFormat == VertexFormat::Quantized;
+
+			const std::array<size_t, static_cast<size_t>(Section::Count)> expectedElementSizes{
+				bQuantized ? sizeof(QuantizedVertex) : sizeof(Vertex),
+				sizeof(uint32_t),
+				bCompact ? sizeof(CompactMeshlet) : sizeof(Meshlet),
+				bCompact ? sizeof(uint16_t) : sizeof(uint32_t),
+				bCompact ? sizeof(uint8_t) : sizeof(uint32_t),
+				sizeof(MeshletBounds),
+				sizeof(MeshletLod),
+				sizeof(MeshLod),
+				sizeof(Submesh),
+			};
+
+			for (size_t i = 0; bValid && i < expectedElementSizes.size(); ++i)
+			{
+				const FileSection& section = Header().sections[i];
+
+				bValid = section.elementSize == expectedElementSizes[i] &&
+					section.offset % fileSectionAlignment == 0u &&
+					section.offset + section.count * section.elementSize <= mappedSize;
+			}
+
+			if (!bValid)
+			{
+				SA_LOG((L"Meshlet file {%1} is invalid or from another version.", _path), Warning, MeshletCooker);
+				Close();
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void MeshletFile::Close()
+	{
+		if (!mappedData)
+			return;
+
+#ifdef _WIN32
+		UnmapViewOfFile(mappedData);
+#else
+		munmap(const_cast<uint8_t*>(mappedData), static_cast<size_t>(mappedSize));
+#endif
+
+		mappedData = nullptr;
+		mappedSize = 0u;
+	}
+
+
+	// === Cache ===
+
+	std::string GetCachePath(const std::string& _sourcePath, const std::string& _cacheDir, const Settings& _settings)
+	{
+		// Sources with the same stem in different directories get different cache files.
+		std::error_code error;
+		std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(_sourcePath, error);
+		if (error)
+			canonicalPath = std::filesystem::absolute(_sourcePath, error);
+
+		const std::string canonicalPathStr = canonicalPath.generic_string();
+
+		char sourceKey[17]{};
+		std::snprintf(sourceKey, sizeof(sourceKey), "%016llx", static_cast<unsigned long long>(HashBytes(canonicalPathStr.data(), canonicalPathStr.size())));
+
+		char settingsKey[17]{};
+		std::snprintf(settingsKey, sizeof(settingsKey), "%016llx", static_cast<unsigned long long>(HashSettings(_settings)));
+
+		const std::filesystem::path path = std::filesystem::path(_cacheDir) /
+			(std::filesystem::path(_sourcePath).stem().string() + "." + sourceKey + "." + settingsKey + ".meshlets");
+
+		return path.string();
+	}
+
+	bool LoadOrCook(const std::string& _sourcePath, const std::string& _cacheDir, const Settings& _settings, MeshletFile& _out)
+	{
+		uint64_t sourceHash = 0u;
+		if (!HashSourceFile(_sourcePath, sourceHash))
+			return false;
+
+		const std::string cachePath = GetCachePath(_sourcePath, _cacheDir, _settings);
+
+		if (_out.Open(cachePath))
+		{
+			const FileHeader& header = _out.Header();
+
+			if (header.sourceHash == sourceHash && header.settingsHash == HashSettings(_settings))
+			{
+				SA_LOG((L"Meshlet cache hit {%1}", cachePath), Info, MeshletCooker);
+				return true;
+			}
+
+			SA_LOG((L"Meshlet cache {%1} is stale: re-cook.", cachePath), Info, MeshletCooker);
+			_out.Close();
+		}
+
+		CookedMesh mesh;
+		if (!CookFile(_sourcePath, _settings, mesh))
+			return false;
+
+		std::error_code error;
+		std::filesystem::create_directories(_cacheDir, error);
+
+		if (!WriteMeshletFile(cachePath, mesh, sourceHash, _settings))
+			return false;
+
+		if (!_out.Open(cachePath))
+		{
+			SA_LOG((L"Failed to map meshlet file {%1}", cachePath), Error, MeshletCooker);
+			return false;
+		}
+
+		return true;
+	}
+}
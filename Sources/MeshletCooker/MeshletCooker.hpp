@@ -0,0 +1,531 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+* Sapphire Suite Maths library:
+* Maxime's custom Maths library.
+*/
+#include <SA/Collections/Maths>
+
+#include <MeshletCooker/MeshletLimits.h>
+
+struct aiMesh;
+
+/**
+* Meshlet cooker:
+* Imports a mesh, builds its meshlets (meshoptimizer), repacks the triangles and computes the meshlet bounds ONCE,
+* then stores everything in a versioned binary file.
+* The renderer memory-maps this file and uploads the sections as-is, without re-deriving anything at launch.
+*/
+namespace MeshletCooker
+{
+	// === Cooked data === /* Layouts must match MeshLitShader.hlsl */
+
+	/// Vertex read by the mesh shader through the `vertices` StructuredBuffer.
+	struct Vertex
+	{
+		SA::Vec3f position;
+		SA::Vec3f normal;
+		SA::Vec3f tangent;
+		SA::Vec2f uv;
+	};
+
+	/**
+	* 16 bytes quantized Vertex (vs 44 bytes), decoded by mainMS (USE_QUANTIZED_VERTICES):
+	* - position: unorm16 relative to the mesh bounds (VertexQuantization).
+	* - normal: octahedral snorm16 x2.
+	* - tangent: octahedral snorm8 x2.
+	* - uv: half x2.
+	*/
+	struct QuantizedVertex
+	{
+		/// position.x | (position.y << 16)
+		uint32_t positionXY = 0u;
+
+		/// position.z | (tangent.x << 16) | (tangent.y << 24)
+		uint32_t positionZTangent = 0u;
+
+		/// normal.x | (normal.y << 16)
+		uint32_t normal = 0u;
+
+		/// uv.x | (uv.y << 16)
+		uint32_t uv = 0u;
+	};
+
+	/// Mesh bounds the quantized positions are relative to: position = positionMin + unorm * positionExtent.
+	struct VertexQuantization
+	{
+		SA::Vec3f positionMin;
+		float pad0 = 0.0f;
+		SA::Vec3f positionExtent;
+		float pad1 = 0.0f;
+	};
+
+	/// Same memory layout as meshopt_Meshlet.
+	struct Meshlet
+	{
+		uint32_t vertexOffset = 0u;
+
+		/// Offset in packed triangles (1 uint32 per triangle), NOT in bytes.
+		uint32_t triangleOffset = 0u;
+
+		uint32_t vertexCount = 0u;
+		uint32_t triangleCount = 0u;
+	};
+
+	struct MeshletBounds
+	{
+		/// Bounding sphere.
+		SA::Vec3f center;
+		float radius = 0.0f;
+
+		/**
+		* Normal cone: every triangle faces away from a camera at cameraPosition if
+		* dot(normalize(coneApex - cameraPosition), coneAxis) >= coneCutoff.
+		* coneCutoff is 1 for meshlets whose normals are too spread out to ever be culled.
+		*/
+		SA::Vec3f coneApex;
+		float coneCutoff = 1.0f;
+		SA::Vec3f coneAxis;
+		float pad0 = 0.0f;
+	};
+
+	/**
+	* Cluster LOD hierarchy (meshlet DAG) node.
+	* Groups of neighbouring meshlets are simplified together and re-meshletized into the next (coarser) level:
+	* the "self" values describe the group the meshlet was built from, the "parent" values the group it was simplified into.
+	* Both groups of a meshlet are shared by all its siblings, so selecting
+	*     projectedError(self) <= threshold && projectedError(parent) > threshold
+	* independently for every meshlet gives a crack-free cut of the hierarchy.
+	*/
+	struct MeshletLod
+	{
+		/// Bounding sphere (center, radius) of the group this meshlet was built from (its own bounds for level 0).
+		SA::Vec3f selfCenter;
+		float selfRadius = 0.0f;
+
+		/// Bounding sphere of the group this meshlet was simplified into.
+		SA::Vec3f parentCenter;
+		float parentRadius = 0.0f;
+
+		/// Object space simplification error accumulated from level 0 (0 for level 0, FLT_MAX for discrete LOD meshlets: never selected).
+		float selfError = 0.0f;
+
+		/// FLT_MAX for the roots of the hierarchy (never simplified further).
+		float parentError = 0.0f;
+
+		uint32_t level = 0u;
+		uint32_t pad0 = 0u;
+	};
+
+	/// Maximum number of discrete LODs of a submesh (LOD 0 included).
+	constexpr uint32_t maxMeshLodCount = 8u;
+
+	/// Discrete LOD of a submesh: the whole submesh simplified and meshletized in its own meshlet range.
+	struct MeshLod
+	{
+		uint32_t meshletOffset = 0u;
+		uint32_t meshletCount = 0u;
+		uint32_t triangleCount = 0u;
+
+		/// Object space simplification error (0 for LOD 0).
+		float error = 0.0f;
+	};
+
+	enum class MeshletEncoding : uint32_t
+	{
+		/// Meshlet (16B), uint32 global vertex indices, 1 uint32 per triangle.
+		Uint32,
+
+		/// CompactMeshlet (16B), uint16 vertex indices relative to the meshlet vertexBase, 3 bytes per triangle.
+		Compact,
+	};
+
+	/**
+	* Compact encoding of a Meshlet.
+	* Vertex indices are read 2 per uint32 and triangles 4 bytes per uint32 by mainMS (USE_COMPACT_MESHLETS).
+	*/
+	struct CompactMeshlet
+	{
+		/// Smallest mesh vertex index of the meshlet.
+		uint32_t vertexBase = 0u;
+
+		/// Offset in uint16 vertex indices.
+		uint32_t vertexOffset = 0u;
+
+		/// Offset in bytes: triangle i is the bytes [triangleOffset + 3 * i, triangleOffset + 3 * i + 2].
+		uint32_t triangleOffset = 0u;
+
+		/// vertexCount | (triangleCount << 16).
+		uint32_t counts = 0u;
+	};
+
+	enum class VertexFormat : uint32_t
+	{
+		/// Vertex (44B).
+		Float32,
+
+		/// QuantizedVertex (16B).
+		Quantized,
+	};
+
+	/// Meshlet limits and Mesh Shader permutation (see MeshletLimits.h).
+	struct MeshletPreset
+	{
+		uint32_t maxVertices = 0u;
+		uint32_t maxTriangles = 0u;
+
+		/// mainMS thread count.
+		uint32_t groupSize = 0u;
+	};
+
+	constexpr uint32_t defaultMeshletPreset = MESHLET_PRESET_DEFAULT;
+
+	constexpr std::array<MeshletPreset, MESHLET_PRESET_COUNT> meshletPresets{ {
+		{ MESHLET_PRESET_0_MAX_VERTICES, MESHLET_PRESET_0_MAX_TRIANGLES, MESHLET_PRESET_0_GROUP_SIZE },
+		{ MESHLET_PRESET_1_MAX_VERTICES, MESHLET_PRESET_1_MAX_TRIANGLES, MESHLET_PRESET_1_GROUP_SIZE },
+		{ MESHLET_PRESET_2_MAX_VERTICES, MESHLET_PRESET_2_MAX_TRIANGLES, MESHLET_PRESET_2_GROUP_SIZE },
+		{ MESHLET_PRESET_3_MAX_VERTICES, MESHLET_PRESET_3_MAX_TRIANGLES, MESHLET_PRESET_3_GROUP_SIZE },
+	} };
+
+	/// Index of the preset with these limits, meshletPresets.size() if none: the renderer has no Mesh Shader permutation for them.
+	constexpr uint32_t FindMeshletPreset(uint32_t _maxVertices, uint32_t _maxTriangles)
+	{
+		for (uint32_t i = 0; i < meshletPresets.size(); ++i)
+		{
+			if (meshletPresets[i].maxVertices == _maxVertices && meshletPresets[i].maxTriangles == _maxTriangles)
+				return i;
+		}
+
+		return static_cast<uint32_t>(meshletPresets.size());
+	}
+
+	struct Settings
+	{
+		uint32_t maxVertices = meshletPresets[defaultMeshletPreset].maxVertices;
+		uint32_t maxTriangles = meshletPresets[defaultMeshletPreset].maxTriangles;
+
+		/// Trade-off between meshlet compactness (0) and normal cone tightness (1) used by meshopt_buildMeshlets.
+		float coneWeight = 0.0f;
+
+		/**
+		* Meshes with more triangles are split in spatially coherent chunks (Morton order of the triangle centroids) of this size,
+		* meshletized independently in parallel. 0: never split.
+		*/
+		uint32_t chunkTriangleCount = 1u << 18;
+
+		/// Encoding of the meshlets, meshlet vertices and meshlet triangles sections of the file.
+		MeshletEncoding encoding = MeshletEncoding::Uint32;
+
+		/// Format of the vertices section of the file.
+		VertexFormat vertexFormat = VertexFormat::Float32;
+
+		/// Number of neighbouring meshlets simplified together per cluster LOD level. 0: no hierarchy (level 0 only).
+		uint32_t clusterGroupSize = 0u;
+
+		/// Number of discrete LODs (LOD 0 included, up to maxMeshLodCount): LOD i has 1 / 2^i of the triangles. 0 or 1: LOD 0 only.
+		uint32_t lodCount = 0u;
+
+		/// Runs OptimizeMesh() before meshletization and sorts the LOD 0 meshlets spatially.
+		bool bOptimize = false;
+		uint8_t pad0[7]{};
+	};
+
+	/// Range of a source aiMesh in the merged CookedMesh buffers.
+	struct Submesh
+	{
+		uint32_t vertexOffset = 0u;
+		uint32_t vertexCount = 0u;
+
+		uint32_t indexOffset = 0u;
+		uint32_t indexCount = 0u;
+
+		/// Every meshlet of the submesh: LOD 0, then the cluster LOD levels and the discrete LODs.
+		uint32_t meshletOffset = 0u;
+		uint32_t meshletCount = 0u;
+
+		/// Range in CookedMesh::meshLods. LOD 0 is always present for non-empty submeshes.
+		uint32_t lodOffset = 0u;
+		uint32_t lodCount = 0u;
+
+		/// Bounding sphere of the submesh.
+		SA::Vec3f boundsCenter;
+		float boundsRadius = 0.0f;
+	};
+
+	struct CookedMesh
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+
+		std::vector<Meshlet> meshlets;
+		std::vector<uint32_t> meshletVertices;
+
+		/// 3 local uint8 vertex indices packed in a uint32: (i0 << 0) | (i1 << 8) | (i2 << 16).
+		std::vector<uint32_t> meshletTriangles;
+
+		std::vector<MeshletBounds> meshletBounds;
+
+		/// 1 per meshlet: level 0 meshlets cover the source triangles, the following levels are their simplified versions.
+		std::vector<MeshletLod> meshletLods;
+
+		/// Meshlet offsets are in the merged meshlet buffer.
+		std::vector<MeshLod> meshLods;
+
+		std::vector<Submesh> submeshes;
+	};
+
+	/**
+	* Cooks a single mesh: indices and meshlet vertices are local to _mesh (1 submesh).
+	* Meshes above _settings.chunkTriangleCount are meshletized by chunks on _threadCount workers (0: hardware concurrency).
+	* The cluster LOD levels (_settings.clusterGroupSize) then the discrete LODs (_settings.lodCount) are appended after the LOD 0 meshlets, in the same submesh.
+	*/
+	bool CookMesh(const aiMesh& _mesh, const Settings& _settings, CookedMesh& _out, uint32_t _threadCount = 1u);
+
+	/**
+	* Cooks every mesh concurrently (1 job per mesh, largest first) on _threadCount workers (0: hardware concurrency), then merges them.
+	* The output only depends on the order of _meshes, not on the thread count nor the scheduling.
+	*/
+	bool CookMeshes(std::span<const aiMesh* const> _meshes, const Settings& _settings, CookedMesh& _out, uint32_t _threadCount = 0u);
+
+	/**
+	* Appends _parts in order in _out: indices and meshlet vertices are rebased on the merged vertex buffer,
+	* meshlet offsets on the merged meshlet vertex/triangle buffers, LOD meshlet ranges on the merged meshlet buffer.
+	*/
+	void MergeCookedMeshes(std::span<const CookedMesh> _parts, CookedMesh& _out);
+
+	/**
+	* Optimize stage, for both the indexed and the meshlet paths:
+	* - triangles sorted spatially (meshopt_spatialSortTriangles), then for the post-transform vertex cache (meshopt_optimizeVertexCache).
+	* - vertices in first use order (meshopt_optimizeVertexFetch): unused vertices are removed.
+	*/
+	void OptimizeMesh(std::vector<Vertex>& _vertices, std::vector<uint32_t>& _indices);
+
+	struct MeshStatistics
+	{
+		/// Post-transform vertex cache (16 entries): transformed vertices per triangle and per vertex.
+		float acmr = 0.0f;
+		float atvr = 0.0f;
+
+		/// Fetched vertex bytes over the vertex buffer size.
+		float overfetch = 0.0f;
+
+		/// LOD 0 meshlets: average vertex and triangle counts over Settings::maxVertices and Settings::maxTriangles.
+		float meshletVertexFill = 0.0f;
+		float meshletTriangleFill = 0.0f;
+	};
+
+	MeshStatistics AnalyzeMesh(const CookedMesh& _mesh, const Settings& _settings);
+
+	/// Distribution of a per-meshlet value (nearest rank percentiles).
+	struct Distribution
+	{
+		float average = 0.0f;
+		float min = 0.0f;
+		float p10 = 0.0f;
+		float p50 = 0.0f;
+		float p90 = 0.0f;
+		float max = 0.0f;
+	};
+
+	/// Packing quality of the LOD 0 meshlets of a set of submeshes.
+	struct MeshletStatistics
+	{
+		uint32_t meshletCount = 0u;
+		uint32_t triangleCount = 0u;
+
+		/// Distinct mesh vertices referenced by the meshlets.
+		uint32_t vertexCount = 0u;
+
+		/// Sum of the meshlet vertex counts: vertices transformed by the Mesh Shader.
+		uint32_t meshletVertexCount = 0u;
+
+		/// Vertex and triangle counts over Settings::maxVertices and Settings::maxTriangles: idle Mesh Shader lanes.
+		Distribution vertexFill;
+		Distribution triangleFill;
+
+		/// meshletVertexCount / vertexCount: vertices shared by several meshlets are transformed once per meshlet.
+		float vertexDuplication = 0.0f;
+
+		/// Bounding sphere volume over convex hull volume (>= 1, 1 is a perfect fit). Flat meshlets have no hull volume and are only counted.
+		Distribution sphereHullRatio;
+		uint32_t flatMeshletCount = 0u;
+
+		/// MeshletBounds::coneCutoff: the lower, the more camera positions cull the meshlet. 1: never culled.
+		Distribution coneCutoff;
+		uint32_t unculledMeshletCount = 0u;
+	};
+
+	/// LOD 0 meshlets of _submeshes (CookedMesh::submeshes range), hulls are computed on _threadCount workers (0: hardware concurrency).
+	MeshletStatistics AnalyzeMeshlets(const CookedMesh& _mesh, std::span<const Submesh> _submeshes, const Settings& _settings, uint32_t _threadCount = 0u);
+
+	struct CompactMeshletData
+	{
+		std::vector<CompactMeshlet> meshlets;
+
+		/// Padded to a multiple of 2 (uint32 reads).
+		std::vector<uint16_t> meshletVertices;
+
+		/// Padded to a multiple of 4 (uint32 reads).
+		std::vector<uint8_t> meshletTriangles;
+	};
+
+	/// Fails if the vertex indices of a meshlet span 65536 vertices or more.
+	bool EncodeCompactMeshlets(const CookedMesh& _mesh, CompactMeshletData& _out);
+
+	/// CPU reference decoder (same decoding as mainMS with USE_COMPACT_MESHLETS): outputs Uint32 encoded meshlets.
+	void DecodeCompactMeshlets(std::span<const CompactMeshlet> _meshlets, std::span<const uint16_t> _meshletVertices, std::span<const uint8_t> _meshletTriangles,
+		std::vector<Meshlet>& _outMeshlets, std::vector<uint32_t>& _outMeshletVertices, std::vector<uint32_t>& _outMeshletTriangles);
+
+	struct QuantizationError
+	{
+		/// In mesh units.
+		float maxPositionError = 0.0f;
+
+		/// In degrees.
+		float maxNormalError = 0.0f;
+		float maxTangentError = 0.0f;
+
+		float maxUVError = 0.0f;
+	};
+
+	void EncodeQuantizedVertices(std::span<const Vertex> _vertices, std::vector<QuantizedVertex>& _out, VertexQuantization& _outQuantization);
+
+	/// CPU reference decoder (same decoding as mainMS with USE_QUANTIZED_VERTICES).
+	Vertex DecodeQuantizedVertex(const QuantizedVertex& _vertex, const VertexQuantization& _quantization);
+
+	QuantizationError MeasureQuantizationError(std::span<const Vertex> _vertices, std::span<const QuantizedVertex> _quantizedVertices, const VertexQuantization& _quantization);
+
+	/// Checks that the LOD 0 meshlets contain every (non-degenerate) triangle of the index buffer exactly once.
+	bool ValidateMeshletCoverage(const CookedMesh& _mesh);
+
+	/// Imports _sourcePath and cooks all the meshes of its scene (see CookMeshes()).
+	bool CookFile(const std::string& _sourcePath, const Settings& _settings, CookedMesh& _out, uint32_t _threadCount = 0u);
+
+
+	// === Binary file ===
+
+	constexpr uint32_t fileMagic = 0x544C4D4D; // "MMLT"
+	constexpr uint32_t fileVersion = 9u;
+
+	/// Every section starts on a cache line: sections can be read in place from the mapped memory.
+	constexpr uint64_t fileSectionAlignment = 64u;
+
+	enum class Section : uint32_t
+	{
+		Vertices,
+		Indices,
+		Meshlets,
+		MeshletVertices,
+		MeshletTriangles,
+		MeshletBounds,
+		MeshletLods,
+		MeshLods,
+		Submeshes,
+
+		Count
+	};
+
+	struct FileSection
+	{
+		/// Offset in bytes from the start of the file.
+		uint64_t offset = 0u;
+
+		/// Number of elements.
+		uint64_t count = 0u;
+
+		uint32_t elementSize = 0u;
+		uint32_t pad0 = 0u;
+	};
+
+	struct FileHeader
+	{
+		uint32_t magic = fileMagic;
+		uint32_t version = fileVersion;
+
+		/// Cache keys: the file is stale if the source content or the build settings changed.
+		uint64_t sourceHash = 0u;
+		uint64_t settingsHash = 0u;
+
+		Settings settings;
+
+		/// VertexFormat::Quantized only.
+		VertexQuantization quantization;
+
+		std::array<FileSection, static_cast<size_t>(Section::Count)> sections;
+	};
+
+	bool HashSourceFile(const std::string& _path, uint64_t& _outHash);
+	uint64_t HashSettings(const Settings& _settings);
+
+	bool WriteMeshletFile(const std::string& _path, const CookedMesh& _mesh, uint64_t _sourceHash, const Settings& _settings);
+
+	/**
+	* Read-only memory-mapped meshlet file.
+	* Sections are accessed in place: the spans are valid until Close() (or destruction).
+	*/
+	class MeshletFile
+	{
+	public:
+		MeshletFile() = default;
+		MeshletFile(const MeshletFile&) = delete;
+		MeshletFile& operator=(const MeshletFile&) = delete;
+		~MeshletFile();
+
+		bool Open(const std::string& _path);
+		void Close();
+
+		bool IsOpen() const { return mappedData != nullptr; }
+
+		const FileHeader& Header() const { return *reinterpret_cast<const FileHeader*>(mappedData); }
+
+		/// VertexFormat::Float32 files only.
+		std::span<const Vertex> Vertices() const { return GetSection<Vertex>(Section::Vertices); }
+
+		/// VertexFormat::Quantized files only.
+		std::span<const QuantizedVertex> QuantizedVertices() const { return GetSection<QuantizedVertex>(Section::Vertices); }
+
+		std::span<const uint32_t> Indices() const { return GetSection<uint32_t>(Section::Indices); }
+
+		/// MeshletEncoding::Uint32 files only.
+		std::span<const Meshlet> Meshlets() const { return GetSection<Meshlet>(Section::Meshlets); }
+		std::span<const uint32_t> MeshletVertices() const { return GetSection<uint32_t>(Section::MeshletVertices); }
+		std::span<const uint32_t> MeshletTriangles() const { return GetSection<uint32_t>(Section::MeshletTriangles); }
+
+		/// MeshletEncoding::Compact files only.
+		std::span<const CompactMeshlet> CompactMeshlets() const { return GetSection<CompactMeshlet>(Section::Meshlets); }
+		std::span<const uint16_t> CompactMeshletVertices() const { return GetSection<uint16_t>(Section::MeshletVertices); }
+		std::span<const uint8_t> CompactMeshletTriangles() const { return GetSection<uint8_t>(Section::MeshletTriangles); }
+
+		std::span<const MeshletBounds> Bounds() const { return GetSection<MeshletBounds>(Section::MeshletBounds); }
+		std::span<const MeshletLod> Lods() const { return GetSection<MeshletLod>(Section::MeshletLods); }
+		std::span<const MeshLod> MeshLods() const { return GetSection<MeshLod>(Section::MeshLods); }
+		std::span<const Submesh> Submeshes() const { return GetSection<Submesh>(Section::Submeshes); }
+
+	private:
+		template <typename T>
+		std::span<const T> GetSection(Section _section) const
+		{
+			const FileSection& section = Header().sections[static_cast<size_t>(_section)];
+			return std::span<const T>(reinterpret_cast<const T*>(mappedData + section.offset), static_cast<size_t>(section.count));
+		}
+
+		/// The view keeps the file alive: native file and mapping handles are released right after mapping.
+		const uint8_t* mappedData = nullptr;
+		uint64_t mappedSize = 0u;
+	};
+
+	/// Cache file path for a source file and build settings: "<_cacheDir>/<source stem>.<canonical source path hash>.<settings hash>.meshlets".
+	std::string GetCachePath(const std::string& _sourcePath, const std::string& _cacheDir, const Settings& _settings);
+
+	/**
+	* Maps the cached meshlet file of _sourcePath.
+	* The source is (re-)cooked and the cache rewritten if the file is missing, from another version, or if its source hash or settings don't match.
+	*/
+	bool LoadOrCook(const std::string& _sourcePath, const std::string& _cacheDir, const Settings& _settings, MeshletFile& _out);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+/**
+* Meshlet limit presets: single source of truth of the meshlet sizes.
+* Preprocessor only: included by the cooker (MeshletCooker.hpp) and by the Mesh Shader (MeshLitShader.hlsl),
+* and parsed by CMake to compile one Mesh Shader permutation per preset (MSMeshLitShader_Preset<N>_Group<M>.cso, M: amplification group size).
+*
+* MESHLET_PRESET_<N>_MAX_VERTICES:  meshopt_buildMeshlets vertex limit and mainMS vertex output count (D3D12: <= 256).
+* MESHLET_PRESET_<N>_MAX_TRIANGLES: meshopt_buildMeshlets triangle limit (multiple of 4) and mainMS primitive output count (D3D12: <= 256).
+* MESHLET_PRESET_<N>_GROUP_SIZE:    mainMS thread count (D3D12: <= 128). Threads loop over the outputs when the limits are larger.
+*/
+
+#define MESHLET_PRESET_COUNT 4
+
+/// Used by the cooker tools and when the device gives no hint.
+#define MESHLET_PRESET_DEFAULT 1
+
+// 64 vertices / 84 triangles: NVIDIA recommendation (Turing mesh shaders).
+#define MESHLET_PRESET_0_MAX_VERTICES 64
+#define MESHLET_PRESET_0_MAX_TRIANGLES 84
+#define MESHLET_PRESET_0_GROUP_SIZE 96
+
+// 64 vertices / 124 triangles: closed meshes have about twice as many triangles as vertices.
+#define MESHLET_PRESET_1_MAX_VERTICES 64
+#define MESHLET_PRESET_1_MAX_TRIANGLES 124
+#define MESHLET_PRESET_1_GROUP_SIZE 128
+
+// 128 vertices / 128 triangles: one output of each per thread.
+#define MESHLET_PRESET_2_MAX_VERTICES 128
+#define MESHLET_PRESET_2_MAX_TRIANGLES 128
+#define MESHLET_PRESET_2_GROUP_SIZE 128
+
+// 128 vertices / 256 triangles: D3D12 maximum primitive count, fewer and fuller groups for wave64 hardware.
+#define MESHLET_PRESET_3_MAX_VERTICES 128
+#define MESHLET_PRESET_3_MAX_TRIANGLES 256
+#define MESHLET_PRESET_3_GROUP_SIZE 128
+
+/// MESHLET_PRESET_VALUE(1, MAX_VERTICES) -> MESHLET_PRESET_1_MAX_VERTICES (the preset argument is expanded first).
+#define MESHLET_PRESET_VALUE_IMPL(_preset, _value) MESHLET_PRESET_##_preset##_##_value
+#define MESHLET_PRESET_VALUE(_preset, _value) MESHLET_PRESET_VALUE_IMPL(_preset, _value)
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace MeshletCooker
+{
+	inline uint32_t GetDefaultThreadCount()
+	{
+		return std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	/**
+	* Runs _job(i) for each i in [0, _count) on a pool of _threadCount workers (0: hardware concurrency).
+	* Workers pull the next job index as soon as they are done: submit the largest jobs first to keep the total time close to the largest job.
+	* The calling thread is used as one of the workers.
+	*/
+	template <typename JobT>
+	void ParallelFor(size_t _count, uint32_t _threadCount, JobT&& _job)
+	{
+		if (_count == 0u)
+			return;
+
+		const size_t workerCount = std::min<size_t>(_count, _threadCount ? _threadCount : GetDefaultThreadCount());
+
+		std::atomic<size_t> nextJob = 0u;
+
+		auto worker = [&]()
+		{
+			for (size_t i = nextJob++; i < _count; i = nextJob++)
+				_job(i);
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(workerCount - 1);
+
+		for (size_t i = 1; i < workerCount; ++i)
+			threads.emplace_back(worker);
+
+		worker();
+
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+}
@@ -0,0 +1,73 @@
+#include <Renderer/DirtyInstanceTracker.hpp>
+
+#include <algorithm>
+
+namespace Renderer
+{
+	void DirtyInstanceTracker::Resize(uint32_t _instanceCount)
+	{
+		dirtyBits.assign((size_t(_instanceCount) + 63u) / 64u, 0ull);
+		dirtyIndices.clear();
+	}
+
+	void DirtyInstanceTracker::MarkDirty(uint32_t _index)
+	{
+		uint64_t& word = dirtyBits[_index >> 6u];
+		const uint64_t bit = 1ull << (_index & 63u);
+
+		if (word & bit)
+			return;
+
+		word |= bit;
+		dirtyIndices.push_back(_index);
+	}
+
+	void DirtyInstanceTracker::MarkDirty(const InstanceRange& _range)
+	{
+		for (uint32_t i = 0u; i < _range.count; ++i)
+			MarkDirty(_range.first + i);
+	}
+
+	uint32_t DirtyInstanceTracker::TakeRanges(uint32_t _maxGap, uint32_t _maxInstanceCount, std::vector<InstanceRange>& _outRanges)
+	{
+		_outRanges.clear();
+
+		// Sorting the marked instances only: the cost follows the changes, not the instance count.
+		std::sort(dirtyIndices.begin(), dirtyIndices.end());
+
+		uint32_t takenCount = 0u;
+		size_t takenIndexCount = 0u;
+
+		for (; takenIndexCount < dirtyIndices.size(); ++takenIndexCount)
+		{
+			const uint32_t index = dirtyIndices[takenIndexCount];
+
+			// Indices are unique: index is past the end of the last range.
+			if (!_outRanges.empty() && index - (_outRanges.back().first + _outRanges.back().count) <= _maxGap)
+			{
+				InstanceRange& range = _outRanges.back();
+				const uint32_t growCount = index + 1u - (range.first + range.count);
+
+				if (takenCount + growCount > _maxInstanceCount)
+					break;
+
+				range.count += growCount;
+				takenCount += growCount;
+			}
+			else
+			{
+				if (takenCount + 1u > _maxInstanceCount)
+					break;
+
+				_outRanges.push_back(InstanceRange{ index, 1u });
+				++takenCount;
+			}
+
+			dirtyBits[index >> 6u] &= ~(1ull << (index & 63u));
+		}
+
+		dirtyIndices.erase(dirtyIndices.begin(), dirtyIndices.begin() + takenIndexCount);
+
+		return takenCount;
+	}
+}
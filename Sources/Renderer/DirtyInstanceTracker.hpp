@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+* Dirty instance tracking: the renderer keeps the instance transforms on the CPU and marks the ones it changes.
+* Once per frame, the dirty instances are coalesced into ranges and only those ranges are copied to the GPU objects buffer.
+*/
+namespace Renderer
+{
+	/// Instances [first, first + count).
+	struct InstanceRange
+	{
+		uint32_t first = 0u;
+		uint32_t count = 0u;
+	};
+
+	struct DirtyInstanceTracker
+	{
+		/// 1 bit per instance: an instance is listed once in dirtyIndices however often it is marked.
+		std::vector<uint64_t> dirtyBits;
+
+		/// Marked instances, in marking order.
+		std::vector<uint32_t> dirtyIndices;
+
+		/// Clears every mark.
+		void Resize(uint32_t _instanceCount);
+
+		void MarkDirty(uint32_t _index);
+		void MarkDirty(const InstanceRange& _range);
+
+		bool IsDirty(uint32_t _index) const { return (dirtyBits[_index >> 6u] >> (_index & 63u)) & 1u; }
+		uint32_t DirtyCount() const { return static_cast<uint32_t>(dirtyIndices.size()); }
+
+		/**
+		* Sorts the dirty instances and coalesces them into ranges:
+		* ranges separated by at most _maxGap clean instances are merged (1 copy instead of 2, the clean instances are copied unchanged).
+		* The ranges are taken in instance order up to _maxInstanceCount instances (gaps included):
+		* the instances left over stay dirty for the next call.
+		* Returns the number of instances in _outRanges.
+		*/
+		uint32_t TakeRanges(uint32_t _maxGap, uint32_t _maxInstanceCount, std::vector<InstanceRange>& _outRanges);
+	};
+}
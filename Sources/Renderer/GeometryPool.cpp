@@ -0,0 +1,119 @@
+#include <Renderer/GeometryPool.hpp>
+
+/**
+* Sapphire Suite Debugger:
+* Maxime's custom Log and Assert macros for easy debug.
+*/
+#include <SA/Collections/Debug>
+
+namespace Renderer
+{
+	bool GeometryPool::Append(const MeshletCooker::MeshletFile& _file)
+	{
+		const MeshletCooker::FileHeader& header = _file.Header();
+
+		if (meshes.empty())
+		{
+			encoding = header.settings.encoding;
+			vertexFormat = header.settings.vertexFormat;
+		}
+		else if (header.settings.encoding != encoding || header.settings.vertexFormat != vertexFormat)
+		{
+			SA_LOG(L"Meshlet file encoding or vertex format differs from the geometry pool!", Error, Renderer);
+			return false;
+		}
+
+		const uint32_t vertexBase = static_cast<uint32_t>(vertexFormat == MeshletCooker::VertexFormat::Quantized ? quantizedVertices.size() : vertices.size());
+		const uint32_t indexBase = static_cast<uint32_t>(indices.size());
+		const uint32_t meshletBase = static_cast<uint32_t>(MeshletCount());
+		const uint32_t lodBase = static_cast<uint32_t>(meshLods.size());
+
+		// Vertices
+		if (vertexFormat == MeshletCooker::VertexFormat::Quantized)
+		{
+			const std::span<const MeshletCooker::QuantizedVertex> fileVertices = _file.QuantizedVertices();
+			quantizedVertices.insert(quantizedVertices.end(), fileVertices.begin(), fileVertices.end());
+		}
+		else
+		{
+			const std::span<const MeshletCooker::Vertex> fileVertices = _file.Vertices();
+			vertices.insert(vertices.end(), fileVertices.begin(), fileVertices.end());
+		}
+
+		for (uint32_t index : _file.Indices())
+			indices.push_back(vertexBase + index);
+
+		// Meshlets
+		if (encoding == MeshletCooker::MeshletEncoding::Compact)
+		{
+			const uint32_t meshletVertexBase = static_cast<uint32_t>(compactMeshletVertices.size());
+			const uint32_t meshletTriangleBase = static_cast<uint32_t>(compactMeshletTriangles.size());
+
+			// Vertex indices are relative to vertexBase and the streams are padded per file: only the meshlets are rebased.
+			for (MeshletCooker::CompactMeshlet meshlet : _file.CompactMeshlets())
+			{
+				meshlet.vertexBase += vertexBase;
+				meshlet.vertexOffset += meshletVertexBase;
+				meshlet.triangleOffset += meshletTriangleBase;
+				compactMeshlets.push_back(meshlet);
+			}
+
+			const std::span<const uint16_t> fileMeshletVertices = _file.CompactMeshletVertices();
+			compactMeshletVertices.insert(compactMeshletVertices.end(), fileMeshletVertices.begin(), fileMeshletVertices.end());
+
+			const std::span<const uint8_t> fileMeshletTriangles = _file.CompactMeshletTriangles();
+			compactMeshletTriangles.insert(compactMeshletTriangles.end(), fileMeshletTriangles.begin(), fileMeshletTriangles.end());
+		}
+		else
+		{
+			const uint32_t meshletVertexBase = static_cast<uint32_t>(meshletVertices.size());
+			const uint32_t meshletTriangleBase = static_cast<uint32_t>(meshletTriangles.size());
+
+			for (MeshletCooker::Meshlet meshlet : _file.Meshlets())
+			{
+				meshlet.vertexOffset += meshletVertexBase;
+				meshlet.triangleOffset += meshletTriangleBase;
+				meshlets.push_back(meshlet);
+			}
+
+			for (uint32_t meshletVertex : _file.MeshletVertices())
+				meshletVertices.push_back(vertexBase + meshletVertex);
+
+			// Packed triangles index the meshlet's own vertices: no rebase.
+			const std::span<const uint32_t> fileMeshletTriangles = _file.MeshletTriangles();
+			meshletTriangles.insert(meshletTriangles.end(), fileMeshletTriangles.begin(), fileMeshletTriangles.end());
+		}
+
+		const std::span<const MeshletCooker::MeshletBounds> fileBounds = _file.Bounds();
+		meshletBounds.insert(meshletBounds.end(), fileBounds.begin(), fileBounds.end());
+
+		const std::span<const MeshletCooker::MeshletLod> fileLods = _file.Lods();
+		meshletLods.insert(meshletLods.end(), fileLods.begin(), fileLods.end());
+
+		for (MeshletCooker::MeshLod lod : _file.MeshLods())
+		{
+			lod.meshletOffset += meshletBase;
+			meshLods.push_back(lod);
+		}
+
+		// 1 mesh per submesh.
+		for (MeshletCooker::Submesh submesh : _file.Submeshes())
+		{
+			submesh.vertexOffset += vertexBase;
+			submesh.indexOffset += indexBase;
+			submesh.meshletOffset += meshletBase;
+			submesh.lodOffset += lodBase;
+			submeshes.push_back(submesh);
+
+			MeshRecord& mesh = meshes.emplace_back();
+			mesh.meshletOffset = submesh.meshletOffset;
+			mesh.meshletCount = submesh.meshletCount;
+			mesh.lodOffset = submesh.lodOffset;
+			mesh.lodCount = submesh.lodCount;
+			mesh.boundingSphere = SA::Vec4f(submesh.boundsCenter, submesh.boundsRadius);
+			mesh.quantization = header.quantization;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <MeshletCooker/MeshletCooker.hpp>
+
+/**
+* Geometry pool:
+* the meshes of several cooked files suballocated in shared buffers, so that a single dispatch renders a heterogeneous scene.
+* A mesh is addressed by its ID (index in GeometryPool::meshes): instances reference it, the shaders read its MeshRecord.
+*/
+namespace Renderer
+{
+	/// Layout must match MeshRecord in MeshLitShader.hlsl.
+	struct MeshRecord
+	{
+		/// Every meshlet of the mesh in the pool meshlet buffer: LOD 0, then the cluster LOD levels and the discrete LODs.
+		uint32_t meshletOffset = 0u;
+		uint32_t meshletCount = 0u;
+
+		/// Range in GeometryPool::meshLods. LOD 0 first.
+		uint32_t lodOffset = 0u;
+		uint32_t lodCount = 0u;
+
+		/// position = boundingSphere.xyz, radius = boundingSphere.w
+		SA::Vec4f boundingSphere;
+
+		/// Quantization of the file the mesh comes from (VertexFormat::Quantized only).
+		MeshletCooker::VertexQuantization quantization;
+	};
+	static_assert(sizeof(MeshRecord) == 64, "MeshRecord must match MeshRecord in MeshLitShader.hlsl");
+
+	struct GeometryPool
+	{
+		/// Set by the first appended file: every file must match it.
+		MeshletCooker::MeshletEncoding encoding = MeshletCooker::MeshletEncoding::Uint32;
+		MeshletCooker::VertexFormat vertexFormat = MeshletCooker::VertexFormat::Float32;
+
+		/// VertexFormat::Float32 or VertexFormat::Quantized.
+		std::vector<MeshletCooker::Vertex> vertices;
+		std::vector<MeshletCooker::QuantizedVertex> quantizedVertices;
+
+		std::vector<uint32_t> indices;
+
+		/// MeshletEncoding::Uint32.
+		std::vector<MeshletCooker::Meshlet> meshlets;
+		std::vector<uint32_t> meshletVertices;
+		std::vector<uint32_t> meshletTriangles;
+
+		/// MeshletEncoding::Compact: streams stay padded per file (uint32 reads).
+		std::vector<MeshletCooker::CompactMeshlet> compactMeshlets;
+		std::vector<uint16_t> compactMeshletVertices;
+		std::vector<uint8_t> compactMeshletTriangles;
+
+		/// 1 per meshlet.
+		std::vector<MeshletCooker::MeshletBounds> meshletBounds;
+		std::vector<MeshletCooker::MeshletLod> meshletLods;
+
+		std::vector<MeshletCooker::MeshLod> meshLods;
+
+		/// Rebased submeshes: 1 per mesh, same order as meshes (index ranges for the vertex shader path).
+		std::vector<MeshletCooker::Submesh> submeshes;
+		std::vector<MeshRecord> meshes;
+
+		uint32_t MeshCount() const { return static_cast<uint32_t>(meshes.size()); }
+
+		/// Total meshlet count, every mesh and LOD included.
+		size_t MeshletCount() const { return encoding == MeshletCooker::MeshletEncoding::Compact ? compactMeshlets.size() : meshlets.size(); }
+
+		/**
+		* Appends every submesh of _file as a mesh (IDs in append order).
+		* Offsets are rebased on the pool buffers as in MeshletCooker::MergeCookedMeshes().
+		* Fails if the encoding or the vertex format differs from the previous files.
+		*/
+		bool Append(const MeshletCooker::MeshletFile& _file);
+	};
+}
@@ -0,0 +1,46 @@
+#include <Renderer/InstanceTransform.hpp>
+
+#include <cmath>
+
+namespace Renderer
+{
+	CompactInstanceTransform PackInstanceTransform(const SA::Vec3f& _position, const SA::Quatf& _rotation, float _scale)
+	{
+		const float length = std::sqrt(_rotation.w * _rotation.w + _rotation.x * _rotation.x + _rotation.y * _rotation.y + _rotation.z * _rotation.z);
+		const float invLength = length > 0.0f ? 1.0f / length : 0.0f;
+
+		CompactInstanceTransform transform;
+		transform.position = _position;
+		transform.scale = _scale;
+
+		// Degenerate quaternions fall back to the identity.
+		if (invLength > 0.0f)
+			transform.rotation = SA::Vec4f(_rotation.x * invLength, _rotation.y * invLength, _rotation.z * invLength, _rotation.w * invLength);
+
+		return transform;
+	}
+
+	SA::Mat4f ToMatrix(const CompactInstanceTransform& _transform)
+	{
+		const SA::Vec4f& q = _transform.rotation;
+		const float s = _transform.scale;
+
+		const float xx = q.x * q.x * 2.0f;
+		const float yy = q.y * q.y * 2.0f;
+		const float zz = q.z * q.z * 2.0f;
+		const float xy = q.x * q.y * 2.0f;
+		const float xz = q.x * q.z * 2.0f;
+		const float yz = q.y * q.z * 2.0f;
+		const float wx = q.w * q.x * 2.0f;
+		const float wy = q.w * q.y * 2.0f;
+		const float wz = q.w * q.z * 2.0f;
+
+		// Row major, translation in the last column.
+		return SA::Mat4f(
+			s * (1.0f - (yy + zz)),	s * (xy - wz),			s * (xz + wy),			_transform.position.x,
+			s * (xy + wz),			s * (1.0f - (xx + zz)),	s * (yz - wx),			_transform.position.y,
+			s * (xz - wy),			s * (yz + wx),			s * (1.0f - (xx + yy)),	_transform.position.z,
+			0.0f,					0.0f,					0.0f,					1.0f
+		);
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+/**
+* Sapphire Suite Maths library:
+* Maxime's custom Maths library.
+*/
+#include <SA/Collections/Maths>
+
+/**
+* Compact instance transforms: position, rotation and uniform scale in 32 bytes instead of a 64 bytes float4x4.
+* Decoded by DecodeObjectTransform() in the shaders (InstanceTransform.hlsli), ToMatrix() is the CPU reference.
+*/
+namespace Renderer
+{
+	/// Layout must match CompactObject in InstanceTransform.hlsli.
+	struct CompactInstanceTransform
+	{
+		SA::Vec3f position;
+
+		/// Uniform scale: the bounding sphere radii are multiplied by it.
+		float scale = 1.0f;
+
+		/// Unit quaternion: xyz = vector part, w = scalar part.
+		SA::Vec4f rotation = SA::Vec4f(0.0f, 0.0f, 0.0f, 1.0f);
+	};
+	static_assert(sizeof(CompactInstanceTransform) == 32, "CompactInstanceTransform must match CompactObject in InstanceTransform.hlsli");
+
+	/// _rotation is normalized: the shader decode assumes a unit quaternion.
+	CompactInstanceTransform PackInstanceTransform(const SA::Vec3f& _position, const SA::Quatf& _rotation, float _scale = 1.0f);
+
+	/// Same matrix as DecodeObjectTransform(): translation * rotation * scale.
+	SA::Mat4f ToMatrix(const CompactInstanceTransform& _transform);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+/**
+* Renderer features: single source of truth of the USE_* toggles.
+* Preprocessor only: included by the renderer (mainDX12.cpp) and by the shaders (MeshLitShader.hlsl, LitShader.hlsl),
+* so both sides derive the same feature set from the toggles below.
+*/
+
+// Mesh Shader path. The shaders select the path themselves: MeshLitShader.hlsl defines it, LitShader.hlsl (Vertex Shader path) does not.
+#ifndef __HLSL_VERSION
+#define USE_MESHSHADER
+#endif
+
+#define USE_CULLING
+#define USE_INSTANCING
+#define USE_AMPLIFICATIONSHADER
+#define USE_COMPACT_MESHLETS
+#define USE_QUANTIZED_VERTICES
+#define USE_COMPACT_INSTANCES // Position, rotation and uniform scale: 32 bytes per instance instead of 64.
+#define USE_CLUSTER_LOD
+//#define USE_DISCRETE_LOD // Alternative to USE_CLUSTER_LOD.
+#define USE_INSTANCE_CULLING
+#define USE_OCCLUSION_CULLING
+#define USE_CULLING_STATS
+#define USE_PRIMITIVE_CULLING
+#define USE_INDIRECT_DRAW
+//#define USE_MULTI_VIEW // Stereo views culled by one amplification dispatch.
+
+/// Views rendered by view instancing (multiViewCount in mainDX12.cpp).
+#define MULTI_VIEW_COUNT 2
+
+#if defined(USE_CLUSTER_LOD) && defined(USE_DISCRETE_LOD)
+#error USE_CLUSTER_LOD and USE_DISCRETE_LOD are exclusive.
+#endif
+
+// LOD selection runs in the amplification shader.
+#if !defined(USE_MESHSHADER) || !defined(USE_AMPLIFICATIONSHADER)
+#undef USE_CLUSTER_LOD
+#undef USE_DISCRETE_LOD
+#endif
+
+// Instances are culled by a compute pass before the amplification shader (mainInstanceCullingCS).
+#if !defined(USE_MESHSHADER) || !defined(USE_AMPLIFICATIONSHADER) || !defined(USE_INSTANCING) || !defined(USE_CULLING)
+#undef USE_INSTANCE_CULLING
+#endif
+
+// Every view is culled by the amplification shader (view mask in the payload) and rendered by view instancing (SV_ViewID in mainMS).
+#if !defined(USE_MESHSHADER) || !defined(USE_AMPLIFICATIONSHADER) || !defined(USE_CULLING)
+#undef USE_MULTI_VIEW
+#endif
+
+// Two-phase Hi-Z occlusion culling of the instances and their meshlets.
+// The depth pyramid and the visibility bits are built for a single view.
+#if !defined(USE_INSTANCE_CULLING) || defined(USE_MULTI_VIEW)
+#undef USE_OCCLUSION_CULLING
+#endif
+
+// Culling counters written by the amplification and mesh shaders, read back a few frames later.
+#if !defined(USE_MESHSHADER) || !defined(USE_AMPLIFICATIONSHADER)
+#undef USE_CULLING_STATS
+#endif
+
+// Per-triangle culling in mainMS: needs the screen settings of the culling constants.
+#if !defined(USE_MESHSHADER) || !defined(USE_AMPLIFICATIONSHADER) || !defined(USE_CULLING)
+#undef USE_PRIMITIVE_CULLING
+#endif
+
+// Vertex Shader path: instances culled by a compute pass and drawn by ExecuteIndirect.
+#if defined(USE_MESHSHADER) || !defined(USE_INSTANCING) || !defined(USE_CULLING)
+#undef USE_INDIRECT_DRAW
+#endif
@@ -0,0 +1,752 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+* Sapphire Suite Debugger:
+* Maxime's custom Log and Assert macros for easy debug.
+*/
+#include <SA/Collections/Debug>
+
+#include <assimp/scene.h>
+
+#include <MeshletCooker/MeshletCooker.hpp>
+#include <MeshletCooker/FrustumCulling.hpp>
+#include <MeshletCooker/ParallelFor.hpp>
+
+/**
+* CPU benchmarks.
+* Usage: FVTDX12_mainBenchmark [case] [--submeshes N] [--resolution N] [--triangles N] [--spheres N] [--threads N] [--runs N]
+*
+* Every case runs on synthetic data. Speed cases check that the optimized path matches the reference path,
+* then log the best time of each over --runs runs.
+*/
+struct BenchmarkOptions
+{
+	uint32_t submeshCount = 256u;
+
+	/// Synthetic sphere tessellation (rings and segments) of the largest submesh.
+	uint32_t resolution = 128u;
+
+	/// Triangle count of single huge mesh cases.
+	uint32_t triangleCount = 1u << 22;
+
+	/// Bounding sphere count of the culling cases.
+	uint32_t sphereCount = 1u << 22;
+
+	/// 0: hardware concurrency.
+	uint32_t threadCount = 0u;
+
+	uint32_t runCount = 5u;
+};
+
+template <typename FunctorT>
+double MeasureBestMs(uint32_t _runCount, FunctorT&& _functor)
+{
+	double bestMs = 0.0;
+
+	for (uint32_t i = 0; i < _runCount; ++i)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		_functor();
+		const auto end = std::chrono::steady_clock::now();
+
+		const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+		if (i == 0 || ms < bestMs)
+			bestMs = ms;
+	}
+
+	return bestMs;
+}
+
+template <typename T>
+bool SameElements(const std::vector<T>& _lhs, const std::vector<T>& _rhs)
+{
+	return _lhs.size() == _rhs.size() && (_lhs.empty() || std::memcmp(_lhs.data(), _rhs.data(), _lhs.size() * sizeof(T)) == 0);
+}
+
+bool SameCookedMesh(const MeshletCooker::CookedMesh& _lhs, const MeshletCooker::CookedMesh& _rhs)
+{
+	return SameElements(_lhs.vertices, _rhs.vertices) &&
+		SameElements(_lhs.indices, _rhs.indices) &&
+		SameElements(_lhs.meshlets, _rhs.meshlets) &&
+		SameElements(_lhs.meshletVertices, _rhs.meshletVertices) &&
+		SameElements(_lhs.meshletTriangles, _rhs.meshletTriangles) &&
+		SameElements(_lhs.meshletBounds, _rhs.meshletBounds) &&
+		SameElements(_lhs.meshletLods, _rhs.meshletLods) &&
+		SameElements(_lhs.meshLods, _rhs.meshLods) &&
+		SameElements(_lhs.submeshes, _rhs.submeshes);
+}
+
+
+// === Synthetic scene ===
+
+/// UV sphere with normals, tangents and uvs (assimp frees the arrays in ~aiMesh()).
+std::unique_ptr<aiMesh> CreateSphereMesh(uint32_t _rings, uint32_t _segments, const aiVector3D& _center, float _radius)
+{
+	constexpr float pi = 3.14159265358979f;
+
+	std::unique_ptr<aiMesh> mesh = std::make_unique<aiMesh>();
+
+	const uint32_t vertexCount = (_rings + 1) * (_segments + 1);
+
+	mesh->mNumVertices = vertexCount;
+	mesh->mVertices = new aiVector3D[vertexCount];
+	mesh->mNormals = new aiVector3D[vertexCount];
+	mesh->mTangents = new aiVector3D[vertexCount];
+	mesh->mBitangents = new aiVector3D[vertexCount];
+	mesh->mTextureCoords[0] = new aiVector3D[vertexCount];
+	mesh->mNumUVComponents[0] = 2u;
+
+	for (uint32_t ring = 0; ring <= _rings; ++ring)
+	{
+		const float v = static_cast<float>(ring) / _rings;
+		const float theta = v * pi;
+
+		for (uint32_t segment = 0; segment <= _segments; ++segment)
+		{
+			const float u = static_cast<float>(segment) / _segments;
+			const float phi = u * 2.0f * pi;
+
+			const aiVector3D normal(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+
+			const uint32_t index = ring * (_segments + 1) + segment;
+			mesh->mVertices[index] = aiVector3D(_center.x + normal.x * _radius, _center.y + normal.y * _radius, _center.z + normal.z * _radius);
+			mesh->mNormals[index] = normal;
+			mesh->mTangents[index] = aiVector3D(-std::sin(phi), 0.0f, std::cos(phi));
+			mesh->mBitangents[index] = aiVector3D(normal.y * std::cos(phi), -normal.x * std::cos(phi) - normal.z * std::sin(phi), normal.y * std::sin(phi));
+			mesh->mTextureCoords[0][index] = aiVector3D(u, v, 0.0f);
+		}
+	}
+
+	mesh->mNumFaces = _rings * _segments * 2;
+	mesh->mFaces = new aiFace[mesh->mNumFaces];
+
+	uint32_t faceIndex = 0u;
+
+	for (uint32_t ring = 0; ring < _rings; ++ring)
+	{
+		for (uint32_t segment = 0; segment < _segments; ++segment)
+		{
+			const uint32_t i0 = ring * (_segments + 1) + segment;
+			const uint32_t i1 = i0 + _segments + 1;
+
+			const uint32_t quad[2][3] = { { i0, i1, i0 + 1 }, { i0 + 1, i1, i1 + 1 } };
+
+			for (const uint32_t(&triangle)[3] : quad)
+			{
+				aiFace& face = mesh->mFaces[faceIndex++];
+				face.mNumIndices = 3u;
+				face.mIndices = new unsigned int[3]{ triangle[0], triangle[1], triangle[2] };
+			}
+		}
+	}
+
+	return mesh;
+}
+
+/// Shuffles the vertices and the triangles of _mesh: same surface, without any locality (like some exported or merged meshes).
+void ShuffleMesh(aiMesh& _mesh, uint32_t _seed)
+{
+	std::mt19937 random(_seed);
+
+	// Vertices: old vertex i becomes vertex remap[i].
+	std::vector<uint32_t> remap(_mesh.mNumVertices);
+	for (uint32_t i = 0; i < _mesh.mNumVertices; ++i)
+		remap[i] = i;
+
+	std::shuffle(remap.begin(), remap.end(), random);
+
+	for (aiVector3D* attribute : { _mesh.mVertices, _mesh.mNormals, _mesh.mTangents, _mesh.mBitangents, _mesh.mTextureCoords[0] })
+	{
+		const std::vector<aiVector3D> source(attribute, attribute + _mesh.mNumVertices);
+
+		for (uint32_t i = 0; i < _mesh.mNumVertices; ++i)
+			attribute[remap[i]] = source[i];
+	}
+
+	// Triangles
+	std::vector<std::array<uint32_t, 3>> triangles(_mesh.mNumFaces);
+	for (uint32_t i = 0; i < _mesh.mNumFaces; ++i)
+		triangles[i] = { remap[_mesh.mFaces[i].mIndices[0]], remap[_mesh.mFaces[i].mIndices[1]], remap[_mesh.mFaces[i].mIndices[2]] };
+
+	std::shuffle(triangles.begin(), triangles.end(), random);
+
+	for (uint32_t i = 0; i < _mesh.mNumFaces; ++i)
+		std::copy(triangles[i].begin(), triangles[i].end(), _mesh.mFaces[i].mIndices);
+}
+
+/// Multi-part model: submesh sizes range from _resolution down to 1/8 of it, like props of different sizes.
+std::vector<std::unique_ptr<aiMesh>> CreateSyntheticScene(uint32_t _submeshCount, uint32_t _resolution)
+{
+	std::vector<std::unique_ptr<aiMesh>> meshes;
+	meshes.reserve(_submeshCount);
+
+	for (uint32_t i = 0; i < _submeshCount; ++i)
+	{
+		const uint32_t resolution = std::max(4u, _resolution - (_resolution * 7 / 8) * (i % 8) / 7);
+		const aiVector3D center(static_cast<float>(i % 16) * 3.0f, static_cast<float>(i / 16) * 3.0f, 0.0f);
+
+		meshes.push_back(CreateSphereMesh(resolution, resolution, center, 1.0f));
+	}
+
+	return meshes;
+}
+
+
+// === Cases ===
+
+bool BenchmarkParallelCook(const BenchmarkOptions& _options)
+{
+	const std::vector<std::unique_ptr<aiMesh>> scene = CreateSyntheticScene(_options.submeshCount, _options.resolution);
+
+	std::vector<const aiMesh*> meshes;
+	size_t triangleCount = 0u;
+
+	for (const std::unique_ptr<aiMesh>& mesh : scene)
+	{
+		meshes.push_back(mesh.get());
+		triangleCount += mesh->mNumFaces;
+	}
+
+	const MeshletCooker::Settings settings;
+
+	MeshletCooker::CookedMesh serialMesh;
+	MeshletCooker::CookedMesh parallelMesh;
+	bool bSerialSuccess = true;
+	bool bParallelSuccess = true;
+
+	const double serialMs = MeasureBestMs(_options.runCount, [&]()
+	{
+		bSerialSuccess &= MeshletCooker::CookMeshes(meshes, settings, serialMesh, 1u);
+	});
+
+	const double parallelMs = MeasureBestMs(_options.runCount, [&]()
+	{
+		bParallelSuccess &= MeshletCooker::CookMeshes(meshes, settings, parallelMesh, _options.threadCount);
+	});
+
+	if (!bSerialSuccess || !bParallelSuccess)
+	{
+		SA_LOG(L"Cook failed!", Error, Benchmark);
+		return false;
+	}
+
+	if (!SameCookedMesh(serialMesh, parallelMesh))
+	{
+		SA_LOG(L"Parallel cook output differs from serial cook output!", Error, Benchmark);
+		return false;
+	}
+
+	const uint32_t threadCount = _options.threadCount ? _options.threadCount : MeshletCooker::GetDefaultThreadCount();
+
+	SA_LOG((L"[parallel-cook] %1 submeshes, %2 triangles, %3 meshlets.", meshes.size(), triangleCount, parallelMesh.meshlets.size()), Info, Benchmark);
+	SA_LOG((L"[parallel-cook] serial: %1 ms, parallel (%2 threads): %3 ms, speedup: x%4", serialMs, threadCount, parallelMs, serialMs / parallelMs), Info, Benchmark);
+
+	return true;
+}
+
+bool BenchmarkChunkedCook(const BenchmarkOptions& _options)
+{
+	const uint32_t resolution = std::max(4u, static_cast<uint32_t>(std::sqrt(_options.triangleCount / 2.0)));
+	const std::unique_ptr<aiMesh> mesh = CreateSphereMesh(resolution, resolution, aiVector3D(), 1.0f);
+
+	MeshletCooker::Settings serialSettings;
+	serialSettings.chunkTriangleCount = 0u;
+
+	const MeshletCooker::Settings chunkedSettings;
+
+	MeshletCooker::CookedMesh serialMesh;
+	bool bSuccess = true;
+
+	const double serialMs = MeasureBestMs(_options.runCount, [&]()
+	{
+		bSuccess &= MeshletCooker::CookMesh(*mesh, serialSettings, serialMesh, 1u);
+	});
+
+	if (!bSuccess || !MeshletCooker::ValidateMeshletCoverage(serialMesh))
+	{
+		SA_LOG(L"Serial cook failed!", Error, Benchmark);
+		return false;
+	}
+
+	SA_LOG((L"[chunked-cook] %1 triangles, %2 triangles per chunk.", mesh->mNumFaces, chunkedSettings.chunkTriangleCount), Info, Benchmark);
+	SA_LOG((L"[chunked-cook] serial: %1 ms, %2 meshlets.", serialMs, serialMesh.meshlets.size()), Info, Benchmark);
+
+	// Scaling with the core count.
+	const uint32_t maxThreadCount = _options.threadCount ? _options.threadCount : MeshletCooker::GetDefaultThreadCount();
+
+	for (uint32_t threadCount = 1u; ; threadCount = std::min(threadCount * 2u, maxThreadCount))
+	{
+		MeshletCooker::CookedMesh chunkedMesh;
+
+		const double chunkedMs = MeasureBestMs(_options.runCount, [&]()
+		{
+			bSuccess &= MeshletCooker::CookMesh(*mesh, chunkedSettings, chunkedMesh, threadCount);
+		});
+
+		// Same triangles as the serial build, each exactly once.
+		if (!bSuccess || !MeshletCooker::ValidateMeshletCoverage(chunkedMesh))
+		{
+			SA_LOG(L"Chunked cook failed!", Error, Benchmark);
+			return false;
+		}
+
+		SA_LOG((L"[chunked-cook] chunked (%1 threads): %2 ms, %3 meshlets, speedup: x%4", threadCount, chunkedMs, chunkedMesh.meshlets.size(), serialMs / chunkedMs), Info, Benchmark);
+
+		if (threadCount == maxThreadCount)
+			break;
+	}
+
+	return true;
+}
+
+/// CPU mirror of VisibleMeshletCone() in MeshLitShader.hlsl.
+bool IsMeshletBackfacing(const MeshletCooker::MeshletBounds& _bounds, const SA::Vec3f& _cameraPosition)
+{
+	const SA::Vec3f toApex = (_bounds.coneApex - _cameraPosition).GetNormalized();
+	return SA::Vec3f::Dot(toApex, _bounds.coneAxis) >= _bounds.coneCutoff;
+}
+
+bool BenchmarkConeCulling(const BenchmarkOptions& _options)
+{
+	const std::unique_ptr<aiMesh> mesh = CreateSphereMesh(_options.resolution, _options.resolution, aiVector3D(), 1.0f);
+
+	// Cameras all around the sphere.
+	std::vector<SA::Vec3f> cameraPositions;
+	for (uint32_t i = 0; i < 64u; ++i)
+	{
+		const float phi = static_cast<float>(i) * 2.39996323f; // Golden angle.
+		const float y = 1.0f - (static_cast<float>(i) + 0.5f) / 32.0f;
+		const float r = std::sqrt(1.0f - y * y);
+
+		cameraPositions.push_back(SA::Vec3f(r * std::cos(phi), y, r * std::sin(phi)) * 5.0f);
+	}
+
+	for (float coneWeight : { 0.0f, 0.25f, 0.5f })
+	{
+		MeshletCooker::Settings settings;
+		settings.coneWeight = coneWeight;
+
+		MeshletCooker::CookedMesh cookedMesh;
+		if (!MeshletCooker::CookMesh(*mesh, settings, cookedMesh))
+			return false;
+
+		size_t culledCount = 0u;
+
+		for (const SA::Vec3f& cameraPosition : cameraPositions)
+		{
+			for (const MeshletCooker::MeshletBounds& bounds : cookedMesh.meshletBounds)
+				culledCount += IsMeshletBackfacing(bounds, cameraPosition);
+		}
+
+		const double culledRatio = static_cast<double>(culledCount) / static_cast<double>(cameraPositions.size() * cookedMesh.meshletBounds.size());
+
+		SA_LOG((L"[cone-culling] cone weight %1: %2 meshlets, %3% backfacing on average.", coneWeight, cookedMesh.meshlets.size(), culledRatio * 100.0), Info, Benchmark);
+	}
+
+	return true;
+}
+
+/// CPU mirror of ProjectedLodError() in MeshLitShader.hlsl (translation only transform).
+float ProjectedLodError(const SA::Vec3f& _center, float _radius, float _error, const SA::Vec3f& _cameraPosition, float _errorScale)
+{
+	const float sphereDistance = std::max(SA::Vec3f::Dist(_center, _cameraPosition) - _radius, 1e-5f);
+	return _error * _errorScale / sphereDistance;
+}
+
+bool BenchmarkLodSelection(const BenchmarkOptions& _options)
+{
+	const std::unique_ptr<aiMesh> mesh = CreateSphereMesh(_options.resolution, _options.resolution, aiVector3D(), 1.0f);
+
+	MeshletCooker::Settings settings;
+	settings.clusterGroupSize = 4u;
+	settings.lodCount = 4u;
+
+	MeshletCooker::CookedMesh cookedMesh;
+	if (!MeshletCooker::CookMesh(*mesh, settings, cookedMesh, _options.threadCount))
+		return false;
+
+	// Renderer setup: 10 x 40 instances grid, 1200 x 900 viewport, 90 degrees fov, 1 pixel threshold.
+	constexpr float errorScale = 900.0f / (2.0f * 1.0f); // viewport height / (2 * tan(90 / 2 degrees))
+	constexpr float errorThreshold = 1.0f;
+	const SA::Vec3f cameraPosition(0.0f, 0.0f, -5.0f);
+
+	std::vector<SA::Vec3f> instancePositions;
+	for (uint32_t i = 0u; i < 10u; ++i)
+	{
+		for (uint32_t j = 0u; j < 40u; ++j)
+			instancePositions.push_back(SA::Vec3f(5.f * i, 0.f, 5.f * j));
+	}
+
+	const MeshletCooker::Submesh& submesh = cookedMesh.submeshes[0];
+	const MeshletCooker::MeshLod* const meshLods = &cookedMesh.meshLods[submesh.lodOffset];
+
+	size_t discreteMeshletCount = 0u;
+	size_t discreteTriangleCount = 0u;
+	size_t clusterMeshletCount = 0u;
+	size_t clusterTriangleCount = 0u;
+
+	for (const SA::Vec3f& instancePosition : instancePositions)
+	{
+		// CPU mirror of SelectMeshLod().
+		uint32_t selected = 0u;
+		for (uint32_t i = 1; i < submesh.lodCount; ++i)
+		{
+			if (ProjectedLodError(submesh.boundsCenter + instancePosition, submesh.boundsRadius, meshLods[i].error, cameraPosition, errorScale) <= errorThreshold)
+				selected = i;
+		}
+
+		discreteMeshletCount += meshLods[selected].meshletCount;
+		discreteTriangleCount += meshLods[selected].triangleCount;
+
+		// CPU mirror of SelectedMeshletLod().
+		for (size_t i = 0; i < cookedMesh.meshlets.size(); ++i)
+		{
+			const MeshletCooker::MeshletLod& lod = cookedMesh.meshletLods[i];
+
+			const bool bSelfPrecise = ProjectedLodError(lod.selfCenter + instancePosition, lod.selfRadius, lod.selfError, cameraPosition, errorScale) <= errorThreshold;
+			const bool bParentPrecise = ProjectedLodError(lod.parentCenter + instancePosition, lod.parentRadius, lod.parentError, cameraPosition, errorScale) <= errorThreshold;
+
+			if (bSelfPrecise && !bParentPrecise)
+			{
+				++clusterMeshletCount;
+				clusterTriangleCount += cookedMesh.meshlets[i].triangleCount;
+			}
+		}
+	}
+
+	const size_t lod0MeshletCount = instancePositions.size() * meshLods[0].meshletCount;
+	const size_t lod0TriangleCount = instancePositions.size() * meshLods[0].triangleCount;
+
+	SA_LOG((L"[lod-selection] no LOD: %1 meshlets, %2 triangles.", lod0MeshletCount, lod0TriangleCount), Info, Benchmark);
+	SA_LOG((L"[lod-selection] discrete LOD: %1 meshlets, %2 triangles.", discreteMeshletCount, discreteTriangleCount), Info, Benchmark);
+	SA_LOG((L"[lod-selection] cluster LOD: %1 meshlets, %2 triangles.", clusterMeshletCount, clusterTriangleCount), Info, Benchmark);
+
+	return true;
+}
+
+bool BenchmarkOptimize(const BenchmarkOptions& _options)
+{
+	const std::unique_ptr<aiMesh> mesh = CreateSphereMesh(_options.resolution, _options.resolution, aiVector3D(), 1.0f);
+	ShuffleMesh(*mesh, 42u);
+
+	for (const bool bOptimize : { false, true })
+	{
+		MeshletCooker::Settings settings;
+		settings.bOptimize = bOptimize;
+
+		MeshletCooker::CookedMesh cookedMesh;
+		const double cookMs = MeasureBestMs(_options.runCount, [&]()
+		{
+			MeshletCooker::CookMesh(*mesh, settings, cookedMesh, _options.threadCount);
+		});
+
+		if (!MeshletCooker::ValidateMeshletCoverage(cookedMesh))
+			return false;
+
+		const MeshletCooker::MeshStatistics statistics = MeshletCooker::AnalyzeMesh(cookedMesh, settings);
+
+		SA_LOG((L"[optimize] %1: ACMR %2, ATVR %3, overfetch %4, %5 meshlets (fill %6% vertices, %7% triangles), cook %8 ms.", std::string(bOptimize ? "optimized" : "shuffled"),
+			statistics.acmr, statistics.atvr, statistics.overfetch, cookedMesh.meshlets.size(), statistics.meshletVertexFill * 100.0f, statistics.meshletTriangleFill * 100.0f, cookMs), Info, Benchmark);
+	}
+
+	return true;
+}
+
+/// Camera at the origin looking toward +Z, 90 degrees fov, square viewport: inward plane normals like GetFrustumPlanes() in mainDX12.
+MeshletCooker::FrustumData MakeBenchmarkFrustum(float _near, float _far)
+{
+	MeshletCooker::FrustumData frustum;
+
+	const SA::Vec3f origin;
+	frustum.planes[static_cast<size_t>(MeshletCooker::FrustumPlaneId::Left)] = { SA::Vec3f(1.0f, 0.0f, 1.0f).GetNormalized(), 0.0f, origin, 0.0f };
+	frustum.planes[static_cast<size_t>(MeshletCooker::FrustumPlaneId::Right)] = { SA::Vec3f(-1.0f, 0.0f, 1.0f).GetNormalized(), 0.0f, origin, 0.0f };
+	frustum.planes[static_cast<size_t>(MeshletCooker::FrustumPlaneId::Top)] = { SA::Vec3f(0.0f, -1.0f, 1.0f).GetNormalized(), 0.0f, origin, 0.0f };
+	frustum.planes[static_cast<size_t>(MeshletCooker::FrustumPlaneId::Bottom)] = { SA::Vec3f(0.0f, 1.0f, 1.0f).GetNormalized(), 0.0f, origin, 0.0f };
+	frustum.planes[static_cast<size_t>(MeshletCooker::FrustumPlaneId::Near)] = { SA::Vec3f(0.0f, 0.0f, 1.0f), 0.0f, SA::Vec3f(0.0f, 0.0f, _near), 0.0f };
+	frustum.planes[static_cast<size_t>(MeshletCooker::FrustumPlaneId::Far)] = { SA::Vec3f(0.0f, 0.0f, -1.0f), 0.0f, SA::Vec3f(0.0f, 0.0f, _far), 0.0f };
+
+	// Sphere through the far corners, centered on the axis.
+	const float centerZ = _far * 0.5f;
+	frustum.boundingSphere = SA::Vec4f(SA::Vec3f(0.0f, 0.0f, centerZ), SA::Vec3f(_far, _far, _far - centerZ).Length());
+
+	// Cone through the far corners: half angle atan(sqrt(2)).
+	frustum.cone = { .tipPosition = origin, .height = _far, .direction = SA::Vec3f(0.0f, 0.0f, 1.0f), .angle = 2.0f * std::atan(std::sqrt(2.0f)) };
+
+	return frustum;
+}
+
+bool BenchmarkFrustumCulling(const BenchmarkOptions& _options)
+{
+	constexpr float cameraNear = 0.1f;
+	constexpr float cameraFar = 100.0f;
+
+	const MeshletCooker::FrustumData frustum = MakeBenchmarkFrustum(cameraNear, cameraFar);
+
+	// Spheres all around the camera.
+	MeshletCooker::SphereBatch spheres;
+	spheres.Resize(_options.sphereCount);
+
+	std::mt19937 rng(42u);
+	std::uniform_real_distribution<float> positionDistribution(-cameraFar, cameraFar);
+	std::uniform_real_distribution<float> radiusDistribution(0.1f, 2.0f);
+
+	for (size_t i = 0; i < spheres.Size(); ++i)
+	{
+		const SA::Vec3f center(positionDistribution(rng), positionDistribution(rng), positionDistribution(rng));
+		spheres.Set(i, center, radiusDistribution(rng));
+	}
+
+	struct CullingCase
+	{
+		std::string name;
+		MeshletCooker::FrustumCullingSettings settings;
+	};
+
+	const CullingCase cullingCases[] = {
+		{ "cone + near plane (renderer)", { .bCone = true, .bSinglePlane = true } },
+		{ "sphere", { .bSphere = true } },
+		{ "all planes", { .bAllPlanes = true } },
+	};
+
+	const MeshletCooker::CullingKernel bestKernel = MeshletCooker::GetBestCullingKernel();
+	const double sphereCount = static_cast<double>(spheres.Size());
+
+	for (const CullingCase& cullingCase : cullingCases)
+	{
+		std::vector<uint32_t> referenceVisible(spheres.Size());
+		referenceVisible.resize(MeshletCooker::CullSpheres(frustum, cullingCase.settings, spheres, 0u, spheres.Size(), referenceVisible.data(), MeshletCooker::CullingKernel::Scalar));
+
+		// Single thread throughput of every supported kernel, checked against the scalar kernel.
+		for (const MeshletCooker::CullingKernel kernel : { MeshletCooker::CullingKernel::Scalar, MeshletCooker::CullingKernel::SSE, MeshletCooker::CullingKernel::AVX2 })
+		{
+			if (static_cast<uint32_t>(kernel) > static_cast<uint32_t>(bestKernel))
+				continue;
+
+			std::vector<uint32_t> visible(spheres.Size());
+			size_t visibleCount = 0u;
+
+			const double cullMs = MeasureBestMs(_options.runCount, [&]()
+			{
+				visibleCount = MeshletCooker::CullSpheres(frustum, cullingCase.settings, spheres, 0u, spheres.Size(), visible.data(), kernel);
+			});
+
+			visible.resize(visibleCount);
+
+			if (visible != referenceVisible)
+			{
+				SA_LOG((L"[frustum-culling] %1: %2 kernel doesn't match the scalar kernel!", cullingCase.name, std::string(MeshletCooker::GetCullingKernelName(kernel))), Error, Benchmark);
+				return false;
+			}
+
+			SA_LOG((L"[frustum-culling] %1, %2: %3 ms, %4 M spheres/s per core, %5% visible.", cullingCase.name, std::string(MeshletCooker::GetCullingKernelName(kernel)),
+				cullMs, sphereCount / (cullMs * 1000.0), 100.0 * static_cast<double>(visibleCount) / sphereCount), Info, Benchmark);
+		}
+
+		// Every core: spheres split in blocks, each block compacted in its own output range.
+		{
+			constexpr size_t blockSize = 1u << 14;
+			const size_t blockCount = (spheres.Size() + blockSize - 1) / blockSize;
+			const uint32_t threadCount = _options.threadCount ? _options.threadCount : MeshletCooker::GetDefaultThreadCount();
+
+			std::vector<uint32_t> visible(spheres.Size());
+			std::vector<size_t> blockVisibleCounts(blockCount);
+
+			const double cullMs = MeasureBestMs(_options.runCount, [&]()
+			{
+				MeshletCooker::ParallelFor(blockCount, threadCount, [&](size_t _block)
+				{
+					const size_t first = _block * blockSize;
+					const size_t count = std::min(blockSize, spheres.Size() - first);
+
+					blockVisibleCounts[_block] = MeshletCooker::CullSpheres(frustum, cullingCase.settings, spheres, first, count, &visible[first], bestKernel);
+				});
+			});
+
+			size_t visibleCount = 0u;
+			for (size_t blockVisibleCount : blockVisibleCounts)
+				visibleCount += blockVisibleCount;
+
+			SA_LOG((L"[frustum-culling] %1, %2 x %3 threads: %4 ms, %5 M spheres/s, %6 M spheres/s per core.", cullingCase.name, std::string(MeshletCooker::GetCullingKernelName(bestKernel)),
+				threadCount, cullMs, sphereCount / (cullMs * 1000.0), sphereCount / (cullMs * 1000.0 * threadCount)), Info, Benchmark);
+
+			if (visibleCount != referenceVisible.size())
+			{
+				SA_LOG((L"[frustum-culling] %1: multithreaded culling doesn't match the scalar kernel!", cullingCase.name), Error, Benchmark);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+* CPU model of the mainAS payloads: one thread per (instance, meshlet) pair in dispatch order, visible pairs compacted per group.
+* Sweeps the group sizes of the Amplification Shader permutations (asGroupSizes in mainDX12.cpp).
+*/
+bool BenchmarkAmplificationGroupSize(const BenchmarkOptions& _options)
+{
+	const std::unique_ptr<aiMesh> mesh = CreateSphereMesh(_options.resolution, _options.resolution, aiVector3D(), 1.0f);
+
+	MeshletCooker::Settings settings;
+	settings.coneWeight = 0.25f;
+
+	MeshletCooker::CookedMesh cookedMesh;
+	if (!MeshletCooker::CookMesh(*mesh, settings, cookedMesh, _options.threadCount))
+		return false;
+
+	// Renderer setup: 10 x 40 instances grid in front of the camera, cone + near plane and meshlet cone tests.
+	const MeshletCooker::FrustumData frustum = MakeBenchmarkFrustum(0.1f, 50.0f);
+	const MeshletCooker::FrustumCullingSettings cullingSettings{ .bCone = true, .bSinglePlane = true };
+	const SA::Vec3f cameraPosition;
+
+	std::vector<SA::Vec3f> instancePositions;
+	for (uint32_t i = 0u; i < 10u; ++i)
+	{
+		for (uint32_t j = 0u; j < 40u; ++j)
+			instancePositions.push_back(SA::Vec3f(5.f * i - 22.5f, 0.f, 5.f * j + 2.5f));
+	}
+
+	const size_t meshletCount = cookedMesh.meshletBounds.size();
+
+	MeshletCooker::SphereBatch spheres;
+	spheres.Resize(instancePositions.size() * meshletCount);
+
+	for (size_t i = 0; i < instancePositions.size(); ++i)
+	{
+		for (size_t j = 0; j < meshletCount; ++j)
+			spheres.Set(i * meshletCount + j, cookedMesh.meshletBounds[j].center + instancePositions[i], cookedMesh.meshletBounds[j].radius);
+	}
+
+	std::vector<uint32_t> frustumVisible;
+	MeshletCooker::CullSpheres(frustum, cullingSettings, spheres, frustumVisible);
+
+	std::vector<uint8_t> visible(spheres.Size(), 0u);
+	for (uint32_t threadIndex : frustumVisible)
+	{
+		MeshletCooker::MeshletBounds bounds = cookedMesh.meshletBounds[threadIndex % meshletCount];
+		bounds.coneApex += instancePositions[threadIndex / meshletCount];
+
+		visible[threadIndex] = !IsMeshletBackfacing(bounds, cameraPosition);
+	}
+
+	for (const uint32_t groupSize : { 32u, 64u, 128u })
+	{
+		const size_t groupCount = (spheres.Size() + groupSize - 1) / groupSize;
+
+		size_t emptyGroupCount = 0u;
+		size_t visibleCount = 0u;
+
+		for (size_t group = 0; group < groupCount; ++group)
+		{
+			const size_t first = group * groupSize;
+			const size_t last = std::min(first + groupSize, spheres.Size());
+
+			size_t groupVisibleCount = 0u;
+			for (size_t i = first; i < last; ++i)
+				groupVisibleCount += visible[i];
+
+			emptyGroupCount += (groupVisibleCount == 0u);
+			visibleCount += groupVisibleCount;
+		}
+
+		// Payload of each group launching Mesh Shader groups: one packed uint per thread (two uint arrays before packing).
+		const size_t dispatchedGroupCount = groupCount - emptyGroupCount;
+		const double packedPayloadKiB = static_cast<double>(dispatchedGroupCount * groupSize * sizeof(uint32_t)) / 1024.0;
+		const double fill = dispatchedGroupCount ? static_cast<double>(visibleCount) / static_cast<double>(dispatchedGroupCount * groupSize) : 0.0;
+
+		SA_LOG((L"[as-group-size] %1 threads: %2 groups (%3 empty), %4 visible meshlets, payload fill %5%, payloads %6 KiB (%7 KiB unpacked).", groupSize, groupCount,
+			emptyGroupCount, visibleCount, fill * 100.0, packedPayloadKiB, packedPayloadKiB * 2.0), Info, Benchmark);
+	}
+
+	return true;
+}
+
+
+struct BenchmarkCase
+{
+	const char* name = nullptr;
+	bool (*run)(const BenchmarkOptions&) = nullptr;
+};
+
+constexpr BenchmarkCase benchmarkCases[] = {
+	{ "parallel-cook", &BenchmarkParallelCook },
+	{ "chunked-cook", &BenchmarkChunkedCook },
+	{ "cone-culling", &BenchmarkConeCulling },
+	{ "lod-selection", &BenchmarkLodSelection },
+	{ "optimize", &BenchmarkOptimize },
+	{ "frustum-culling", &BenchmarkFrustumCulling },
+	{ "as-group-size", &BenchmarkAmplificationGroupSize },
+};
+
+int main(int argc, char** argv)
+{
+	SA::Debug::InitDefaultLogger();
+
+	std::string caseName = "all";
+	BenchmarkOptions options;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+
+		if (arg.rfind("--", 0) != 0)
+		{
+			caseName = arg;
+			continue;
+		}
+
+		if (i + 1 >= argc)
+		{
+			SA_LOG((L"Missing value for argument {%1}", arg), Error, Benchmark);
+			return EXIT_FAILURE;
+		}
+
+		if (arg == "--submeshes")
+			options.submeshCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+		else if (arg == "--resolution")
+			options.resolution = std::max(4u, static_cast<uint32_t>(std::stoul(argv[++i])));
+		else if (arg == "--triangles")
+			options.triangleCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+		else if (arg == "--spheres")
+			options.sphereCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+		else if (arg == "--threads")
+			options.threadCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+		else if (arg == "--runs")
+			options.runCount = std::max(1u, static_cast<uint32_t>(std::stoul(argv[++i])));
+		else
+		{
+			SA_LOG((L"Unknown argument {%1}", arg), Error, Benchmark);
+			return EXIT_FAILURE;
+		}
+	}
+
+	bool bFound = false;
+	bool bSuccess = true;
+
+	for (const BenchmarkCase& benchmarkCase : benchmarkCases)
+	{
+		if (caseName != "all" && caseName != benchmarkCase.name)
+			continue;
+
+		bFound = true;
+		bSuccess &= benchmarkCase.run(options);
+	}
+
+	if (!bFound)
+	{
+		SA_LOG((L"Unknown benchmark case {%1}", caseName), Error, Benchmark);
+		return EXIT_FAILURE;
+	}
+
+	return bSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,4 +1,7 @@
 #include <array>
+#include <bit>
+#include <fstream>
+#include <stdexcept>
 
 #define NOMINMAX
 #include <algorithm>
@@ -16,11 +19,8 @@
 #include <SA/Collections/Maths>
 #include <SA/Collections/Transform>
 
-#define AS_GROUP_SIZE 32
-#define USE_CULLING
-#define USE_INSTANCING
-#define USE_AMPLIFICATIONSHADER
-#define USE_MESHSHADER
+// USE_* toggles and their derivation, shared with the shaders.
+#include "RendererFeatures.h"
 
 #ifdef USE_MESHSHADER
 #define USE_DEVICE2
@@ -79,9 +79,21 @@ extern "C" { __declspec(dllexport) extern const char* D3D12SDKPath = ".\\D3D12\\
 */
 #include <DXGIDebug.h>
 
-#ifdef USE_MESHSHADER
-	#include <meshoptimizer.h>
-#endif
+/**
+* Offline meshlet cooker:
+* Meshlets, packed triangles, bounds and vertices are cooked once and memory-mapped from a cache file.
+*/
+#include <MeshletCooker/MeshletCooker.hpp>
+#include <MeshletCooker/FrustumCulling.hpp>
+#include <MeshletCooker/CullingFlags.h>
+
+/**
+* Renderer scene library:
+* CPU-side scene data built from the cooked meshes and uploaded to the GPU.
+*/
+#include <Renderer/InstanceTransform.hpp>
+#include <Renderer/GeometryPool.hpp>
+#include <Renderer/DirtyInstanceTracker.hpp>
 
 // === Validation Layers ===
 
@@ -221,6 +233,9 @@ MComPtr<IDXGISwapChain3> swapchain; // VkSwapchainKHR -> IDXGISwapChain
 std::array<MComPtr<ID3D12Resource>, bufferingCount> swapchainImages{ nullptr }; // VkImage -> ID3D12Resource
 uint32_t swapchainFrameIndex = 0u;
 
+/// Frames recorded since launch.
+uint64_t frameNumber = 0u;
+
 /**
 * 0003.1
 * Vulkan uses Semaphores and Fences for swapchain synchronization
@@ -269,6 +284,22 @@ constexpr D3D12_CLEAR_VALUE sceneDepthClearValue{ .Format = sceneDepthFormat, .D
 MComPtr<ID3D12Resource> sceneDepthTexture; // VkImage -> ID3D12Resource
 MComPtr<ID3D12DescriptorHeap> sceneDepthRTViewHeap; /* 0006-2 */
 
+#ifdef USE_OCCLUSION_CULLING
+// = Depth Pyramid =
+/**
+* Hierarchical depth (Hi-Z) of the scene depth: each texel of a mip is the farthest depth of the texels it covers.
+* Mip 0 is the previous power of 2 of the window size, so each mip halves exactly.
+*/
+constexpr DXGI_FORMAT depthPyramidFormat = DXGI_FORMAT_R32_FLOAT;
+constexpr uint32_t depthPyramidWidth = std::bit_floor(windowSize.x);
+constexpr uint32_t depthPyramidHeight = std::bit_floor(windowSize.y);
+constexpr uint32_t depthPyramidMipCount = std::bit_width(std::max(depthPyramidWidth, depthPyramidHeight));
+MComPtr<ID3D12Resource> depthPyramidTexture;
+
+/// Scene depth SRV, depth pyramid SRV (every mip), then one SRV and one UAV per mip for the reduction.
+constexpr uint32_t depthPyramidDescriptorCount = 2u + 2u * depthPyramidMipCount;
+#endif // USE_OCCLUSION_CULLING
+
 
 // === Pipeline === /* 0008 */
 
@@ -280,6 +311,12 @@ MComPtr<ID3D12DescriptorHeap> sceneDepthRTViewHeap; /* 0006-2 */
 D3D12_VIEWPORT viewport{}; // VkViewport -> D3D12_VIEWPORT
 D3D12_RECT scissorRect{}; // VkRect2D -> D3D12_RECT
 
+#ifdef USE_MULTI_VIEW
+/// One vertical slice of viewport per view, selected by D3D12_VIEW_INSTANCE_LOCATION::ViewportArrayIndex.
+std::array<D3D12_VIEWPORT, multiViewCount> multiViewViewports{};
+std::array<D3D12_RECT, multiViewCount> multiViewScissorRects{};
+#endif // USE_MULTI_VIEW
+
 // = Lit =
 /**
 * Basic helper shader compiler header.
@@ -303,11 +340,109 @@ MComPtr<ID3DBlob> litPixelShader;
 MComPtr<ID3D12RootSignature> litRootSign; // VkPipelineLayout -> ID3D12RootSignature /* 0008-1 */
 MComPtr<ID3D12PipelineState> litPipelineState; // VkPipeline -> ID3D12PipelineState
 
+// = Instance Culling =
+#ifdef USE_INSTANCE_CULLING
+MComPtr<ID3DBlob> instanceCullingComputeShader;
+
+MComPtr<ID3D12RootSignature> instanceCullingRootSign;
+MComPtr<ID3D12PipelineState> instanceCullingPipelineState;
+
+/// DispatchMesh arguments read from visibleInstanceBuffer (ExecuteIndirect).
+MComPtr<ID3D12CommandSignature> dispatchMeshCommandSignature;
+#endif // USE_INSTANCE_CULLING
+
+// = Indirect Draw =
+#ifdef USE_INDIRECT_DRAW
+MComPtr<ID3DBlob> indirectCullingComputeShader;
+
+MComPtr<ID3D12RootSignature> indirectCullingRootSign;
+MComPtr<ID3D12PipelineState> indirectCullingPipelineState;
+
+/// DrawIndexedInstanced arguments read from indirectDrawBuffer (ExecuteIndirect).
+MComPtr<ID3D12CommandSignature> drawIndexedCommandSignature;
+
+/// Root constants of mainIndirectCullingCS (IndirectCullingConstants in LitShader.hlsl).
+struct IndirectCullingConstants
+{
+	SA::Vec4f meshBoundingSphere; // position = meshBoundingSphere.xyz, radius = meshBoundingSphere.w
+
+	uint32_t instanceCount = 0u;
+
+	/// CULLING_FLAG_* (CullingFlags.h).
+	uint32_t cullingFlags = 0u;
+
+	/// Written in IndexCountPerInstance by the culling pass.
+	uint32_t indexCount = 0u;
+};
+#endif // USE_INDIRECT_DRAW
+
+// = Depth Pyramid =
+#ifdef USE_OCCLUSION_CULLING
+MComPtr<ID3DBlob> depthPyramidComputeShader;
+
+MComPtr<ID3D12RootSignature> depthPyramidRootSign;
+MComPtr<ID3D12PipelineState> depthPyramidPipelineState;
+
+/// Must match DEPTH_PYRAMID_GROUP_SIZE in DepthPyramid.hlsl.
+constexpr UINT depthPyramidGroupSize = 8u;
+
+/// Must match CULLING_PHASE_* in MeshLitShader.hlsl.
+enum CullingPhase : uint32_t
+{
+	CULLING_PHASE_EARLY = 0,
+	CULLING_PHASE_LATE = 1,
+};
+#endif // USE_OCCLUSION_CULLING
+
+#ifdef USE_MESHSHADER
+/// Geometry pool SRVs: meshes (t14) then instance mesh IDs (t15) in the Lit and Instance Culling RootSignatures.
+#if defined(USE_OCCLUSION_CULLING)
+constexpr UINT litGeometryPoolRootIndex = 9u;
+constexpr UINT instanceCullingGeometryPoolRootIndex = 6u;
+#elif defined(USE_INSTANCE_CULLING)
+constexpr UINT litGeometryPoolRootIndex = 6u;
+constexpr UINT instanceCullingGeometryPoolRootIndex = 3u;
+#else // USE_OCCLUSION_CULLING
+constexpr UINT litGeometryPoolRootIndex = 5u;
+#endif // USE_OCCLUSION_CULLING
+#endif // USE_MESHSHADER
+
+#ifdef USE_CULLING_STATS
+/// Culling stats UAV (u2): last parameter of the Lit and Instance Culling RootSignatures.
+constexpr UINT litCullingStatsRootIndex = litGeometryPoolRootIndex + 2u;
+#ifdef USE_INSTANCE_CULLING
+constexpr UINT instanceCullingStatsRootIndex = instanceCullingGeometryPoolRootIndex + 2u;
+#endif // USE_INSTANCE_CULLING
+#endif // USE_CULLING_STATS
+
 
 // === Scene Objects === /* 0009 */
 
 MComPtr<ID3D12DescriptorHeap> pbrSphereSRVHeap;
 
+/// Point lights, PBR textures and meshlet buffers views. USE_OCCLUSION_CULLING: the depth pyramid views follow.
+#ifdef USE_MESHSHADER
+#if defined(USE_CULLING) && (defined(USE_CLUSTER_LOD) || defined(USE_DISCRETE_LOD))
+constexpr UINT pbrSphereSRVCount = 11;
+#elif defined(USE_CULLING) || defined(USE_CLUSTER_LOD) || defined(USE_DISCRETE_LOD)
+constexpr UINT pbrSphereSRVCount = 10;
+#else // USE_CULLING || USE_CLUSTER_LOD || USE_DISCRETE_LOD
+constexpr UINT pbrSphereSRVCount = 9;
+#endif // USE_CULLING || USE_CLUSTER_LOD || USE_DISCRETE_LOD
+#else // USE_MESHSHADER
+constexpr UINT pbrSphereSRVCount = 5;
+#endif // USE_MESHSHADER
+
+// = Multi View =
+#ifdef USE_MULTI_VIEW
+/**
+* Views rendered side by side in the backbuffer by view instancing (MULTI_VIEW_COUNT in RendererFeatures.h).
+* View i is rendered in the viewport i, each view is offset by multiViewSeparation along the camera right axis (stereo).
+*/
+constexpr uint32_t multiViewCount = MULTI_VIEW_COUNT;
+constexpr float multiViewSeparation = 0.065f;
+#endif // USE_MULTI_VIEW
+
 // = Scene Buffer =
 struct SceneUBO
 {
@@ -316,44 +451,164 @@ struct SceneUBO
 		SA::Mat4f view;
 		SA::Mat4f invViewProj;
 
+#if (defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)) || defined(USE_INDIRECT_DRAW)
+		/// Shared with the CPU culler (MeshletCooker::CullSpheres).
+		MeshletCooker::FrustumData frustum;
+#endif // (USE_AMPLIFICATIONSHADER && USE_CULLING) || USE_INDIRECT_DRAW
+
+	} camera;
+
+#ifdef USE_MULTI_VIEW
+	/// Rendered views (SV_ViewID): culled per view by mainAS. LOD selection stays on camera.
+	Camera views[multiViewCount];
+#endif // USE_MULTI_VIEW
+
 #if defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
-		struct FrustumData
-		{
-			struct FrustumPlane
-			{
-				SA::Vec3f normal;
-				float pad0[1]{ 0.f };
-				SA::Vec3f position;
-				float pad1[1]{ 0.f };
-			};
-			struct FrustumCone
-			{
-				SA::Vec3f tipPosition;
-				float height;
-				SA::Vec3f direction;
-				float angle;
-			};
-
-			FrustumPlane planes[6];
-			SA::Vec4f    boundingSphere; // position = boundingSphere.xyz, radius = boundingSphere.w
-			FrustumCone  cone;
-		} frustum;
+	struct ScreenSettings
+	{
+		/// Viewport size in pixels (of one view with USE_MULTI_VIEW): projected meshlet bounds to pixels.
+		SA::Vec2f viewportSize;
+
+		/// CULLING_FLAG_SMALL_MESHLET: min projected size in pixels.
+		float smallMeshletThreshold = 1.0f;
+
+		float pad0 = 0.0f;
+	} screen;
 #endif // USE_AMPLIFICATIONSHADER && USE_CULLING
 
-	} camera;
+#if defined(USE_CLUSTER_LOD) || defined(USE_DISCRETE_LOD)
+	struct LodSettings
+	{
+		/// Object space error to pixels at distance 1: viewport height / (2 * tan(fovY / 2)).
+		float errorScale = 0.0f;
+
+		/// Max projected error in pixels.
+		float errorThreshold = 1.0f;
+
+		float pad0 = 0.0f;
+		float pad1 = 0.0f;
+	} lod;
+#endif // USE_CLUSTER_LOD || USE_DISCRETE_LOD
 
 #ifdef USE_MESHSHADER
-	uint32_t meshletCount = 0u;
+	/// Meshlet chunks of the direct mainAS dispatch (meshletChunkCount).
+	uint32_t meshletChunkCount = 0u;
 
 #ifdef USE_INSTANCING
 	uint32_t instanceCount = 0u;
 
-	float pad0[2]{ 0.f, 0.f };
+	/// CULLING_FLAG_* (CullingFlags.h).
+	uint32_t cullingFlags = 0u;
+
+	/// Selected mainAS permutation (asGroupSize): mainInstanceCullingCS sizes the indirect dispatch with it.
+	uint32_t asGroupSize = 0u;
+
+	/// Meshlet index bits of the amplification payload entries (payloadMeshletIndexBits).
+	uint32_t payloadMeshletIndexBits = 0u;
 #else // USE_INSTANCING
-	float pad0[3]{ 0.f, 0.f, 0.f };
+	/// CULLING_FLAG_* (CullingFlags.h).
+	uint32_t cullingFlags = 0u;
+
+	/// Meshlet index bits of the amplification payload entries (payloadMeshletIndexBits).
+	uint32_t payloadMeshletIndexBits = 0u;
 #endif // USE_INSTANCING
 #endif // USE_MESHSHADER
 };
+
+/**
+* Culling tests (CullingFlags.h) uploaded in SceneUBO::cullingFlags every frame: no shader permutation.
+* Set by --culling and --culling-plane, toggled at runtime by the number keys (see CullingKeyCallback).
+*/
+uint32_t cullingFlags = CULLING_FLAGS_DEFAULT;
+
+/// CULLING_FLAG_SMALL_MESHLET: meshlets projected smaller than this size (in pixels) are culled. Set by --small-meshlet-threshold.
+float smallMeshletThreshold = 1.0f;
+
+struct CullingFlagName
+{
+	const char* name = nullptr;
+	uint32_t flag = 0u;
+};
+
+/// --culling names, in number key order (1 to 9).
+constexpr std::array<CullingFlagName, 9> cullingFlagNames
+{ {
+	{ "sphere",		CULLING_FLAG_FRUSTUM_SPHERE },
+	{ "cone",		CULLING_FLAG_FRUSTUM_CONE },
+	{ "plane",		CULLING_FLAG_FRUSTUM_SINGLE_PLANE },
+	{ "all-planes",	CULLING_FLAG_FRUSTUM_ALL_PLANES },
+	{ "backface",	CULLING_FLAG_MESHLET_CONE },
+	{ "instance",	CULLING_FLAG_INSTANCE },
+	{ "occlusion",	CULLING_FLAG_OCCLUSION },
+	{ "small",		CULLING_FLAG_SMALL_MESHLET },
+	{ "triangle",	CULLING_FLAG_TRIANGLE },
+} };
+
+void LogCullingFlags()
+{
+	std::string modes;
+
+	for (const CullingFlagName& flagName : cullingFlagNames)
+	{
+		if (cullingFlags & flagName.flag)
+			modes += (modes.empty() ? "" : ",") + std::string(flagName.name);
+	}
+
+	SA_LOG((L"Culling {%1} plane {%2}", modes.empty() ? "none" : modes, CULLING_FLAGS_PLANE(cullingFlags)), Info, DX12);
+}
+
+/**
+* --culling sphere,cone,plane,all-planes,backface,instance,occlusion,small,triangle (or none).
+* Keeps the selected plane. Returns false on unknown name.
+*/
+bool ParseCullingFlags(const std::string& _names)
+{
+	uint32_t flags = cullingFlags & CULLING_FLAGS_PLANE_MASK;
+
+	size_t begin = 0u;
+	while (begin <= _names.size())
+	{
+		const size_t end = std::min(_names.find(',', begin), _names.size());
+		const std::string name = _names.substr(begin, end - begin);
+
+		auto it = std::find_if(cullingFlagNames.begin(), cullingFlagNames.end(),
+			[&name](const CullingFlagName& _flagName) { return name == _flagName.name; });
+
+		if (it != cullingFlagNames.end())
+			flags |= it->flag;
+		else if (name != "none")
+		{
+			SA_LOG((L"Unknown culling mode {%1}", name), Error, DX12);
+			return false;
+		}
+
+		begin = end + 1u;
+	}
+
+	cullingFlags = flags;
+
+	return true;
+}
+
+/// 1 to 9: toggle a culling test (cullingFlagNames order), 0: disable every test.
+void CullingKeyCallback(GLFWwindow* _window, int _key, int _scancode, int _action, int _mods)
+{
+	(void)_window;
+	(void)_scancode;
+	(void)_mods;
+
+	if (_action != GLFW_PRESS)
+		return;
+
+	if (_key == GLFW_KEY_0)
+		cullingFlags &= CULLING_FLAGS_PLANE_MASK;
+	else if (_key >= GLFW_KEY_1 && _key < GLFW_KEY_1 + static_cast<int>(cullingFlagNames.size()))
+		cullingFlags ^= cullingFlagNames[_key - GLFW_KEY_1].flag;
+	else
+		return;
+
+	LogCullingFlags();
+}
 SA::TransformPRf cameraTr;
 constexpr float cameraMoveSpeed = 10.0f;
 constexpr float cameraRotSpeed = 16.0f;
@@ -656,30 +911,284 @@ void GetFrustumSphere(const SA::Mat4<T, major>& invViewProjection, SA::Vec3f& ou
 	outRadius = radius;
 }
 
+/// Fills the matrices and the culling frustum of a SceneUBO::Camera seen from _transform.
+void FillSceneCamera(SceneUBO::Camera& _outCamera, const SA::TransformPRf& _transform, float _aspect)
+{
+	const SA::Mat4f perspective = SA::Mat4f::MakePerspective(cameraFOV, _aspect, cameraNear, cameraFar);
+	const SA::Mat4f cameraTransform = _transform.Matrix();
+	const SA::Mat4f viewMatrix = cameraTransform.GetInversed();
+	const SA::Mat4f viewProjection = perspective * viewMatrix;
+	const SA::Mat4f invViewProjection = viewProjection.GetInversed();
+
+	_outCamera.view = cameraTransform;
+	_outCamera.invViewProj = viewProjection;
+
+#if (defined(USE_MESHSHADER) && defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)) || defined(USE_INDIRECT_DRAW)
+	const SA::Vec3f viewDirection = _transform.Forward().GetNormalized();
+
+	FrustumPlane planeLeft, planeRight, planeTop, planeBottom, planeNear, planeFar;
+	GetFrustumPlanes(invViewProjection, viewDirection, &planeLeft, &planeRight, &planeTop, &planeBottom, &planeNear, &planeFar);
+	_outCamera.frustum.planes[FRUSTUM_PLANE_LEFT]	= { planeLeft.normal,	0.0f, planeLeft.position,   0.0f };
+	_outCamera.frustum.planes[FRUSTUM_PLANE_RIGHT]	= { planeRight.normal,	0.0f, planeRight.position,  0.0f };
+	_outCamera.frustum.planes[FRUSTUM_PLANE_TOP]	= { planeTop.normal,	0.0f, planeTop.position,    0.0f };
+	_outCamera.frustum.planes[FRUSTUM_PLANE_BOTTOM] = { planeBottom.normal, 0.0f, planeBottom.position, 0.0f };
+	_outCamera.frustum.planes[FRUSTUM_PLANE_NEAR]	= { planeNear.normal,	0.0f, planeNear.position,   0.0f };
+	_outCamera.frustum.planes[FRUSTUM_PLANE_FAR]	= { planeFar.normal,	0.0f, planeFar.position,    0.0f };
+
+	FrustumCone cone = GetFrustumCone(invViewProjection, _transform.position, viewDirection, cameraFar, cameraFOV, true);
+
+	_outCamera.frustum.cone =
+	{
+		.tipPosition = cone.tipPosition,
+		.height = cone.height,
+		.direction = cone.direction,
+		.angle = cone.angle
+	};
+	SA::Vec3f frustumBoundingSphereCenter;
+	float frustumBoundingSphereRadius;
+	GetFrustumSphere(invViewProjection, frustumBoundingSphereCenter, frustumBoundingSphereRadius);
+
+	_outCamera.frustum.boundingSphere = SA::Vec4f(frustumBoundingSphereCenter, frustumBoundingSphereRadius);
+#endif // (USE_MESHSHADER && USE_AMPLIFICATION_SHADER && USE_CULLING) || USE_INDIRECT_DRAW
+}
+
 
 #ifdef USE_INSTANCING
-constexpr uint32_t numInstanceRowsCount = 10u;
-constexpr uint32_t numInstanceColsCount = 40u;
-constexpr uint32_t instanceCount = numInstanceRowsCount * numInstanceColsCount;
+/**
+* Instance grid, set by --instance-grid ROWSxCOLS.
+* The transforms live in a structured buffer (sphereObjectsBuffer): instanceCount is only bounded by the memory
+* and, with the amplification shader, by the payload entries (see payloadMeshletIndexBits).
+*/
+uint32_t numInstanceRowsCount = 10u;
+uint32_t numInstanceColsCount = 40u;
+
+/// Set from the generated transforms (Sphere Object Buffer).
+uint32_t instanceCount = 0u;
 #endif
 
+/**
+* Amplification payload entry split (PackPayloadEntry in MeshLitShader.hlsl): meshlet index in the low bits, instance index in the others.
+* Sized at load from the meshlet count (every LOD included): the remaining bits bound instanceCount.
+*/
+uint32_t payloadMeshletIndexBits = 1u;
+
+/// Must match AS_DISPATCH_GROUP_COUNT_X in MeshLitShader.hlsl: D3D12 limit of groups per dimension.
+constexpr uint32_t asDispatchGroupCountX = 65535u;
+
+/// D3D12 limit of mesh and amplification groups per dispatch (X * Y * Z).
+constexpr uint64_t maxDispatchMeshGroupCount = 1ull << 22u;
+
 // = Vertex Buffer =
-struct Vertex
-{
-	SA::Vec3f position;
-	SA::Vec3f normal;
-	SA::Vec3f tangent;
-	SA::Vec2f uv;
-};
+using Vertex = MeshletCooker::Vertex;
 
 // = Object Buffer =
+#ifdef USE_COMPACT_INSTANCES
+/// Decoded by LoadObject() (InstanceTransform.hlsli).
+using ObjectUBO = Renderer::CompactInstanceTransform;
+#else // USE_COMPACT_INSTANCES
 struct ObjectUBO
 {
 	SA::Mat4f transform;
 };
+#endif // USE_COMPACT_INSTANCES
 constexpr SA::Vec3f spherePosition(0.5f, 0.0f, 2.0f);
 MComPtr<ID3D12Resource> sphereObjectsBuffer;
 
+ObjectUBO MakeObjectUBO(const SA::Vec3f& _position, const SA::Quatf& _rotation = SA::Quatf(1.0f, 0.0f, 0.0f, 0.0f))
+{
+#ifdef USE_COMPACT_INSTANCES
+	return Renderer::PackInstanceTransform(_position, _rotation);
+#else // USE_COMPACT_INSTANCES
+	ObjectUBO objectUBO;
+	objectUBO.transform = Renderer::ToMatrix(Renderer::PackInstanceTransform(_position, _rotation));
+
+	return objectUBO;
+#endif // USE_COMPACT_INSTANCES
+}
+
+#ifdef USE_INSTANCING
+/// Position of the instance _index in the grid (row major).
+SA::Vec3f GetInstanceGridPosition(uint32_t _index)
+{
+	const uint32_t row = _index / numInstanceColsCount;
+	const uint32_t col = _index % numInstanceColsCount;
+
+	return spherePosition + SA::Vec3f(5.f * row, 0.f, 5.f * col);
+}
+
+/**
+* Instance transform store: CPU copy of sphereObjectsBuffer, source of every upload.
+* The changed instances are marked in sceneObjectsDirty, and only their ranges are copied to sphereObjectsBuffer by the next recorded frame.
+*/
+std::vector<ObjectUBO> sceneObjects;
+Renderer::DirtyInstanceTracker sceneObjectsDirty;
+
+/**
+* Upload ring indexed by swapchainFrameIndex, persistently mapped:
+* a slot is only rewritten once the fence of its previous frame is reached (same synchronization as sceneBuffers).
+*/
+std::array<MComPtr<ID3D12Resource>, bufferingCount> objectUploadBuffers;
+std::array<ObjectUBO*, bufferingCount> objectUploadData{ nullptr };
+
+/// Instances copied per frame at most (ring slot size): the overflow stays dirty for the next frames.
+constexpr uint32_t objectUploadMaxInstanceCount = 1u << 16u;
+uint32_t objectUploadCapacity = 0u;
+
+/// Clean instances between 2 dirty ranges are copied too, below this gap: 1 CopyBufferRegion instead of 2.
+constexpr uint32_t objectUploadMaxGap = 8u;
+
+/// Reused every frame.
+std::vector<Renderer::InstanceRange> objectUploadRanges;
+
+/// Fraction of the instances rotated every frame (--animate-instances F): a window sliding over the instances.
+float animatedInstanceFraction = 0.0f;
+uint32_t animatedInstanceCursor = 0u;
+float animationTime = 0.0f;
+#endif // USE_INSTANCING
+
+#ifdef USE_INSTANCE_CULLING
+// = Visible Instance Buffer =
+/**
+* Output of the instance culling pass (see VISIBLE_CHUNK_* in MeshLitShader.hlsl):
+* this header followed by 1 (instance index, chunk index) pair per meshlet chunk of the visible instances.
+*/
+struct VisibleInstanceHeader
+{
+	/// Read by ExecuteIndirect: rows of asDispatchGroupCountX groups.
+	D3D12_DISPATCH_MESH_ARGUMENTS dispatchArgs{ 0u, 1u, 1u };
+
+	uint32_t visibleChunkCount = 0u;
+};
+static_assert(sizeof(VisibleInstanceHeader) == 16, "VisibleInstanceHeader must match VISIBLE_CHUNK_LIST_OFFSET");
+
+MComPtr<ID3D12Resource> visibleInstanceBuffer;
+
+/// Cleared header copied to visibleInstanceBuffer before each culling pass.
+MComPtr<ID3D12Resource> visibleInstanceResetBuffer;
+#endif // USE_INSTANCE_CULLING
+
+#ifdef USE_INDIRECT_DRAW
+// = Indirect Draw Buffer =
+/**
+* Output of the indirect culling pass (see INDIRECT_DRAW_* in LitShader.hlsl):
+* this header followed by the indices of the visible instances.
+*/
+struct IndirectDrawHeader
+{
+	/// Read by ExecuteIndirect: InstanceCount is the visible instance count.
+	D3D12_DRAW_INDEXED_ARGUMENTS drawArgs{ 0u, 0u, 0u, 0, 0u };
+
+	uint32_t pad0[3]{ 0u, 0u, 0u };
+};
+static_assert(sizeof(IndirectDrawHeader) == 32, "IndirectDrawHeader must match INDIRECT_DRAW_LIST_OFFSET");
+
+MComPtr<ID3D12Resource> indirectDrawBuffer;
+
+/// Cleared header copied to indirectDrawBuffer before each culling pass.
+MComPtr<ID3D12Resource> indirectDrawResetBuffer;
+#endif // USE_INDIRECT_DRAW
+
+#ifdef USE_OCCLUSION_CULLING
+// = Visibility Bits Buffer =
+/**
+* Persistent visibility across frames: 1 bit per instance, then 1 bit per (instance, meshlet) pair (see MESHLET_VISIBILITY_BIT_OFFSET).
+* Written by the late culling phase, read by the early phase of the next frame.
+*/
+MComPtr<ID3D12Resource> visibilityBitsBuffer;
+#endif // USE_OCCLUSION_CULLING
+
+#ifdef USE_CULLING_STATS
+// = Culling Stats Buffers =
+/// Must match CULLING_STATS_* in MeshLitShader.hlsl. Summed over both phases with USE_OCCLUSION_CULLING.
+struct CullingStats
+{
+	/// mainInstanceCullingCS.
+	uint32_t instancesTested = 0u;
+	uint32_t instancesVisible = 0u;
+
+	/// mainAS: dispatched (instance, meshlet) pairs and meshlets sent to mainMS.
+	uint32_t meshletsTested = 0u;
+	uint32_t meshletsVisible = 0u;
+
+	/// mainMS: SetMeshOutputCounts primitive counts.
+	uint32_t trianglesEmitted = 0u;
+
+	/// mainAS: meshlets rejected by CULLING_FLAG_SMALL_MESHLET only.
+	uint32_t smallMeshletsCulled = 0u;
+
+	/// mainMS: emitted triangles marked SV_CullPrimitive (CULLING_FLAG_TRIANGLE).
+	uint32_t trianglesCulled = 0u;
+
+	uint32_t pad0[1]{ 0u };
+};
+
+/// Counters of the frame being recorded, cleared at the start of the command list.
+MComPtr<ID3D12Resource> cullingStatsBuffer;
+
+/// Zeros copied to cullingStatsBuffer.
+MComPtr<ID3D12Resource> cullingStatsResetBuffer;
+
+/**
+* Readback ring indexed by swapchainFrameIndex: the slot is read when the frame is reused,
+* after the swapchain fence wait that is already required to reuse its command allocator (never an extra wait).
+*/
+std::array<MComPtr<ID3D12Resource>, bufferingCount> cullingStatsReadbackBuffers;
+
+/// Frame number written in each readback slot (0: never written).
+std::array<uint64_t, bufferingCount> cullingStatsReadbackFrames{ 0u };
+
+/// Last read back counters and the frame they come from.
+CullingStats cullingStats;
+uint64_t cullingStatsFrame = 0u;
+
+/// Frames between two culling stats logs and window title updates (glfwSetWindowTitle is a synchronous round-trip to the window).
+constexpr uint64_t cullingStatsLogPeriod = 120u;
+
+/// --culling-stats <file>: one CSV line per read back frame.
+std::ofstream cullingStatsCSV;
+
+/// Reads the slot of the frame about to be recorded: its previous use is complete once its swapchain fence value is reached.
+void ReadCullingStats(uint32_t _frameIndex)
+{
+	if (cullingStatsReadbackFrames[_frameIndex] == 0u)
+		return;
+
+	const D3D12_RANGE readRange{ .Begin = 0, .End = sizeof(CullingStats) };
+	void* data = nullptr;
+
+	cullingStatsReadbackBuffers[_frameIndex]->Map(0, &readRange, reinterpret_cast<void**>(&data));
+	std::memcpy(&cullingStats, data, sizeof(CullingStats));
+
+	// Nothing written by the CPU.
+	const D3D12_RANGE writeRange{ .Begin = 0, .End = 0 };
+	cullingStatsReadbackBuffers[_frameIndex]->Unmap(0, &writeRange);
+
+	cullingStatsFrame = cullingStatsReadbackFrames[_frameIndex];
+	cullingStatsReadbackFrames[_frameIndex] = 0u;
+
+	if (cullingStatsFrame % cullingStatsLogPeriod == 0u)
+	{
+		// Window title
+		const std::string title = "FVTDX12_DX12-Window | instances " + std::to_string(cullingStats.instancesVisible) + "/" + std::to_string(cullingStats.instancesTested) +
+			" | meshlets " + std::to_string(cullingStats.meshletsVisible) + "/" + std::to_string(cullingStats.meshletsTested) +
+			" (small " + std::to_string(cullingStats.smallMeshletsCulled) + ") | triangles " + std::to_string(cullingStats.trianglesEmitted - cullingStats.trianglesCulled) +
+			"/" + std::to_string(cullingStats.trianglesEmitted);
+		glfwSetWindowTitle(window, title.c_str());
+
+		SA_LOG((L"Culling stats frame {%1}: instances %2/%3, meshlets %4/%5 (small %6), triangles %7/%8", cullingStatsFrame,
+			cullingStats.instancesVisible, cullingStats.instancesTested, cullingStats.meshletsVisible, cullingStats.meshletsTested,
+			cullingStats.smallMeshletsCulled, cullingStats.trianglesEmitted - cullingStats.trianglesCulled, cullingStats.trianglesEmitted), Info, DX12);
+	}
+
+	if (cullingStatsCSV.is_open())
+	{
+		cullingStatsCSV << cullingStatsFrame << ',' << cullingFlags << ',' << cullingStats.instancesTested << ',' << cullingStats.instancesVisible << ',' <<
+			cullingStats.meshletsTested << ',' << cullingStats.meshletsVisible << ',' << cullingStats.smallMeshletsCulled << ',' <<
+			cullingStats.trianglesEmitted << ',' << cullingStats.trianglesCulled << '\n';
+	}
+}
+#endif // USE_CULLING_STATS
+
 // = PointLights Buffer =
 struct PointLightUBO
 {
@@ -697,10 +1206,6 @@ MComPtr<ID3D12Resource> pointLightBuffer;
 
 // === Resources === /* 0010 */
 
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
-#include <assimp/postprocess.h>
-
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
@@ -955,20 +1460,146 @@ void GenerateMipMapsCPU(SA::Vec2ui _extent, std::vector<char>& _data, uint32_t&
 }
 
 // = Sphere =
-std::array<MComPtr<ID3D12Resource>, 4> sphereVertexBuffers; // VkBuffer -> ID3D12Resource
+constexpr const char* meshletCacheDir = "Resources/Cache/Meshlets";
+
+/// Models appended to the geometry pool, mesh IDs in this order (1 per submesh). The vertex shader path draws mesh 0.
+constexpr std::array<const char*, 2> meshPaths = {
+	"Resources/Models/Shapes/sphere.obj",
+	"Resources/Models/Shapes/cube.obj",
+};
+
+/**
+* Meshlet limits preset (MeshletLimits.h): selected at device creation, overridden by --meshlet-preset N.
+* Drives both the cook settings (maxVertices, maxTriangles) and the loaded Mesh Shader permutation.
+*/
+uint32_t meshletPresetIndex = MeshletCooker::defaultMeshletPreset;
+bool bMeshletPresetOverride = false;
+
+/**
+* D3D12 reports no preferred meshlet size (unlike VkPhysicalDeviceMeshShaderPropertiesEXT):
+* heuristic on the adapter vendor and the reported wave size.
+*/
+uint32_t SelectMeshletPreset(UINT _vendorId, UINT _waveLaneCountMax)
+{
+	constexpr UINT nvidiaVendorId = 0x10DE;
+
+	// 64 vertices / 84 triangles.
+	if (_vendorId == nvidiaVendorId)
+		return 0u;
+
+	// 128 vertices / 256 triangles: fill wave64.
+	if (_waveLaneCountMax >= 64u)
+		return 3u;
+
+	return MeshletCooker::defaultMeshletPreset;
+}
+
+/**
+* Amplification Shader group size: one mainAS permutation per size (ASMeshLitShader_Group<N>.cso, see CMakeLists.txt).
+* The Payload layout depends on it: mainMS has one permutation per (meshlet preset, group size) pair.
+* Selected at device creation, overridden by --as-group-size N.
+*/
+constexpr std::array<uint32_t, 3> asGroupSizes = { 32u, 64u, 128u };
+uint32_t asGroupSize = asGroupSizes[0];
+bool bAsGroupSizeOverride = false;
+
+/**
+* One wave per group: the payload is compacted by wave intrinsics only.
+* mainAS falls back to a groupshared prefix when the group spans several waves (smaller or variable wave size).
+*/
+uint32_t SelectAsGroupSize(UINT _waveLaneCountMax)
+{
+	for (uint32_t groupSize : asGroupSizes)
+	{
+		if (groupSize >= _waveLaneCountMax)
+			return groupSize;
+	}
+
+	return asGroupSizes.back();
+}
+
+MeshletCooker::Settings meshletCookSettings{
+	/// Overwritten by the selected meshlet preset.
+	.maxVertices = MeshletCooker::meshletPresets[MeshletCooker::defaultMeshletPreset].maxVertices,
+	.maxTriangles = MeshletCooker::meshletPresets[MeshletCooker::defaultMeshletPreset].maxTriangles,
+
+	/// Tighter normal cones: more meshlets rejected by the amplification shader backface test.
+	.coneWeight = 0.25f,
+
+#ifdef USE_COMPACT_MESHLETS
+	.encoding = MeshletCooker::MeshletEncoding::Compact,
+#else
+	.encoding = MeshletCooker::MeshletEncoding::Uint32,
+#endif
+
+	// The Vertex Shader path reads float vertices through the Input Assembler.
+#if defined(USE_MESHSHADER) && defined(USE_QUANTIZED_VERTICES)
+	.vertexFormat = MeshletCooker::VertexFormat::Quantized,
+#else
+	.vertexFormat = MeshletCooker::VertexFormat::Float32,
+#endif
+
+	// Without LOD selection every level would be drawn on top of each other.
+#ifdef USE_CLUSTER_LOD
+	.clusterGroupSize = 4u,
+#else
+	.clusterGroupSize = 0u,
+#endif
+
+	/// 100%, 50%, 25% and 12.5% of the triangles.
+#ifdef USE_DISCRETE_LOD
+	.lodCount = 4u,
+#else
+	.lodCount = 0u,
+#endif
+
+	/// Vertex cache, vertex fetch and spatial order: the Vertex Shader path draws the same optimized index buffer.
+	.bOptimize = true,
+};
+
+MComPtr<ID3D12Resource> sphereVertexBuffer; // VkBuffer -> ID3D12Resource
 /**
 * Vulkan binds the buffer directly
 * DirectX12 create 'views' (aka. how to read the memory) of buffers and use them for binding.
+* 1 view per vertex attribute (position, normal, tangent, uv) in the interleaved vertex buffer.
 */
 std::array<D3D12_VERTEX_BUFFER_VIEW, 4> sphereVertexBufferViews;
 #ifdef USE_MESHSHADER
-size_t meshletCount = 0u;
+/// Consecutive meshlets of one instance dispatched together by mainAS. Must match MESHLET_CHUNK_SIZE in MeshLitShader.hlsl.
+constexpr uint32_t meshletChunkSize = 32u;
+
+/// Mesh of an instance. Must match InstanceMesh in MeshLitShader.hlsl.
+struct InstanceMesh
+{
+	uint32_t meshId = 0u;
+
+	/// First meshlet chunk of the instance: sum of the chunk counts of the previous instances.
+	uint32_t chunkOffset = 0u;
+};
+
+/// Meshlet chunks of every instance (mesh 0 only without USE_INSTANCING): direct mainAS dispatch and visibility bits.
+uint32_t meshletChunkCount = 0u;
+
+/// Meshlets of mesh 0 (LOD 0 only with USE_DISCRETE_LOD): Mesh Shader dispatch without amplification shader.
+uint32_t meshletCount = 0u;
 MComPtr<ID3D12Resource> meshletBuffer; // VkBuffer -> ID3D12Resource
 MComPtr<ID3D12Resource> meshletVerticesBuffer; // VkBuffer -> ID3D12Resource
 MComPtr<ID3D12Resource> meshletTrianglesBuffer; // VkBuffer -> ID3D12Resource
 #ifdef USE_CULLING
 MComPtr<ID3D12Resource> meshletBoundsBuffer; // VkBuffer -> ID3D12Resource
 #endif
+#ifdef USE_CLUSTER_LOD
+MComPtr<ID3D12Resource> meshletLodBuffer; // VkBuffer -> ID3D12Resource
+#endif
+#ifdef USE_DISCRETE_LOD
+MComPtr<ID3D12Resource> meshLodBuffer; // VkBuffer -> ID3D12Resource
+#endif
+/// Geometry pool meshes (Renderer::MeshRecord, root SRV t14), indexed by the InstanceMesh of each instance (root SRV t15).
+MComPtr<ID3D12Resource> meshRecordBuffer;
+MComPtr<ID3D12Resource> instanceMeshBuffer;
+#endif
+#ifdef USE_INDIRECT_DRAW
+SA::Vec4f sphereBoundingSphere;
 #endif
 uint32_t sphereIndexCount = 0u;
 MComPtr<ID3D12Resource> sphereIndexBuffer;
@@ -982,33 +1613,155 @@ MComPtr<ID3D12Resource> rustedIron2RoughnessTexture;
 
 
 
-int main()
+int main(int argc, char** argv)
 {
 	// Initialization
 	if (true)
 	{
 		SA::Debug::InitDefaultLogger();
 
-		// GLFW
+		// Command line
 		{
-			glfwSetErrorCallback(GLFWErrorCallback);
-			glfwInit();
-
-			glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-			window = glfwCreateWindow(windowSize.x, windowSize.y, "FVTDX12_DX12-Window", nullptr, nullptr);
-
-			if (!window)
-			{
-				SA_LOG(L"GLFW create window failed!", Error, GLFW);
-				return EXIT_FAILURE;
-			}
-			else
+			// std::stoul and std::stof throw on non-numeric or out of range values.
+			int i = 1;
+			try
 			{
-				SA_LOG("GLFW create window success.", Info, GLFW, window);
-			}
+				for (; i < argc; ++i)
+				{
+					const std::string arg = argv[i];
 
-			glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
-		}
+					if (arg == "--meshlet-preset" && i + 1 < argc)
+					{
+						meshletPresetIndex = static_cast<uint32_t>(std::stoul(argv[++i]));
+						bMeshletPresetOverride = true;
+
+						if (meshletPresetIndex >= MeshletCooker::meshletPresets.size())
+						{
+							SA_LOG((L"Unknown meshlet preset {%1}", meshletPresetIndex), Error, MeshletCooker);
+							return EXIT_FAILURE;
+						}
+					}
+					else if (arg == "--as-group-size" && i + 1 < argc)
+					{
+						asGroupSize = static_cast<uint32_t>(std::stoul(argv[++i]));
+						bAsGroupSizeOverride = true;
+
+						if (std::find(asGroupSizes.begin(), asGroupSizes.end(), asGroupSize) == asGroupSizes.end())
+						{
+							SA_LOG((L"Unsupported amplification group size {%1}", asGroupSize), Error, DX12);
+							return EXIT_FAILURE;
+						}
+					}
+		#ifdef USE_INSTANCING
+					else if (arg == "--instance-grid" && i + 1 < argc)
+					{
+						// ROWSxCOLS
+						const std::string grid = argv[++i];
+						const size_t separator = grid.find('x');
+
+						if (separator == std::string::npos ||
+							(numInstanceRowsCount = static_cast<uint32_t>(std::stoul(grid.substr(0, separator)))) == 0u ||
+							(numInstanceColsCount = static_cast<uint32_t>(std::stoul(grid.substr(separator + 1)))) == 0u)
+						{
+							SA_LOG((L"Invalid instance grid {%1}", grid), Error, DX12);
+							return EXIT_FAILURE;
+						}
+					}
+					else if (arg == "--animate-instances" && i + 1 < argc)
+					{
+						animatedInstanceFraction = std::stof(argv[++i]);
+
+						if (animatedInstanceFraction < 0.0f || animatedInstanceFraction > 1.0f)
+						{
+							SA_LOG((L"Invalid animated instance fraction {%1}", animatedInstanceFraction), Error, DX12);
+							return EXIT_FAILURE;
+						}
+					}
+		#endif // USE_INSTANCING
+					else if (arg == "--culling" && i + 1 < argc)
+					{
+						if (!ParseCullingFlags(argv[++i]))
+							return EXIT_FAILURE;
+					}
+					else if (arg == "--culling-plane" && i + 1 < argc)
+					{
+						const uint32_t plane = static_cast<uint32_t>(std::stoul(argv[++i]));
+
+						if (plane > FRUSTUM_PLANE_FAR)
+						{
+							SA_LOG((L"Unknown frustum plane {%1}", plane), Error, DX12);
+							return EXIT_FAILURE;
+						}
+
+						cullingFlags = (cullingFlags & ~CULLING_FLAGS_PLANE_MASK) | (plane << CULLING_FLAGS_PLANE_SHIFT);
+					}
+					else if (arg == "--small-meshlet-threshold" && i + 1 < argc)
+					{
+						smallMeshletThreshold = std::stof(argv[++i]);
+
+						if (smallMeshletThreshold < 0.0f)
+						{
+							SA_LOG((L"Invalid small meshlet threshold {%1}", smallMeshletThreshold), Error, DX12);
+							return EXIT_FAILURE;
+						}
+					}
+		#ifdef USE_CULLING_STATS
+					else if (arg == "--culling-stats" && i + 1 < argc)
+					{
+						const std::string path = argv[++i];
+
+						cullingStatsCSV.open(path, std::ios::out | std::ios::trunc);
+
+						if (!cullingStatsCSV.is_open())
+						{
+							SA_LOG((L"Open culling stats file {%1} failed!", path), Error, DX12);
+							return EXIT_FAILURE;
+						}
+
+						cullingStatsCSV << "frame,cullingFlags,instancesTested,instancesVisible,meshletsTested,meshletsVisible,smallMeshletsCulled,trianglesEmitted,trianglesCulled\n";
+					}
+		#endif // USE_CULLING_STATS
+					else
+					{
+						SA_LOG((L"Unknown argument {%1}", arg), Warning, DX12);
+					}
+				}
+			}
+			catch (const std::invalid_argument&)
+			{
+				SA_LOG((L"Invalid value {%1} for argument {%2}", argv[i], argv[i - 1]), Error, DX12);
+				return EXIT_FAILURE;
+			}
+			catch (const std::out_of_range&)
+			{
+				SA_LOG((L"Out of range value {%1} for argument {%2}", argv[i], argv[i - 1]), Error, DX12);
+				return EXIT_FAILURE;
+			}
+		}
+
+		// GLFW
+		{
+			glfwSetErrorCallback(GLFWErrorCallback);
+			glfwInit();
+
+			glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+			window = glfwCreateWindow(windowSize.x, windowSize.y, "FVTDX12_DX12-Window", nullptr, nullptr);
+
+			if (!window)
+			{
+				SA_LOG(L"GLFW create window failed!", Error, GLFW);
+				return EXIT_FAILURE;
+			}
+			else
+			{
+				SA_LOG("GLFW create window success.", Info, GLFW, window);
+			}
+
+			glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+			glfwSetKeyCallback(window, CullingKeyCallback);
+
+			LogCullingFlags();
+		}
 
 
 		// Renderer
@@ -1115,8 +1868,45 @@ int main()
 
 					return EXIT_FAILURE;
 				}
+
+#ifdef USE_MULTI_VIEW
+				D3D12_FEATURE_DATA_D3D12_OPTIONS3 options3 = {};
+				const HRESULT hrViewInstancingSupport = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS3, &options3, sizeof(options3));
+
+				if (FAILED(hrViewInstancingSupport) || options3.ViewInstancingTier == D3D12_VIEW_INSTANCING_TIER_NOT_SUPPORTED)
+				{
+					SA_LOG(L"View instancing not supported (USE_MULTI_VIEW)", Error, DX12, (L"Error Code: %1", hrViewInstancingSupport));
+
+					return EXIT_FAILURE;
+				}
+#endif // USE_MULTI_VIEW
+
+				// Meshlet preset and amplification group size
+				{
+					DXGI_ADAPTER_DESC1 adapterDesc = {};
+					adapter->GetDesc1(&adapterDesc);
+
+					// Wave size stays unknown (0) if the query fails: vendor only, smallest group.
+					D3D12_FEATURE_DATA_D3D12_OPTIONS1 options1 = {};
+					device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS1, &options1, sizeof(options1));
+
+					if (!bMeshletPresetOverride)
+						meshletPresetIndex = SelectMeshletPreset(adapterDesc.VendorId, options1.WaveLaneCountMax);
+
+					if (!bAsGroupSizeOverride)
+						asGroupSize = SelectAsGroupSize(options1.WaveLaneCountMax);
+
+					SA_LOG((L"Amplification Shader group size %1 (wave size %2 to %3).", asGroupSize, options1.WaveLaneCountMin, options1.WaveLaneCountMax), Info, DX12);
+				}
 #endif
 
+				const MeshletCooker::MeshletPreset& meshletPreset = MeshletCooker::meshletPresets[meshletPresetIndex];
+				meshletCookSettings.maxVertices = meshletPreset.maxVertices;
+				meshletCookSettings.maxTriangles = meshletPreset.maxTriangles;
+
+				SA_LOG((L"Meshlet preset %1: %2 vertices, %3 triangles, %4 Mesh Shader threads.", meshletPresetIndex,
+					meshletPreset.maxVertices, meshletPreset.maxTriangles, meshletPreset.groupSize), Info, DX12);
+
 #if SA_DEBUG
 				// Validation Layers (device-level) /* 0002-1 */
 				{
@@ -1383,7 +2173,12 @@ int main()
 						.Height = windowSize.y,
 						.DepthOrArraySize = 1,
 						.MipLevels = 1,
+#ifdef USE_OCCLUSION_CULLING
+						// Also read as R16_UNORM by the depth pyramid reduction.
+						.Format = DXGI_FORMAT_R16_TYPELESS,
+#else
 						.Format = sceneDepthFormat,
+#endif
 						.SampleDesc = DXGI_SAMPLE_DESC{
 							.Count = 1,
 							.Quality = 0,
@@ -1415,6 +2210,50 @@ int main()
 					}
 				}
 
+#ifdef USE_OCCLUSION_CULLING
+				// Depth Pyramid Texture
+				{
+					const D3D12_RESOURCE_DESC desc{
+						.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+						.Alignment = 0u,
+						.Width = depthPyramidWidth,
+						.Height = depthPyramidHeight,
+						.DepthOrArraySize = 1,
+						.MipLevels = depthPyramidMipCount,
+						.Format = depthPyramidFormat,
+						.SampleDesc = DXGI_SAMPLE_DESC{
+							.Count = 1,
+							.Quality = 0,
+						},
+						.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
+						.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS,
+					};
+
+					const D3D12_HEAP_PROPERTIES heap{
+						.Type = D3D12_HEAP_TYPE_DEFAULT,
+						.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
+						.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN,
+						.CreationNodeMask = 1,
+						.VisibleNodeMask = 1,
+					};
+
+					// Kept in NON_PIXEL_SHADER_RESOURCE between two reductions.
+					const HRESULT hrCreatePyramidTexture = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, nullptr, IID_PPV_ARGS(&depthPyramidTexture));
+					if (FAILED(hrCreatePyramidTexture))
+					{
+						SA_LOG(L"Create Depth Pyramid Texture failed!", Error, DX12, (L"Error Code: %1", hrCreatePyramidTexture));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						const LPCWSTR name = L"DepthPyramidTexture";
+						depthPyramidTexture->SetName(name);
+
+						SA_LOG(L"Create Depth Pyramid Texture success.", Info, DX12, (L"\"%1\" [%2]", name, depthPyramidTexture.Get()));
+					}
+				}
+#endif // USE_OCCLUSION_CULLING
+
 				// Depth Scene RT View Heap /* 0006-I2 */
 				{
 					/**
@@ -1444,7 +2283,21 @@ int main()
 					/**
 					* Create Depth View to use sceneDepthTexture as a render target.
 					*/
+#ifdef USE_OCCLUSION_CULLING
+					// Typeless resource: the view format must be explicit.
+					const D3D12_DEPTH_STENCIL_VIEW_DESC viewDesc{
+						.Format = sceneDepthFormat,
+						.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D,
+						.Flags = D3D12_DSV_FLAG_NONE,
+						.Texture2D{
+							.MipSlice = 0,
+						},
+					};
+					device->CreateDepthStencilView(sceneDepthTexture.Get(), &viewDesc, sceneDepthRTViewHeap->GetCPUDescriptorHandleForHeapStart());
+#else
 					device->CreateDepthStencilView(sceneDepthTexture.Get(), nullptr, sceneDepthRTViewHeap->GetCPUDescriptorHandleForHeapStart());
+#endif
+
 				}
 			}
 
@@ -1469,6 +2322,22 @@ int main()
 						.right = static_cast<LONG>(windowSize.x),
 						.bottom = static_cast<LONG>(windowSize.y),
 					};
+
+#ifdef USE_MULTI_VIEW
+					for (uint32_t i = 0; i < multiViewCount; ++i)
+					{
+						const uint32_t left = windowSize.x * i / multiViewCount;
+						const uint32_t right = windowSize.x * (i + 1u) / multiViewCount;
+
+						multiViewViewports[i] = viewport;
+						multiViewViewports[i].TopLeftX = float(left);
+						multiViewViewports[i].Width = float(right - left);
+
+						multiViewScissorRects[i] = scissorRect;
+						multiViewScissorRects[i].left = static_cast<LONG>(left);
+						multiViewScissorRects[i].right = static_cast<LONG>(right);
+					}
+#endif // USE_MULTI_VIEW
 				}
 
 				// Lit
@@ -1577,11 +2446,34 @@ int main()
 								.RegisterSpace = 0,
 								.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DESCRIPTORS_VOLATILE,
 								.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
-							}
+							},
 #endif // USE_CULLING
+#if defined(USE_CLUSTER_LOD) || defined(USE_DISCRETE_LOD)
+							// Cluster LODs or mesh LODs
+							{
+								.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
+								.NumDescriptors = 1,
+								.BaseShaderRegister = 10,
+								.RegisterSpace = 0,
+								.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DESCRIPTORS_VOLATILE,
+								.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
+							},
+#endif // USE_CLUSTER_LOD || USE_DISCRETE_LOD
 						};
 
 #endif // USE_MESHSHADER
+#ifdef USE_OCCLUSION_CULLING
+						// Rewritten between the two culling phases.
+						const D3D12_DESCRIPTOR_RANGE1 depthPyramidSRVRange{
+							.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
+							.NumDescriptors = 1,
+							.BaseShaderRegister = 12,
+							.RegisterSpace = 0,
+							.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DATA_VOLATILE,
+							.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
+						};
+
+#endif // USE_OCCLUSION_CULLING
 						const D3D12_ROOT_PARAMETER1 params[]{
 							// Scene Constant buffer
 							{
@@ -1597,22 +2489,23 @@ int main()
 								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
 #endif
 							},
-							// Object Constant buffer
+							// Objects structured buffer
 							{
-								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV,
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
 								.Descriptor = {
-									.ShaderRegister = 1,
+									.ShaderRegister = 13,
 									.RegisterSpace = 0,
 									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
 								},
 #ifndef USE_MESHSHADER
 								.ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX,
 #else // USE_MESHSHADER
-#ifndef USE_CULLING
+								// Read by the amplification shader for culling and LOD selection.
+#if !defined(USE_CULLING) && !defined(USE_CLUSTER_LOD) && !defined(USE_DISCRETE_LOD)
 								.ShaderVisibility = D3D12_SHADER_VISIBILITY_MESH,
-#else // USE_CULLING
+#else // USE_CULLING || USE_CLUSTER_LOD || USE_DISCRETE_LOD
 								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
-#endif // USE_CULLING
+#endif // USE_CULLING || USE_CLUSTER_LOD || USE_DISCRETE_LOD
 #endif // USE_MESHSHADER
 							},
 							// Point Lights Structured buffer
@@ -1645,13 +2538,102 @@ int main()
 									.NumDescriptorRanges = _countof(meshletSRVRanges),
 									.pDescriptorRanges = meshletSRVRanges
 								},
-#ifndef USE_CULLING
+#if !defined(USE_CULLING) && !defined(USE_CLUSTER_LOD) && !defined(USE_DISCRETE_LOD)
 								.ShaderVisibility = D3D12_SHADER_VISIBILITY_MESH,
 #else
 								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL
 #endif
 							},
 #endif
+#ifdef USE_INSTANCE_CULLING
+							// Visible instances (written by the instance culling pass in the same command list).
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+								.Descriptor = {
+									.ShaderRegister = 11,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_AMPLIFICATION,
+							},
+#endif // USE_INSTANCE_CULLING
+#ifdef USE_INDIRECT_DRAW
+							// Visible instances (written by the indirect culling pass in the same command list).
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+								.Descriptor = {
+									.ShaderRegister = 5,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX,
+							},
+#endif // USE_INDIRECT_DRAW
+#ifdef USE_OCCLUSION_CULLING
+							// Culling phase
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
+								.Constants = {
+									.ShaderRegister = 2,
+									.RegisterSpace = 0,
+									.Num32BitValues = 1,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_AMPLIFICATION,
+							},
+							// Depth pyramid table
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
+								.DescriptorTable {
+									.NumDescriptorRanges = 1,
+									.pDescriptorRanges = &depthPyramidSRVRange
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_AMPLIFICATION,
+							},
+							// Visibility bits
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_UAV,
+								.Descriptor = {
+									.ShaderRegister = 1,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_AMPLIFICATION,
+							},
+#endif // USE_OCCLUSION_CULLING
+#ifdef USE_MESHSHADER
+							// Geometry pool meshes (litGeometryPoolRootIndex)
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+								.Descriptor = {
+									.ShaderRegister = 14,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Instance meshes
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+								.Descriptor = {
+									.ShaderRegister = 15,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+#endif // USE_MESHSHADER
+#ifdef USE_CULLING_STATS
+							// Culling stats (amplification and mesh counters)
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_UAV,
+								.Descriptor = {
+									.ShaderRegister = 2,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+#endif // USE_CULLING_STATS
 						};
 
 						const D3D12_STATIC_SAMPLER_DESC sampler{
@@ -1737,20 +2719,20 @@ int main()
 #ifdef USE_AMPLIFICATIONSHADER
 					// Amplification Shader
 					{
-						MComPtr<ID3DBlob> errors;
+						// Permutation compiled for the selected group size (see CMakeLists.txt).
+						const std::wstring amplificationShaderPath = L"Resources/Shaders/HLSL/ASMeshLitShader_Group" + std::to_wstring(asGroupSize) + L".cso";
 
-						const HRESULT hrCompileShader = D3DReadFileToBlob(L"Resources/Shaders/HLSL/ASMeshLitShader.cso", &litAmplificationShader);
+						const HRESULT hrCompileShader = D3DReadFileToBlob(amplificationShaderPath.c_str(), &litAmplificationShader);
 
 						if (FAILED(hrCompileShader))
 						{
-							std::string errorStr(static_cast<const char*>(errors->GetBufferPointer()), errors->GetBufferSize());
-							SA_LOG(L"Shader {ASMeshLitShader.cso, mainAS} compilation failed!", Error, DX12, errorStr);
+							SA_LOG(L"Shader {ASMeshLitShader.cso, mainAS} compilation failed!", Error, DX12, (L"Path: %1, Error Code: %2", amplificationShaderPath, hrCompileShader));
 
 							return EXIT_FAILURE;
 						}
 						else
 						{
-							SA_LOG(L"Shader {ASMeshLitShader.cso, mainAS} compilation success.", Info, DX12, litAmplificationShader.Get());
+							SA_LOG(L"Shader {ASMeshLitShader.cso, mainAS} compilation success.", Info, DX12, (L"Path: %1 [%2]", amplificationShaderPath, litAmplificationShader.Get()));
 						}
 					}
 #endif // USE_AMPLIFICATIONSHADER
@@ -1758,20 +2740,21 @@ int main()
 
 					// Mesh Shader
 					{
-						MComPtr<ID3DBlob> errors;
+						// Permutation compiled for the selected meshlet preset and amplification group size (see CMakeLists.txt).
+						const std::wstring meshShaderPath = L"Resources/Shaders/HLSL/MSMeshLitShader_Preset" + std::to_wstring(meshletPresetIndex) +
+							L"_Group" + std::to_wstring(asGroupSize) + L".cso";
 
-						const HRESULT hrCompileShader = D3DReadFileToBlob(L"Resources/Shaders/HLSL/MSMeshLitShader.cso", &litMeshShader);
+						const HRESULT hrCompileShader = D3DReadFileToBlob(meshShaderPath.c_str(), &litMeshShader);
 
 						if (FAILED(hrCompileShader))
 						{
-							std::string errorStr(static_cast<const char*>(errors->GetBufferPointer()), errors->GetBufferSize());
-							SA_LOG(L"Shader {MSMeshLitShader.cso, mainMS} compilation failed!", Error, DX12, errorStr);
+							SA_LOG(L"Shader {MSMeshLitShader.cso, mainMS} compilation failed!", Error, DX12, (L"Path: %1, Error Code: %2", meshShaderPath, hrCompileShader));
 
 							return EXIT_FAILURE;
 						}
 						else
 						{
-							SA_LOG(L"Shader {MSMeshLitShader.cso, mainMS} compilation success.", Info, DX12, litMeshShader.Get());
+							SA_LOG(L"Shader {MSMeshLitShader.cso, mainMS} compilation success.", Info, DX12, (L"Path: %1 [%2]", meshShaderPath, litMeshShader.Get()));
 						}
 					}
 #endif
@@ -1919,6 +2902,15 @@ int main()
 
 						CD3DX12_PIPELINE_MESH_STATE_STREAM psoStream(desc);
 
+#ifdef USE_MULTI_VIEW
+						// View instancing: the mesh shader runs once per view (SV_ViewID), view i is rasterized in multiViewViewports[i].
+						std::array<D3D12_VIEW_INSTANCE_LOCATION, multiViewCount> viewInstanceLocations;
+						for (uint32_t i = 0; i < multiViewCount; ++i)
+							viewInstanceLocations[i] = D3D12_VIEW_INSTANCE_LOCATION{ .ViewportArrayIndex = i, .RenderTargetArrayIndex = 0 };
+
+						psoStream.ViewInstancingDesc = CD3DX12_VIEW_INSTANCING_DESC(multiViewCount, viewInstanceLocations.data(), D3D12_VIEW_INSTANCING_FLAG_NONE);
+#endif // USE_MULTI_VIEW
+
 						const D3D12_PIPELINE_STATE_STREAM_DESC streamDesc{ sizeof(psoStream), (void*)(&psoStream) };
 						const HRESULT hrCreatePipeline = device->CreatePipelineState(&streamDesc, IID_PPV_ARGS(&litPipelineState));
 						if (FAILED(hrCreatePipeline))
@@ -2031,53 +3023,566 @@ int main()
 #endif // USE_MESHSHADER
 					}
 				}
-			}
-
-
-			cmdList->Reset(cmdAllocs[0].Get(), nullptr);
-
 
-			// Scene Objects /* 0009-I */
-			if (true)
-			{
-				// PBR Sphere SRV View Heap
+#ifdef USE_INSTANCE_CULLING
+				// Instance Culling
 				{
-					/**
-					* Allocate Heap to emplace image/buffer views for future bindings.
-					*/
-
-					D3D12_DESCRIPTOR_HEAP_DESC desc{
-						.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
-#ifdef USE_MESHSHADER
-#ifdef USE_CULLING
-						.NumDescriptors = 10,
-#else // USE_CULLING
-						.NumDescriptors = 9,
-#endif // USE_CULLING
-#else // USE_MESHSHADER
-						.NumDescriptors = 5,
-#endif // USE_MESHSHADER
-						.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE
-					};
-
-					const HRESULT hrCreateHeap = device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&pbrSphereSRVHeap));
-					if (FAILED(hrCreateHeap))
-					{
-						SA_LOG(L"Create PBR Sphere SRV ViewHeap failed.", Error, DX12, (L"Error code: %1", hrCreateHeap));
-						return EXIT_FAILURE;
-					}
-					else
+					// RootSignature
 					{
-						const LPCWSTR name = L"PBR Sphere SRV ViewHeap";
-						pbrSphereSRVHeap->SetName(name);
-
-						SA_LOG(L"Create PBR Sphere SRV ViewHeap success.", Info, DX12, (L"\"%1\" [%2]", name, pbrSphereSRVHeap.Get()));
-					}
-				}
-
+#ifdef USE_OCCLUSION_CULLING
+						const D3D12_DESCRIPTOR_RANGE1 depthPyramidSRVRange{
+							.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
+							.NumDescriptors = 1,
+							.BaseShaderRegister = 12,
+							.RegisterSpace = 0,
+							.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DATA_VOLATILE,
+							.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
+						};
 
-				// Scene Buffers
-				{
+#endif // USE_OCCLUSION_CULLING
+						const D3D12_ROOT_PARAMETER1 params[]{
+							// Scene Constant buffer
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV,
+								.Descriptor = {
+									.ShaderRegister = 0,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Objects structured buffer
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+								.Descriptor = {
+									.ShaderRegister = 13,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Visible instances
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_UAV,
+								.Descriptor = {
+									.ShaderRegister = 0,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+#ifdef USE_OCCLUSION_CULLING
+							// Culling phase
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
+								.Constants = {
+									.ShaderRegister = 2,
+									.RegisterSpace = 0,
+									.Num32BitValues = 1,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Depth pyramid table
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
+								.DescriptorTable {
+									.NumDescriptorRanges = 1,
+									.pDescriptorRanges = &depthPyramidSRVRange
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Visibility bits
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_UAV,
+								.Descriptor = {
+									.ShaderRegister = 1,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+#endif // USE_OCCLUSION_CULLING
+							// Geometry pool meshes (instanceCullingGeometryPoolRootIndex)
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+								.Descriptor = {
+									.ShaderRegister = 14,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Instance meshes
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+								.Descriptor = {
+									.ShaderRegister = 15,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+#ifdef USE_CULLING_STATS
+							// Culling stats
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_UAV,
+								.Descriptor = {
+									.ShaderRegister = 2,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+#endif // USE_CULLING_STATS
+						};
+
+						const D3D12_VERSIONED_ROOT_SIGNATURE_DESC desc{
+							.Version = D3D_ROOT_SIGNATURE_VERSION_1_1,
+							.Desc_1_1{
+								.NumParameters = _countof(params),
+								.pParameters = params,
+								.NumStaticSamplers = 0,
+								.pStaticSamplers = nullptr,
+								.Flags = D3D12_ROOT_SIGNATURE_FLAG_NONE
+							}
+						};
+
+						MComPtr<ID3DBlob> signature;
+						MComPtr<ID3DBlob> error;
+
+						const HRESULT hrSerRootSign = D3D12SerializeVersionedRootSignature(&desc, &signature, &error);
+						if (FAILED(hrSerRootSign))
+						{
+							std::string errorStr(static_cast<char*>(error->GetBufferPointer()), error->GetBufferSize());
+							SA_LOG(L"Serialized Instance Culling RootSignature failed!", Error, DX12, errorStr);
+
+							return EXIT_FAILURE;
+						}
+
+						const HRESULT hrCreateRootSign = device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&instanceCullingRootSign));
+						if (FAILED(hrCreateRootSign))
+						{
+							SA_LOG(L"Create Instance Culling RootSignature failed!", Error, DX12, (L"Error Code: %1", hrCreateRootSign));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Instance Culling RootSignature success.", Info, DX12, instanceCullingRootSign.Get());
+						}
+					}
+
+					// Compute Shader
+					{
+						const HRESULT hrCompileShader = D3DReadFileToBlob(L"Resources/Shaders/HLSL/CSInstanceCullingShader.cso", &instanceCullingComputeShader);
+
+						if (FAILED(hrCompileShader))
+						{
+							SA_LOG(L"Shader {CSInstanceCullingShader.cso, mainInstanceCullingCS} compilation failed!", Error, DX12, (L"Error Code: %1", hrCompileShader));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Shader {CSInstanceCullingShader.cso, mainInstanceCullingCS} compilation success.", Info, DX12, instanceCullingComputeShader.Get());
+						}
+					}
+
+					// PipelineState
+					{
+						const D3D12_COMPUTE_PIPELINE_STATE_DESC desc{
+							.pRootSignature = instanceCullingRootSign.Get(),
+							.CS{
+								.pShaderBytecode = instanceCullingComputeShader->GetBufferPointer(),
+								.BytecodeLength = instanceCullingComputeShader->GetBufferSize()
+							},
+							.NodeMask = 0,
+							.CachedPSO
+							{
+								.pCachedBlob = nullptr,
+								.CachedBlobSizeInBytes = 0,
+							},
+							.Flags = D3D12_PIPELINE_STATE_FLAG_NONE,
+						};
+
+						const HRESULT hrCreatePipeline = device->CreateComputePipelineState(&desc, IID_PPV_ARGS(&instanceCullingPipelineState));
+						if (FAILED(hrCreatePipeline))
+						{
+							SA_LOG(L"Create Instance Culling PipelineState failed!", Error, DX12, (L"Error Code: %1", hrCreatePipeline));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Instance Culling PipelineState success.", Info, DX12, instanceCullingPipelineState.Get());
+						}
+					}
+
+					// DispatchMesh CommandSignature
+					{
+						/**
+						* Only the DispatchMesh arguments are read from the buffer: no root argument changes,
+						* so no root signature is required.
+						*/
+						const D3D12_INDIRECT_ARGUMENT_DESC argumentDesc{
+							.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH,
+						};
+
+						const D3D12_COMMAND_SIGNATURE_DESC desc{
+							.ByteStride = sizeof(VisibleInstanceHeader),
+							.NumArgumentDescs = 1,
+							.pArgumentDescs = &argumentDesc,
+							.NodeMask = 0,
+						};
+
+						const HRESULT hrCreateSignature = device->CreateCommandSignature(&desc, nullptr, IID_PPV_ARGS(&dispatchMeshCommandSignature));
+						if (FAILED(hrCreateSignature))
+						{
+							SA_LOG(L"Create DispatchMesh CommandSignature failed!", Error, DX12, (L"Error Code: %1", hrCreateSignature));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create DispatchMesh CommandSignature success.", Info, DX12, dispatchMeshCommandSignature.Get());
+						}
+					}
+				}
+#endif // USE_INSTANCE_CULLING
+
+#ifdef USE_INDIRECT_DRAW
+				// Indirect Culling
+				{
+					// RootSignature
+					{
+						const D3D12_ROOT_PARAMETER1 params[]{
+							// Scene Constant buffer
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV,
+								.Descriptor = {
+									.ShaderRegister = 0,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Objects structured buffer
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+								.Descriptor = {
+									.ShaderRegister = 13,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Indirect culling constants
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
+								.Constants = {
+									.ShaderRegister = 2,
+									.RegisterSpace = 0,
+									.Num32BitValues = sizeof(IndirectCullingConstants) / sizeof(uint32_t),
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Indirect draw arguments and visible instances
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_UAV,
+								.Descriptor = {
+									.ShaderRegister = 0,
+									.RegisterSpace = 0,
+									.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+						};
+
+						const D3D12_VERSIONED_ROOT_SIGNATURE_DESC desc{
+							.Version = D3D_ROOT_SIGNATURE_VERSION_1_1,
+							.Desc_1_1{
+								.NumParameters = _countof(params),
+								.pParameters = params,
+								.NumStaticSamplers = 0,
+								.pStaticSamplers = nullptr,
+								.Flags = D3D12_ROOT_SIGNATURE_FLAG_NONE
+							}
+						};
+
+						MComPtr<ID3DBlob> signature;
+						MComPtr<ID3DBlob> error;
+
+						const HRESULT hrSerRootSign = D3D12SerializeVersionedRootSignature(&desc, &signature, &error);
+						if (FAILED(hrSerRootSign))
+						{
+							std::string errorStr(static_cast<char*>(error->GetBufferPointer()), error->GetBufferSize());
+							SA_LOG(L"Serialized Indirect Culling RootSignature failed!", Error, DX12, errorStr);
+
+							return EXIT_FAILURE;
+						}
+
+						const HRESULT hrCreateRootSign = device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&indirectCullingRootSign));
+						if (FAILED(hrCreateRootSign))
+						{
+							SA_LOG(L"Create Indirect Culling RootSignature failed!", Error, DX12, (L"Error Code: %1", hrCreateRootSign));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Indirect Culling RootSignature success.", Info, DX12, indirectCullingRootSign.Get());
+						}
+					}
+
+					// Compute Shader
+					{
+						const HRESULT hrCompileShader = D3DReadFileToBlob(L"Resources/Shaders/HLSL/CSIndirectCullingShader.cso", &indirectCullingComputeShader);
+
+						if (FAILED(hrCompileShader))
+						{
+							SA_LOG(L"Shader {CSIndirectCullingShader.cso, mainIndirectCullingCS} compilation failed!", Error, DX12, (L"Error Code: %1", hrCompileShader));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Shader {CSIndirectCullingShader.cso, mainIndirectCullingCS} compilation success.", Info, DX12, indirectCullingComputeShader.Get());
+						}
+					}
+
+					// PipelineState
+					{
+						const D3D12_COMPUTE_PIPELINE_STATE_DESC desc{
+							.pRootSignature = indirectCullingRootSign.Get(),
+							.CS{
+								.pShaderBytecode = indirectCullingComputeShader->GetBufferPointer(),
+								.BytecodeLength = indirectCullingComputeShader->GetBufferSize()
+							},
+							.NodeMask = 0,
+							.CachedPSO
+							{
+								.pCachedBlob = nullptr,
+								.CachedBlobSizeInBytes = 0,
+							},
+							.Flags = D3D12_PIPELINE_STATE_FLAG_NONE,
+						};
+
+						const HRESULT hrCreatePipeline = device->CreateComputePipelineState(&desc, IID_PPV_ARGS(&indirectCullingPipelineState));
+						if (FAILED(hrCreatePipeline))
+						{
+							SA_LOG(L"Create Indirect Culling PipelineState failed!", Error, DX12, (L"Error Code: %1", hrCreatePipeline));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Indirect Culling PipelineState success.", Info, DX12, indirectCullingPipelineState.Get());
+						}
+					}
+
+					// DrawIndexed CommandSignature
+					{
+						/**
+						* Only the DrawIndexedInstanced arguments are read from the buffer: no root argument changes,
+						* so no root signature is required.
+						* Single draw of every visible instance: SV_InstanceID starts at 0 whatever StartInstanceLocation,
+						* so one draw per instance could not tell the instances apart without a root constant per draw.
+						*/
+						const D3D12_INDIRECT_ARGUMENT_DESC argumentDesc{
+							.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED,
+						};
+
+						const D3D12_COMMAND_SIGNATURE_DESC desc{
+							.ByteStride = sizeof(IndirectDrawHeader),
+							.NumArgumentDescs = 1,
+							.pArgumentDescs = &argumentDesc,
+							.NodeMask = 0,
+						};
+
+						const HRESULT hrCreateSignature = device->CreateCommandSignature(&desc, nullptr, IID_PPV_ARGS(&drawIndexedCommandSignature));
+						if (FAILED(hrCreateSignature))
+						{
+							SA_LOG(L"Create DrawIndexed CommandSignature failed!", Error, DX12, (L"Error Code: %1", hrCreateSignature));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create DrawIndexed CommandSignature success.", Info, DX12, drawIndexedCommandSignature.Get());
+						}
+					}
+				}
+#endif // USE_INDIRECT_DRAW
+
+#ifdef USE_OCCLUSION_CULLING
+				// Depth Pyramid
+				{
+					// RootSignature
+					{
+						const D3D12_DESCRIPTOR_RANGE1 sourceSRVRange{
+							.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
+							.NumDescriptors = 1,
+							.BaseShaderRegister = 0,
+							.RegisterSpace = 0,
+							.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DATA_VOLATILE,
+							.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
+						};
+
+						const D3D12_DESCRIPTOR_RANGE1 destinationUAVRange{
+							.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_UAV,
+							.NumDescriptors = 1,
+							.BaseShaderRegister = 0,
+							.RegisterSpace = 0,
+							.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DATA_VOLATILE,
+							.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
+						};
+
+						const D3D12_ROOT_PARAMETER1 params[]{
+							// Source and destination sizes
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
+								.Constants = {
+									.ShaderRegister = 0,
+									.RegisterSpace = 0,
+									.Num32BitValues = 4,
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Source depth
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
+								.DescriptorTable {
+									.NumDescriptorRanges = 1,
+									.pDescriptorRanges = &sourceSRVRange
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+							// Destination mip
+							{
+								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
+								.DescriptorTable {
+									.NumDescriptorRanges = 1,
+									.pDescriptorRanges = &destinationUAVRange
+								},
+								.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL,
+							},
+						};
+
+						const D3D12_VERSIONED_ROOT_SIGNATURE_DESC desc{
+							.Version = D3D_ROOT_SIGNATURE_VERSION_1_1,
+							.Desc_1_1{
+								.NumParameters = _countof(params),
+								.pParameters = params,
+								.NumStaticSamplers = 0,
+								.pStaticSamplers = nullptr,
+								.Flags = D3D12_ROOT_SIGNATURE_FLAG_NONE
+							}
+						};
+
+						MComPtr<ID3DBlob> signature;
+						MComPtr<ID3DBlob> error;
+
+						const HRESULT hrSerRootSign = D3D12SerializeVersionedRootSignature(&desc, &signature, &error);
+						if (FAILED(hrSerRootSign))
+						{
+							std::string errorStr(static_cast<char*>(error->GetBufferPointer()), error->GetBufferSize());
+							SA_LOG(L"Serialized Depth Pyramid RootSignature failed!", Error, DX12, errorStr);
+
+							return EXIT_FAILURE;
+						}
+
+						const HRESULT hrCreateRootSign = device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&depthPyramidRootSign));
+						if (FAILED(hrCreateRootSign))
+						{
+							SA_LOG(L"Create Depth Pyramid RootSignature failed!", Error, DX12, (L"Error Code: %1", hrCreateRootSign));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Depth Pyramid RootSignature success.", Info, DX12, depthPyramidRootSign.Get());
+						}
+					}
+
+					// Compute Shader
+					{
+						const HRESULT hrCompileShader = D3DReadFileToBlob(L"Resources/Shaders/HLSL/CSDepthPyramidShader.cso", &depthPyramidComputeShader);
+
+						if (FAILED(hrCompileShader))
+						{
+							SA_LOG(L"Shader {CSDepthPyramidShader.cso, mainDepthPyramidCS} compilation failed!", Error, DX12, (L"Error Code: %1", hrCompileShader));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Shader {CSDepthPyramidShader.cso, mainDepthPyramidCS} compilation success.", Info, DX12, depthPyramidComputeShader.Get());
+						}
+					}
+
+					// PipelineState
+					{
+						const D3D12_COMPUTE_PIPELINE_STATE_DESC desc{
+							.pRootSignature = depthPyramidRootSign.Get(),
+							.CS{
+								.pShaderBytecode = depthPyramidComputeShader->GetBufferPointer(),
+								.BytecodeLength = depthPyramidComputeShader->GetBufferSize()
+							},
+							.NodeMask = 0,
+							.CachedPSO
+							{
+								.pCachedBlob = nullptr,
+								.CachedBlobSizeInBytes = 0,
+							},
+							.Flags = D3D12_PIPELINE_STATE_FLAG_NONE,
+						};
+
+						const HRESULT hrCreatePipeline = device->CreateComputePipelineState(&desc, IID_PPV_ARGS(&depthPyramidPipelineState));
+						if (FAILED(hrCreatePipeline))
+						{
+							SA_LOG(L"Create Depth Pyramid PipelineState failed!", Error, DX12, (L"Error Code: %1", hrCreatePipeline));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Depth Pyramid PipelineState success.", Info, DX12, depthPyramidPipelineState.Get());
+						}
+					}
+				}
+#endif // USE_OCCLUSION_CULLING
+			}
+
+
+			cmdList->Reset(cmdAllocs[0].Get(), nullptr);
+
+
+			// Scene Objects /* 0009-I */
+			if (true)
+			{
+				// PBR Sphere SRV View Heap
+				{
+					/**
+					* Allocate Heap to emplace image/buffer views for future bindings.
+					*/
+
+					D3D12_DESCRIPTOR_HEAP_DESC desc{
+						.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+#ifdef USE_OCCLUSION_CULLING
+						.NumDescriptors = pbrSphereSRVCount + depthPyramidDescriptorCount,
+#else
+						.NumDescriptors = pbrSphereSRVCount,
+#endif
+						.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE
+					};
+
+					const HRESULT hrCreateHeap = device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&pbrSphereSRVHeap));
+					if (FAILED(hrCreateHeap))
+					{
+						SA_LOG(L"Create PBR Sphere SRV ViewHeap failed.", Error, DX12, (L"Error code: %1", hrCreateHeap));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						const LPCWSTR name = L"PBR Sphere SRV ViewHeap";
+						pbrSphereSRVHeap->SetName(name);
+
+						SA_LOG(L"Create PBR Sphere SRV ViewHeap success.", Info, DX12, (L"\"%1\" [%2]", name, pbrSphereSRVHeap.Get()));
+					}
+				}
+
+
+				// Scene Buffers
+				{
 					const D3D12_HEAP_PROPERTIES heap{
 						.Type = D3D12_HEAP_TYPE_UPLOAD, // Keep upload since we will update it each frame.
 					};
@@ -2116,6 +3621,20 @@ int main()
 
 				// Sphere Object Buffer
 				{
+#ifdef USE_INSTANCING
+					const size_t gridInstanceCount = size_t(numInstanceRowsCount) * numInstanceColsCount;
+
+					sceneObjects.reserve(gridInstanceCount);
+					for (uint32_t i = 0u; i < gridInstanceCount; i++)
+						sceneObjects.push_back(MakeObjectUBO(GetInstanceGridPosition(i)));
+
+					// The scene drives the instance count: every buffer indexed by instance is sized from it.
+					instanceCount = static_cast<uint32_t>(sceneObjects.size());
+
+					// Uploaded whole below: nothing is dirty yet.
+					sceneObjectsDirty.Resize(instanceCount);
+#endif
+
 					const D3D12_HEAP_PROPERTIES heap{
 						.Type = D3D12_HEAP_TYPE_DEFAULT,
 					};
@@ -2124,7 +3643,7 @@ int main()
 						.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 						.Alignment = 0,
 #ifdef USE_INSTANCING
-						.Width = instanceCount * sizeof(ObjectUBO),
+						.Width = uint64_t(instanceCount) * sizeof(ObjectUBO),
 #else
 						.Width = sizeof(ObjectUBO),
 #endif
@@ -2152,32 +3671,241 @@ int main()
 					}
 
 #ifdef USE_INSTANCING
-					std::vector<ObjectUBO> objectsUBO;
-					objectsUBO.reserve(instanceCount);
-					for (uint32_t i = 0u; i < numInstanceRowsCount; i++)
+					const bool bSubmitSuccess = SubmitBufferToGPU(sphereObjectsBuffer, desc.Width, sceneObjects.data(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+#else
+					const ObjectUBO objectUBO = MakeObjectUBO(spherePosition);
+
+					const bool bSubmitSuccess = SubmitBufferToGPU(sphereObjectsBuffer, desc.Width, &objectUBO, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+#endif
+					if (!bSubmitSuccess)
+					{
+						SA_LOG(L"Sphere Object Buffer submit failed!", Error, DX12);
+						return EXIT_FAILURE;
+					}
+				}
+
+#ifdef USE_INSTANCING
+				// Object Upload Buffers
+				{
+					objectUploadCapacity = std::min(instanceCount, objectUploadMaxInstanceCount);
+
+					const D3D12_HEAP_PROPERTIES heap{
+						.Type = D3D12_HEAP_TYPE_UPLOAD, // Rewritten by the CPU every frame.
+					};
+
+					const D3D12_RESOURCE_DESC desc{
+						.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+						.Alignment = 0,
+						.Width = uint64_t(objectUploadCapacity) * sizeof(ObjectUBO),
+						.Height = 1,
+						.DepthOrArraySize = 1,
+						.MipLevels = 1,
+						.Format = DXGI_FORMAT_UNKNOWN,
+						.SampleDesc = {.Count = 1, .Quality = 0 },
+						.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+						.Flags = D3D12_RESOURCE_FLAG_NONE,
+					};
+
+					for (uint32_t i = 0; i < bufferingCount; ++i)
 					{
-						for (uint32_t j = 0u; j < numInstanceColsCount; j++)
+						const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&objectUploadBuffers[i]));
+						if (FAILED(hrBufferCreated))
+						{
+							SA_LOG((L"Create Object Upload Buffer [%1] failed!", i), Error, DX12, (L"Error code: %1", hrBufferCreated));
+							return EXIT_FAILURE;
+						}
+						else
 						{
-							ObjectUBO instanceUBO;
-							const SA::Vec3 instancePosition = spherePosition + SA::Vec3(5.f * i, 0.f, 5.f * j);
-							instanceUBO.transform = SA::Mat4f::MakeTranslation(instancePosition);
-							objectsUBO.push_back(instanceUBO);
+							const std::wstring name = L"ObjectUploadBuffer [" + std::to_wstring(i) + L"]";
+							objectUploadBuffers[i]->SetName(name.c_str());
+
+							SA_LOG((L"Create Object Upload Buffer [%1] success", i), Info, DX12, (L"\"%1\" [%2]", name, objectUploadBuffers[i].Get()));
 						}
+
+						// Upload heaps can stay mapped: the CPU never reads it back.
+						const D3D12_RANGE range{ .Begin = 0, .End = 0 };
+						objectUploadBuffers[i]->Map(0, &range, reinterpret_cast<void**>(&objectUploadData[i]));
 					}
+				}
+#endif // USE_INSTANCING
 
-					const bool bSubmitSuccess = SubmitBufferToGPU(sphereObjectsBuffer, desc.Width, objectsUBO.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
-#else
-					ObjectUBO objectUBO;
-					objectUBO.transform = SA::Mat4f::MakeTranslation(spherePosition);
+#ifdef USE_INDIRECT_DRAW
+				// Indirect Draw Buffers
+				{
+					const D3D12_HEAP_PROPERTIES heap{
+						.Type = D3D12_HEAP_TYPE_DEFAULT,
+					};
+
+					const D3D12_RESOURCE_DESC desc{
+						.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+						.Alignment = 0,
+						.Width = sizeof(IndirectDrawHeader) + instanceCount * sizeof(uint32_t),
+						.Height = 1,
+						.DepthOrArraySize = 1,
+						.MipLevels = 1,
+						.Format = DXGI_FORMAT_UNKNOWN,
+						.SampleDesc = {.Count = 1, .Quality = 0 },
+						.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+						.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS,
+					};
+
+					const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&indirectDrawBuffer));
+					if (FAILED(hrBufferCreated))
+					{
+						SA_LOG(L"Create Indirect Draw Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						const LPCWSTR name = L"IndirectDrawBuffer";
+						indirectDrawBuffer->SetName(name);
+
+						SA_LOG(L"Create Indirect Draw Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, indirectDrawBuffer.Get()));
+					}
+
+
+					const D3D12_HEAP_PROPERTIES resetHeap{
+						.Type = D3D12_HEAP_TYPE_UPLOAD,
+					};
+
+					const D3D12_RESOURCE_DESC resetDesc{
+						.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+						.Alignment = 0,
+						.Width = sizeof(IndirectDrawHeader),
+						.Height = 1,
+						.DepthOrArraySize = 1,
+						.MipLevels = 1,
+						.Format = DXGI_FORMAT_UNKNOWN,
+						.SampleDesc = {.Count = 1, .Quality = 0 },
+						.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+						.Flags = D3D12_RESOURCE_FLAG_NONE,
+					};
+
+					const HRESULT hrResetBufferCreated = device->CreateCommittedResource(&resetHeap, D3D12_HEAP_FLAG_NONE, &resetDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&indirectDrawResetBuffer));
+					if (FAILED(hrResetBufferCreated))
+					{
+						SA_LOG(L"Create Indirect Draw Reset Buffer failed!", Error, DX12, (L"Error code: %1", hrResetBufferCreated));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						const LPCWSTR name = L"IndirectDrawResetBuffer";
+						indirectDrawResetBuffer->SetName(name);
+
+						SA_LOG(L"Create Indirect Draw Reset Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, indirectDrawResetBuffer.Get()));
+					}
+
+					// No instance visible: InstanceCount = 0.
+					const IndirectDrawHeader resetHeader{};
+
+					const D3D12_RANGE range{ .Begin = 0, .End = 0 };
+					void* data = nullptr;
+
+					indirectDrawResetBuffer->Map(0, &range, reinterpret_cast<void**>(&data));
+					std::memcpy(data, &resetHeader, sizeof(IndirectDrawHeader));
+					indirectDrawResetBuffer->Unmap(0, nullptr);
+				}
+#endif // USE_INDIRECT_DRAW
+
+#ifdef USE_CULLING_STATS
+				// Culling Stats Buffers
+				{
+					const D3D12_HEAP_PROPERTIES heap{
+						.Type = D3D12_HEAP_TYPE_DEFAULT,
+					};
+
+					const D3D12_RESOURCE_DESC desc{
+						.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+						.Alignment = 0,
+						.Width = sizeof(CullingStats),
+						.Height = 1,
+						.DepthOrArraySize = 1,
+						.MipLevels = 1,
+						.Format = DXGI_FORMAT_UNKNOWN,
+						.SampleDesc = {.Count = 1, .Quality = 0 },
+						.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+						.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS,
+					};
+
+					const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&cullingStatsBuffer));
+					if (FAILED(hrBufferCreated))
+					{
+						SA_LOG(L"Create Culling Stats Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						const LPCWSTR name = L"CullingStatsBuffer";
+						cullingStatsBuffer->SetName(name);
+
+						SA_LOG(L"Create Culling Stats Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, cullingStatsBuffer.Get()));
+					}
+
+
+					const D3D12_HEAP_PROPERTIES resetHeap{
+						.Type = D3D12_HEAP_TYPE_UPLOAD,
+					};
+
+					const D3D12_RESOURCE_DESC stagingDesc{
+						.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+						.Alignment = 0,
+						.Width = sizeof(CullingStats),
+						.Height = 1,
+						.DepthOrArraySize = 1,
+						.MipLevels = 1,
+						.Format = DXGI_FORMAT_UNKNOWN,
+						.SampleDesc = {.Count = 1, .Quality = 0 },
+						.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+						.Flags = D3D12_RESOURCE_FLAG_NONE,
+					};
+
+					const HRESULT hrResetBufferCreated = device->CreateCommittedResource(&resetHeap, D3D12_HEAP_FLAG_NONE, &stagingDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&cullingStatsResetBuffer));
+					if (FAILED(hrResetBufferCreated))
+					{
+						SA_LOG(L"Create Culling Stats Reset Buffer failed!", Error, DX12, (L"Error code: %1", hrResetBufferCreated));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						const LPCWSTR name = L"CullingStatsResetBuffer";
+						cullingStatsResetBuffer->SetName(name);
+
+						SA_LOG(L"Create Culling Stats Reset Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, cullingStatsResetBuffer.Get()));
+					}
+
+					const CullingStats resetStats{};
+
+					const D3D12_RANGE range{ .Begin = 0, .End = 0 };
+					void* data = nullptr;
+
+					cullingStatsResetBuffer->Map(0, &range, reinterpret_cast<void**>(&data));
+					std::memcpy(data, &resetStats, sizeof(CullingStats));
+					cullingStatsResetBuffer->Unmap(0, nullptr);
+
+
+					// Readback resources must stay in COPY_DEST.
+					const D3D12_HEAP_PROPERTIES readbackHeap{
+						.Type = D3D12_HEAP_TYPE_READBACK,
+					};
+
+					for (uint32_t i = 0; i < bufferingCount; ++i)
+					{
+						const HRESULT hrReadbackBufferCreated = device->CreateCommittedResource(&readbackHeap, D3D12_HEAP_FLAG_NONE, &stagingDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&cullingStatsReadbackBuffers[i]));
+						if (FAILED(hrReadbackBufferCreated))
+						{
+							SA_LOG((L"Create Culling Stats Readback Buffer [%1] failed!", i), Error, DX12, (L"Error code: %1", hrReadbackBufferCreated));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							const std::wstring name = L"CullingStatsReadbackBuffer [" + std::to_wstring(i) + L"]";
+							cullingStatsReadbackBuffers[i]->SetName(name.c_str());
 
-					const bool bSubmitSuccess = SubmitBufferToGPU(sphereObjectsBuffer, desc.Width, &objectUBO, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
-#endif
-					if (!bSubmitSuccess)
-					{
-						SA_LOG(L"Sphere Object Buffer submit failed!", Error, DX12);
-						return EXIT_FAILURE;
+							SA_LOG((L"Create Culling Stats Readback Buffer [%1] success.", i), Info, DX12, (L"\"%1\" [%2]", name, cullingStatsReadbackBuffers[i].Get()));
+						}
 					}
 				}
+#endif // USE_CULLING_STATS
 
 
 				// PointLights Buffer
@@ -2257,93 +3985,145 @@ int main()
 			// Resources /* 0010-I */
 			if (true)
 			{
-				Assimp::Importer importer;
-
 				// Meshes
 				{
-					// Sphere
+					// Geometry pool
 					{
-						const char* path = "Resources/Models/Shapes/sphere.obj";
-						const aiScene* scene = importer.ReadFile(path, aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded);
-						if (!scene)
+						/**
+						* Meshlets, packed triangles and bounds are cooked once per model and cached on disk (see MeshletCooker).
+						* Launch only maps the cached files and appends their sections to the geometry pool.
+						*/
+						Renderer::GeometryPool geometryPool;
+
+						for (const char* path : meshPaths)
 						{
-							SA_LOG(L"Assimp loading failed!", Error, Assimp, path);
-							return EXIT_FAILURE;
+							MeshletCooker::MeshletFile meshFile;
+							if (!MeshletCooker::LoadOrCook(path, meshletCacheDir, meshletCookSettings, meshFile))
+							{
+								SA_LOG(L"Mesh meshlet cook failed!", Error, MeshletCooker, path);
+								return EXIT_FAILURE;
+							}
+
+#ifdef USE_MESHSHADER
+							// The Mesh Shader outputs are sized by the preset: bigger meshlets would be truncated.
+							{
+								const MeshletCooker::Settings& fileSettings = meshFile.Header().settings;
+								const MeshletCooker::MeshletPreset& meshletPreset = MeshletCooker::meshletPresets[meshletPresetIndex];
+
+								if (fileSettings.maxVertices > meshletPreset.maxVertices || fileSettings.maxTriangles > meshletPreset.maxTriangles)
+								{
+									SA_LOG((L"Mesh meshlet limits {%1, %2} exceed meshlet preset %3 {%4, %5}!", fileSettings.maxVertices, fileSettings.maxTriangles,
+										meshletPresetIndex, meshletPreset.maxVertices, meshletPreset.maxTriangles), Error, MeshletCooker, path);
+									return EXIT_FAILURE;
+								}
+							}
+#endif
+
+							if (!geometryPool.Append(meshFile))
+							{
+								SA_LOG(L"Geometry pool append failed!", Error, MeshletCooker, path);
+								return EXIT_FAILURE;
+							}
 						}
 
-						const aiMesh* inMesh = scene->mMeshes[0];
+#if defined(USE_MESHSHADER) && defined(USE_QUANTIZED_VERTICES)
+						const std::span<const MeshletCooker::QuantizedVertex> vertices = geometryPool.quantizedVertices;
+#else
+						const std::span<const Vertex> vertices = geometryPool.vertices;
+#endif
+						const std::span<const uint32_t> indices = geometryPool.indices;
 
-						std::vector<uint16_t> indices;
-						sphereIndexCount = inMesh->mNumFaces * 3;
-						indices.resize(sphereIndexCount);
+						// The vertex shader path draws mesh 0 only: its indices come first.
+						sphereIndexCount = geometryPool.submeshes[0].indexCount;
 
-						for (unsigned int i = 0; i < inMesh->mNumFaces; ++i)
-						{
-							indices[i * 3] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[0]);
-							indices[i * 3 + 1] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[1]);
-							indices[i * 3 + 2] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[2]);
-						}
+#ifdef USE_INDIRECT_DRAW
+						sphereBoundingSphere = geometryPool.meshes[0].boundingSphere;
+#endif
 
 #ifdef USE_MESHSHADER
 						const UINT srvOffset = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 						D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = pbrSphereSRVHeap->GetCPUDescriptorHandleForHeapStart();
 						cpuHandle.ptr += srvOffset * 5u; // Add offset because first slot it for PointLightsBuffer (1) and PBR textures (4).
 
-						const size_t maxVertices = 64u;
-						const size_t maxTriangles = 124u;
-						const float coneWeight = 0.f;
-						
-						size_t maxMeshlets = meshopt_buildMeshletsBound(indices.size(), maxVertices, maxTriangles);
-						std::vector<meshopt_Meshlet> meshlets(maxMeshlets);
-						std::vector<unsigned int> meshletVertices(maxMeshlets * maxVertices);
-						std::vector<unsigned char> meshletTriangles(maxMeshlets * maxTriangles * 3u);
-
-						meshletCount = meshopt_buildMeshlets(meshlets.data(), meshletVertices.data(), meshletTriangles.data(), indices.data(),
-							indices.size(), &inMesh->mVertices[0].x, inMesh->mNumVertices, sizeof(aiVector3D), maxVertices, maxTriangles, coneWeight);
-
-						auto& last = meshlets[meshletCount - 1];
-						meshletVertices.resize(last.vertex_offset + last.vertex_count);
-						meshletTriangles.resize(last.triangle_offset + ((last.triangle_count * 3 + 3) & ~3));
-						meshlets.resize(meshletCount);
-
+#ifdef USE_COMPACT_MESHLETS
+						// uint16 vertex indices and byte triangles are read as uint32 words by the Mesh Shader (streams are padded).
+						const std::span<const MeshletCooker::CompactMeshlet> meshlets = geometryPool.compactMeshlets;
+						const std::span<const uint16_t> meshletVertices = geometryPool.compactMeshletVertices;
+						const std::span<const uint8_t> meshletTriangles = geometryPool.compactMeshletTriangles;
+#else // USE_COMPACT_MESHLETS
+						const std::span<const MeshletCooker::Meshlet> meshlets = geometryPool.meshlets;
+						const std::span<const uint32_t> meshletVertices = geometryPool.meshletVertices;
+						const std::span<const uint32_t> meshletTriangles = geometryPool.meshletTriangles;
+#endif // USE_COMPACT_MESHLETS
 #ifdef USE_CULLING
-						std::vector<SA::Vec4f> meshletBounds;
-						meshletBounds.reserve(meshletCount);
+						const std::span<const MeshletCooker::MeshletBounds> meshletBounds = geometryPool.meshletBounds;
 #endif // USE_CULLING
-						std::vector<uint32_t> meshletTrianglesU32;
-						for (meshopt_Meshlet& meshlet : meshlets)
+#ifdef USE_CLUSTER_LOD
+						const std::span<const MeshletCooker::MeshletLod> meshletLods = geometryPool.meshletLods;
+#endif // USE_CLUSTER_LOD
+#ifdef USE_DISCRETE_LOD
+						const std::span<const MeshletCooker::MeshLod> meshLods = geometryPool.meshLods;
+#endif // USE_DISCRETE_LOD
+						const std::span<const Renderer::MeshRecord> meshRecords = geometryPool.meshes;
+
+						// Meshlets dispatched for a mesh: LOD 0 with USE_DISCRETE_LOD (the selected LOD is never larger).
+						const auto GetMeshDispatchMeshletCount = [&](const Renderer::MeshRecord& _mesh)
 						{
-#ifdef USE_CULLING
-							const meshopt_Bounds bounds = meshopt_computeMeshletBounds(&meshletVertices[meshlet.vertex_offset], &meshletTriangles[meshlet.triangle_offset],
-								meshlet.triangle_count, reinterpret_cast<const float*>(inMesh->mVertices), inMesh->mNumVertices,
-								sizeof(SA::Vec3f));
+#ifdef USE_DISCRETE_LOD
+							return meshLods[_mesh.lodOffset].meshletCount;
+#else // USE_DISCRETE_LOD
+							return _mesh.meshletCount;
+#endif // USE_DISCRETE_LOD
+						};
 
-							meshletBounds.push_back(SA::Vec4f(bounds.center[0], bounds.center[1], bounds.center[2], bounds.radius));
-#endif // USE_CULLING
+						/**
+						* Mesh and first meshlet chunk of each instance (root SRV, no view).
+						* The instances cycle through the pool meshes so that a single dispatch renders all of them.
+						* Each instance dispatches the chunks of its own mesh only: no stride of the largest mesh.
+						*/
+#ifdef USE_INSTANCING
+						std::vector<InstanceMesh> instanceMeshData(instanceCount);
+#else
+						std::vector<InstanceMesh> instanceMeshData(1u);
+#endif
 
-							// Save triangle offset for current meshlet
-							uint32_t triangleOffset = static_cast<uint32_t>(meshletTrianglesU32.size());
+						uint64_t totalChunkCount = 0u;
+						for (size_t i = 0u; i < instanceMeshData.size(); ++i)
+						{
+							InstanceMesh& instanceMesh = instanceMeshData[i];
+							instanceMesh.meshId = static_cast<uint32_t>(i % geometryPool.MeshCount());
+							instanceMesh.chunkOffset = static_cast<uint32_t>(totalChunkCount);
 
-							// Repack to uint32_t
-							for (uint32_t i = 0; i < meshlet.triangle_count; ++i)
-							{
-								const uint32_t i0 = 3 * i + 0 + meshlet.triangle_offset;
-								const uint32_t i1 = 3 * i + 1 + meshlet.triangle_offset;
-								const uint32_t i2 = 3 * i + 2 + meshlet.triangle_offset;
+							totalChunkCount += (GetMeshDispatchMeshletCount(meshRecords[instanceMesh.meshId]) + meshletChunkSize - 1u) / meshletChunkSize;
+						}
 
-								const uint8_t  vertIdx0 = meshletTriangles[i0];
-								const uint8_t  vertIdx1 = meshletTriangles[i1];
-								const uint8_t  vertIdx2 = meshletTriangles[i2];
-								const uint32_t packedIdx = ((static_cast<uint32_t>(vertIdx0) & 0xFF) << 0) |
-														   ((static_cast<uint32_t>(vertIdx1) & 0xFF) << 8) |
-														   ((static_cast<uint32_t>(vertIdx2) & 0xFF) << 16);
+						meshletCount = GetMeshDispatchMeshletCount(meshRecords[0]);
 
-								meshletTrianglesU32.push_back(packedIdx);
-							}
+#ifdef USE_AMPLIFICATIONSHADER
+						// Every LOD is indexed through the payload entries, the instances get the remaining bits.
+						payloadMeshletIndexBits = std::max(static_cast<uint32_t>(std::bit_width(meshlets.size() - 1u)), 1u);
+
+#ifdef USE_INSTANCING
+						if (payloadMeshletIndexBits >= 32u || instanceCount > (1ull << (32u - payloadMeshletIndexBits)))
+						{
+							SA_LOG((L"%1 instances of %2 meshlets don't fit in the amplification payload entries (%3 meshlet index bits).", instanceCount, meshlets.size(), payloadMeshletIndexBits), Error, DX12);
+							return EXIT_FAILURE;
+						}
 
-							// Update triangle offset for current meshlet
-							meshlet.triangle_offset = triangleOffset;
+						// Every meshlet chunk of every instance in a single dispatch (the instance culling pass dispatches fewer).
+						const uint64_t asGroupCount = (totalChunkCount * meshletChunkSize + asGroupSize - 1u) / asGroupSize;
+						const uint64_t asDispatchedGroupCount = asGroupCount <= asDispatchGroupCountX ? asGroupCount :
+							((asGroupCount + asDispatchGroupCountX - 1u) / asDispatchGroupCountX) * asDispatchGroupCountX;
+
+						if (asDispatchedGroupCount > maxDispatchMeshGroupCount)
+						{
+							SA_LOG((L"%1 instances (%2 meshlet chunks) exceed the amplification dispatch limit (%3 groups of %4).", instanceCount, totalChunkCount, maxDispatchMeshGroupCount, asGroupSize), Error, DX12);
+							return EXIT_FAILURE;
 						}
+#endif // USE_INSTANCING
+#endif // USE_AMPLIFICATIONSHADER
+
+						meshletChunkCount = static_cast<uint32_t>(totalChunkCount);
 
 						// Meshlet
 						{
@@ -2354,7 +4134,7 @@ int main()
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(meshopt_Meshlet) * meshlets.size(),
+								.Width = meshlets.size_bytes(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2393,7 +4173,7 @@ int main()
 									.Buffer{
 										.FirstElement = 0,
 										.NumElements = static_cast<UINT>(meshlets.size()),
-										.StructureByteStride = sizeof(meshopt_Meshlet),
+										.StructureByteStride = sizeof(meshlets[0]),
 									},
 								};
 								device->CreateShaderResourceView(meshletBuffer.Get(), &viewDesc, cpuHandle);
@@ -2410,7 +4190,7 @@ int main()
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(unsigned int) * meshletVertices.size(),
+								.Width = meshletVertices.size_bytes(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2448,7 +4228,7 @@ int main()
 									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
 									.Buffer{
 										.FirstElement = 0,
-										.NumElements = static_cast<UINT>(meshletVertices.size()),
+										.NumElements = static_cast<UINT>(meshletVertices.size_bytes() / sizeof(unsigned int)),
 										.StructureByteStride = sizeof(unsigned int),
 									},
 								};
@@ -2466,7 +4246,7 @@ int main()
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(unsigned int) * meshletTrianglesU32.size(),
+								.Width = meshletTriangles.size_bytes(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2490,7 +4270,7 @@ int main()
 								SA_LOG(L"Create Meshlet Triangles Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, meshletTrianglesBuffer.Get()));
 							}
 
-							const bool bSubmitSuccess = SubmitBufferToGPU(meshletTrianglesBuffer, desc.Width, meshletTrianglesU32.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+							const bool bSubmitSuccess = SubmitBufferToGPU(meshletTrianglesBuffer, desc.Width, meshletTriangles.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
 							if (!bSubmitSuccess)
 							{
 								SA_LOG(L"Sphere Meshlet Triangles Buffer submit failed!", Error, DX12);
@@ -2504,7 +4284,7 @@ int main()
 									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
 									.Buffer{
 										.FirstElement = 0,
-										.NumElements = static_cast<UINT>(meshletTrianglesU32.size()),
+										.NumElements = static_cast<UINT>(meshletTriangles.size_bytes() / sizeof(unsigned int)),
 										.StructureByteStride = sizeof(unsigned int),
 									},
 								};
@@ -2522,7 +4302,7 @@ int main()
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(Vertex) * inMesh->mNumVertices,
+								.Width = vertices.size_bytes(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2532,7 +4312,7 @@ int main()
 								.Flags = D3D12_RESOURCE_FLAG_NONE,
 							};
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[0]));
+							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffer));
 							if (FAILED(hrBufferCreated))
 							{
 								SA_LOG(L"Create Vertex Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
@@ -2541,30 +4321,12 @@ int main()
 							else
 							{
 								const LPCWSTR name = L"VertexBuffer";
-								sphereVertexBuffers[0]->SetName(name);
+								sphereVertexBuffer->SetName(name);
 
-								SA_LOG(L"Create Vertex Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, sphereVertexBuffers[0].Get()));
+								SA_LOG(L"Create Vertex Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, sphereVertexBuffer.Get()));
 							}
 
-							std::vector<Vertex> vertices;
-							vertices.reserve(inMesh->mNumVertices);
-
-							for (uint32_t i = 0; i < inMesh->mNumVertices; ++i)
-							{
-								const aiVector3D& inPosition = inMesh->mVertices[i];
-								const aiVector3D& inNormal = inMesh->mNormals[i];
-								const aiVector3D& inTangent = inMesh->mTangents[i];
-								const aiVector3D& inTexCoords = inMesh->mTextureCoords[0][i];
-
-								Vertex vert;
-								vert.position = SA::Vec3f(inPosition.x, inPosition.y, inPosition.z);
-								vert.normal = SA::Vec3f(inNormal.x, inNormal.y, inNormal.z);
-								vert.tangent = SA::Vec3f(inTangent.x, inTangent.y, inTangent.z);
-								vert.uv = SA::Vec2f(inTexCoords.x, inTexCoords.y);
-								vertices.push_back(vert);
-							}
-
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[0], desc.Width, vertices.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffer, desc.Width, vertices.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
 							if (!bSubmitSuccess)
 							{
 								SA_LOG(L"Sphere Position submit failed!", Error, DX12);
@@ -2579,10 +4341,10 @@ int main()
 									.Buffer{
 										.FirstElement = 0,
 										.NumElements = static_cast<UINT>(vertices.size()),
-										.StructureByteStride = sizeof(Vertex),
+										.StructureByteStride = sizeof(vertices[0]),
 									},
 								};
-								device->CreateShaderResourceView(sphereVertexBuffers[0].Get(), &viewDesc, cpuHandle);
+								device->CreateShaderResourceView(sphereVertexBuffer.Get(), &viewDesc, cpuHandle);
 								cpuHandle.ptr += srvOffset;
 							}
 						}
@@ -2596,7 +4358,7 @@ int main()
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(SA::Vec4f) * meshletBounds.size(),
+								.Width = sizeof(MeshletCooker::MeshletBounds) * meshletBounds.size(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2635,7 +4397,7 @@ int main()
 									.Buffer{
 										.FirstElement = 0,
 										.NumElements = static_cast<UINT>(meshletBounds.size()),
-										.StructureByteStride = sizeof(SA::Vec4f),
+										.StructureByteStride = sizeof(MeshletCooker::MeshletBounds),
 									},
 								};
 								device->CreateShaderResourceView(meshletBoundsBuffer.Get(), &viewDesc, cpuHandle);
@@ -2643,16 +4405,9 @@ int main()
 							}
 						}
 #endif // USE_CULLING
-#else // USE_MESHSHADER
-						// Position
+#ifdef USE_CLUSTER_LOD
+						// Meshlet LODs
 						{
-							/**
-							* VkMemoryPropertyFlagBits -> D3D12_HEAP_PROPERTIES.Type
-							* Defines if a buffer is GPU only, CPU-GPU, ...
-							* In Vulkan, a buffer can be GPU only or CPU-GPU for data transfer (read and write).
-							* In DirectX12, a buffer is either GPU only (default), 'Upload' for data transfer from CPU to GPU, or 'Readback' for data transfer from GPU to CPU.
-							* 'Upload' and 'Readback' at the same time is NOT possible.
-							*/
 							const D3D12_HEAP_PROPERTIES heap{
 								.Type = D3D12_HEAP_TYPE_DEFAULT, // Type Default is GPU only.
 							};
@@ -2660,7 +4415,7 @@ int main()
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(SA::Vec3f) * inMesh->mNumVertices,
+								.Width = meshletLods.size_bytes(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2670,44 +4425,111 @@ int main()
 								.Flags = D3D12_RESOURCE_FLAG_NONE,
 							};
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[0]));
+							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&meshletLodBuffer));
 							if (FAILED(hrBufferCreated))
 							{
-								SA_LOG(L"Create Sphere Vertex Position Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+								SA_LOG(L"Create Meshlet LOD Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
 								return EXIT_FAILURE;
 							}
 							else
 							{
-								const LPCWSTR name = L"SphereVertexPositionBuffer";
-								sphereVertexBuffers[0]->SetName(name);
+								const LPCWSTR name = L"MeshletLodBuffer";
+								meshletLodBuffer->SetName(name);
 
-								SA_LOG(L"Create Sphere Vertex Position Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, sphereVertexBuffers[0].Get()));
+								SA_LOG(L"Create Meshlet LOD Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, meshletLodBuffer.Get()));
 							}
 
-							sphereVertexBufferViews[0] = D3D12_VERTEX_BUFFER_VIEW{
-								.BufferLocation = sphereVertexBuffers[0]->GetGPUVirtualAddress(),
-								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.StrideInBytes = sizeof(SA::Vec3f),
+							const bool bSubmitSuccess = SubmitBufferToGPU(meshletLodBuffer, desc.Width, meshletLods.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+							if (!bSubmitSuccess)
+							{
+								SA_LOG(L"Sphere Meshlet LOD Buffer submit failed!", Error, DX12);
+								return EXIT_FAILURE;
+							}
+
+							// Create View /* 0011-I-8 */
+							{
+								D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
+									.ViewDimension = D3D12_SRV_DIMENSION_BUFFER,
+									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+									.Buffer{
+										.FirstElement = 0,
+										.NumElements = static_cast<UINT>(meshletLods.size()),
+										.StructureByteStride = sizeof(MeshletCooker::MeshletLod),
+									},
+								};
+								device->CreateShaderResourceView(meshletLodBuffer.Get(), &viewDesc, cpuHandle);
+								cpuHandle.ptr += srvOffset;
+							}
+						}
+#endif // USE_CLUSTER_LOD
+#ifdef USE_DISCRETE_LOD
+						// Mesh LODs
+						{
+							const D3D12_HEAP_PROPERTIES heap{
+								.Type = D3D12_HEAP_TYPE_DEFAULT, // Type Default is GPU only.
+							};
+
+							const D3D12_RESOURCE_DESC desc{
+								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+								.Alignment = 0,
+								.Width = meshLods.size_bytes(),
+								.Height = 1,
+								.DepthOrArraySize = 1,
+								.MipLevels = 1,
+								.Format = DXGI_FORMAT_UNKNOWN,
+								.SampleDesc = {.Count = 1, .Quality = 0 },
+								.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+								.Flags = D3D12_RESOURCE_FLAG_NONE,
 							};
 
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[0], desc.Width, inMesh->mVertices, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&meshLodBuffer));
+							if (FAILED(hrBufferCreated))
+							{
+								SA_LOG(L"Create Mesh LOD Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+								return EXIT_FAILURE;
+							}
+							else
+							{
+								const LPCWSTR name = L"MeshLodBuffer";
+								meshLodBuffer->SetName(name);
+
+								SA_LOG(L"Create Mesh LOD Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, meshLodBuffer.Get()));
+							}
+
+							const bool bSubmitSuccess = SubmitBufferToGPU(meshLodBuffer, desc.Width, meshLods.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
 							if (!bSubmitSuccess)
 							{
-								SA_LOG(L"Sphere Vertex Position Buffer submit failed!", Error, DX12);
+								SA_LOG(L"Mesh LOD Buffer submit failed!", Error, DX12);
 								return EXIT_FAILURE;
 							}
+
+							// Create View /* 0011-I-8 */
+							{
+								D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
+									.ViewDimension = D3D12_SRV_DIMENSION_BUFFER,
+									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+									.Buffer{
+										.FirstElement = 0,
+										.NumElements = static_cast<UINT>(meshLods.size()),
+										.StructureByteStride = sizeof(MeshletCooker::MeshLod),
+									},
+								};
+								device->CreateShaderResourceView(meshLodBuffer.Get(), &viewDesc, cpuHandle);
+								cpuHandle.ptr += srvOffset;
+							}
 						}
+#endif // USE_DISCRETE_LOD
 
-						// Normal
+						// Mesh records (root SRV, no view)
 						{
 							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
+								.Type = D3D12_HEAP_TYPE_DEFAULT, // Type Default is GPU only.
 							};
 
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(SA::Vec3f) * inMesh->mNumVertices,
+								.Width = meshRecords.size_bytes(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2717,44 +4539,40 @@ int main()
 								.Flags = D3D12_RESOURCE_FLAG_NONE,
 							};
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[1]));
+							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&meshRecordBuffer));
 							if (FAILED(hrBufferCreated))
 							{
-								SA_LOG(L"Create Sphere Vertex Normal Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+								SA_LOG(L"Create Mesh Record Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
 								return EXIT_FAILURE;
 							}
 							else
 							{
-								const LPCWSTR name = L"SphereVertexNormalBuffer";
-								sphereVertexBuffers[1]->SetName(name);
+								const LPCWSTR name = L"MeshRecordBuffer";
+								meshRecordBuffer->SetName(name);
 
-								SA_LOG(L"Create Sphere Vertex Normal Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, sphereVertexBuffers[1].Get()));
+								SA_LOG(L"Create Mesh Record Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, meshRecordBuffer.Get()));
 							}
 
-							sphereVertexBufferViews[1] = D3D12_VERTEX_BUFFER_VIEW{
-								.BufferLocation = sphereVertexBuffers[1]->GetGPUVirtualAddress(),
-								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.StrideInBytes = sizeof(SA::Vec3f),
-							};
-
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[1], desc.Width, inMesh->mNormals, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+							const bool bSubmitSuccess = SubmitBufferToGPU(meshRecordBuffer, desc.Width, meshRecords.data(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 							if (!bSubmitSuccess)
 							{
-								SA_LOG(L"Sphere Vertex Normal Buffer submit failed!", Error, DX12);
+								SA_LOG(L"Mesh Record Buffer submit failed!", Error, DX12);
 								return EXIT_FAILURE;
 							}
 						}
 
-						// Tangent
+						const std::span<const InstanceMesh> instanceMeshes = instanceMeshData;
+
+						// Instance meshes
 						{
 							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
+								.Type = D3D12_HEAP_TYPE_DEFAULT, // Type Default is GPU only.
 							};
 
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(SA::Vec3f) * inMesh->mNumVertices,
+								.Width = instanceMeshes.size_bytes(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2764,44 +4582,45 @@ int main()
 								.Flags = D3D12_RESOURCE_FLAG_NONE,
 							};
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[2]));
+							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&instanceMeshBuffer));
 							if (FAILED(hrBufferCreated))
 							{
-								SA_LOG(L"Create Sphere Vertex Tangent Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+								SA_LOG(L"Create Instance Mesh Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
 								return EXIT_FAILURE;
 							}
 							else
 							{
-								const LPCWSTR name = L"SphereVertexTangentBuffer";
-								sphereVertexBuffers[2]->SetName(name);
+								const LPCWSTR name = L"InstanceMeshBuffer";
+								instanceMeshBuffer->SetName(name);
 
-								SA_LOG(L"Create Sphere Vertex Tangent Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, sphereVertexBuffers[2].Get()));
+								SA_LOG(L"Create Instance Mesh Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, instanceMeshBuffer.Get()));
 							}
 
-							sphereVertexBufferViews[2] = D3D12_VERTEX_BUFFER_VIEW{
-								.BufferLocation = sphereVertexBuffers[2]->GetGPUVirtualAddress(),
-								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.StrideInBytes = sizeof(SA::Vec3f),
-							};
-
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[2], desc.Width, inMesh->mTangents, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+							const bool bSubmitSuccess = SubmitBufferToGPU(instanceMeshBuffer, desc.Width, instanceMeshes.data(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 							if (!bSubmitSuccess)
 							{
-								SA_LOG(L"Sphere Vertex Tangent Buffer submit failed!", Error, DX12);
+								SA_LOG(L"Instance Mesh Buffer submit failed!", Error, DX12);
 								return EXIT_FAILURE;
 							}
 						}
-
-						// UV
+#else // USE_MESHSHADER
+						// Vertex
 						{
+							/**
+							* VkMemoryPropertyFlagBits -> D3D12_HEAP_PROPERTIES.Type
+							* Defines if a buffer is GPU only, CPU-GPU, ...
+							* In Vulkan, a buffer can be GPU only or CPU-GPU for data transfer (read and write).
+							* In DirectX12, a buffer is either GPU only (default), 'Upload' for data transfer from CPU to GPU, or 'Readback' for data transfer from GPU to CPU.
+							* 'Upload' and 'Readback' at the same time is NOT possible.
+							*/
 							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
+								.Type = D3D12_HEAP_TYPE_DEFAULT, // Type Default is GPU only.
 							};
 
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(SA::Vec2f) * inMesh->mNumVertices,
+								.Width = sizeof(Vertex) * vertices.size(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2811,38 +4630,43 @@ int main()
 								.Flags = D3D12_RESOURCE_FLAG_NONE,
 							};
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[3]));
+							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffer));
 							if (FAILED(hrBufferCreated))
 							{
-								SA_LOG(L"Create Sphere Vertex UV Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+								SA_LOG(L"Create Sphere Vertex Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
 								return EXIT_FAILURE;
 							}
 							else
 							{
-								const LPCWSTR name = L"SphereVertexUVBuffer";
-								sphereVertexBuffers[3]->SetName(name);
+								const LPCWSTR name = L"SphereVertexBuffer";
+								sphereVertexBuffer->SetName(name);
 
-								SA_LOG(L"Create Sphere Vertex UV Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, sphereVertexBuffers[3].Get()));
+								SA_LOG(L"Create Sphere Vertex Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, sphereVertexBuffer.Get()));
 							}
 
-							sphereVertexBufferViews[3] = D3D12_VERTEX_BUFFER_VIEW{
-								.BufferLocation = sphereVertexBuffers[3]->GetGPUVirtualAddress(),
-								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.StrideInBytes = sizeof(SA::Vec2f),
+							/**
+							* Cooked vertices are interleaved: keep 1 input slot per attribute by offsetting each view in the same buffer.
+							*/
+							const UINT attributeOffsets[] = {
+								offsetof(Vertex, position),
+								offsetof(Vertex, normal),
+								offsetof(Vertex, tangent),
+								offsetof(Vertex, uv),
 							};
 
-							std::vector<SA::Vec2f> uvs;
-							uvs.reserve(inMesh->mNumVertices);
-
-							for (uint32_t i = 0; i < inMesh->mNumVertices; ++i)
+							for (size_t i = 0; i < sphereVertexBufferViews.size(); ++i)
 							{
-								uvs.push_back(SA::Vec2f{ inMesh->mTextureCoords[0][i].x, inMesh->mTextureCoords[0][i].y });
+								sphereVertexBufferViews[i] = D3D12_VERTEX_BUFFER_VIEW{
+									.BufferLocation = sphereVertexBuffer->GetGPUVirtualAddress() + attributeOffsets[i],
+									.SizeInBytes = static_cast<UINT>(desc.Width) - attributeOffsets[i],
+									.StrideInBytes = sizeof(Vertex),
+								};
 							}
 
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[3], desc.Width, uvs.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffer, desc.Width, vertices.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
 							if (!bSubmitSuccess)
 							{
-								SA_LOG(L"Sphere Vertex UV Buffer submit failed!", Error, DX12);
+								SA_LOG(L"Sphere Vertex Buffer submit failed!", Error, DX12);
 								return EXIT_FAILURE;
 							}
 						}
@@ -2857,7 +4681,7 @@ int main()
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(uint16_t) * inMesh->mNumFaces * 3,
+								.Width = sizeof(uint32_t) * indices.size(),
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -2884,7 +4708,7 @@ int main()
 							sphereIndexBufferView = D3D12_INDEX_BUFFER_VIEW{
 								.BufferLocation = sphereIndexBuffer->GetGPUVirtualAddress(),
 								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.Format = DXGI_FORMAT_R16_UINT, // This model's indices are lower than 65535.
+								.Format = DXGI_FORMAT_R32_UINT, // Cooked indices are always 32 bits.
 							};
 
 							const bool bSubmitSuccess = SubmitBufferToGPU(sphereIndexBuffer, desc.Width, indices.data(), D3D12_RESOURCE_STATE_INDEX_BUFFER);
@@ -3233,23 +5057,214 @@ int main()
 							stbi_image_free(inData);
 
 
-							// Create View /* 0011-I-5 */
-							{
-								D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
-									.Format = DXGI_FORMAT_R8_UNORM,
-									.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
-									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
-									.Texture2D{
-										.MipLevels = mipLevels,
-									},
-								};
+							// Create View /* 0011-I-5 */
+							{
+								D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
+									.Format = DXGI_FORMAT_R8_UNORM,
+									.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
+									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+									.Texture2D{
+										.MipLevels = mipLevels,
+									},
+								};
+
+								device->CreateShaderResourceView(rustedIron2RoughnessTexture.Get(), &viewDesc, cpuHandle);
+								cpuHandle.ptr += srvOffset;
+							}
+						}
+					}
+				}
+
+#ifdef USE_INSTANCE_CULLING
+				// Visible Instance Buffers (after the geometry pool: sized by the meshlet chunks of every instance)
+				{
+					const D3D12_HEAP_PROPERTIES heap{
+						.Type = D3D12_HEAP_TYPE_DEFAULT,
+					};
+
+					const D3D12_RESOURCE_DESC desc{
+						.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+						.Alignment = 0,
+						.Width = sizeof(VisibleInstanceHeader) + uint64_t(meshletChunkCount) * 2u * sizeof(uint32_t),
+						.Height = 1,
+						.DepthOrArraySize = 1,
+						.MipLevels = 1,
+						.Format = DXGI_FORMAT_UNKNOWN,
+						.SampleDesc = {.Count = 1, .Quality = 0 },
+						.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+						.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS,
+					};
+
+					const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&visibleInstanceBuffer));
+					if (FAILED(hrBufferCreated))
+					{
+						SA_LOG(L"Create Visible Instance Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						const LPCWSTR name = L"VisibleInstanceBuffer";
+						visibleInstanceBuffer->SetName(name);
+
+						SA_LOG(L"Create Visible Instance Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, visibleInstanceBuffer.Get()));
+					}
+
+
+					const D3D12_HEAP_PROPERTIES resetHeap{
+						.Type = D3D12_HEAP_TYPE_UPLOAD,
+					};
+
+					const D3D12_RESOURCE_DESC resetDesc{
+						.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+						.Alignment = 0,
+						.Width = sizeof(VisibleInstanceHeader),
+						.Height = 1,
+						.DepthOrArraySize = 1,
+						.MipLevels = 1,
+						.Format = DXGI_FORMAT_UNKNOWN,
+						.SampleDesc = {.Count = 1, .Quality = 0 },
+						.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+						.Flags = D3D12_RESOURCE_FLAG_NONE,
+					};
+
+					const HRESULT hrResetBufferCreated = device->CreateCommittedResource(&resetHeap, D3D12_HEAP_FLAG_NONE, &resetDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&visibleInstanceResetBuffer));
+					if (FAILED(hrResetBufferCreated))
+					{
+						SA_LOG(L"Create Visible Instance Reset Buffer failed!", Error, DX12, (L"Error code: %1", hrResetBufferCreated));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						const LPCWSTR name = L"VisibleInstanceResetBuffer";
+						visibleInstanceResetBuffer->SetName(name);
+
+						SA_LOG(L"Create Visible Instance Reset Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, visibleInstanceResetBuffer.Get()));
+					}
+
+					// No instance visible: ThreadGroupCountX = 0.
+					const VisibleInstanceHeader resetHeader{};
+
+					const D3D12_RANGE range{ .Begin = 0, .End = 0 };
+					void* data = nullptr;
+
+					visibleInstanceResetBuffer->Map(0, &range, reinterpret_cast<void**>(&data));
+					std::memcpy(data, &resetHeader, sizeof(VisibleInstanceHeader));
+					visibleInstanceResetBuffer->Unmap(0, nullptr);
+				}
+#endif // USE_INSTANCE_CULLING
+
+#ifdef USE_OCCLUSION_CULLING
+				// Occlusion Culling
+				{
+					// Visibility Bits Buffer
+					{
+						const D3D12_HEAP_PROPERTIES heap{
+							.Type = D3D12_HEAP_TYPE_DEFAULT,
+						};
+
+						// Committed resources are zeroed: nothing is visible on the first early phase.
+						const uint64_t instanceWordCount = (instanceCount + 31u) / 32u;
+						static_assert(meshletChunkSize == 32u, "1 visibility word per meshlet chunk");
+						const uint64_t meshletWordCount = meshletChunkCount;
+
+						const D3D12_RESOURCE_DESC desc{
+							.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+							.Alignment = 0,
+							.Width = (instanceWordCount + meshletWordCount) * sizeof(uint32_t),
+							.Height = 1,
+							.DepthOrArraySize = 1,
+							.MipLevels = 1,
+							.Format = DXGI_FORMAT_UNKNOWN,
+							.SampleDesc = {.Count = 1, .Quality = 0 },
+							.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+							.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS,
+						};
+
+						const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&visibilityBitsBuffer));
+						if (FAILED(hrBufferCreated))
+						{
+							SA_LOG(L"Create Visibility Bits Buffer failed!", Error, DX12, (L"Error code: %1", hrBufferCreated));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							const LPCWSTR name = L"VisibilityBitsBuffer";
+							visibilityBitsBuffer->SetName(name);
+
+							SA_LOG(L"Create Visibility Bits Buffer success.", Info, DX12, (L"\"%1\" [%2]", name, visibilityBitsBuffer.Get()));
+						}
+					}
+
+					// Depth Pyramid Views (after the point lights, PBR textures and meshlet views)
+					{
+						const UINT srvOffset = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+						D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = pbrSphereSRVHeap->GetCPUDescriptorHandleForHeapStart();
+						cpuHandle.ptr += srvOffset * pbrSphereSRVCount;
+
+						// Scene depth
+						{
+							const D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
+								.Format = DXGI_FORMAT_R16_UNORM,
+								.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
+								.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+								.Texture2D{
+									.MipLevels = 1,
+								},
+							};
+
+							device->CreateShaderResourceView(sceneDepthTexture.Get(), &viewDesc, cpuHandle);
+							cpuHandle.ptr += srvOffset;
+						}
+
+						// Depth pyramid (every mip)
+						{
+							const D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
+								.Format = depthPyramidFormat,
+								.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
+								.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+								.Texture2D{
+									.MipLevels = depthPyramidMipCount,
+								},
+							};
+
+							device->CreateShaderResourceView(depthPyramidTexture.Get(), &viewDesc, cpuHandle);
+							cpuHandle.ptr += srvOffset;
+						}
+
+						// Depth pyramid mips: reduction sources.
+						for (uint32_t i = 0u; i < depthPyramidMipCount; ++i)
+						{
+							const D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
+								.Format = depthPyramidFormat,
+								.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
+								.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+								.Texture2D{
+									.MostDetailedMip = i,
+									.MipLevels = 1,
+								},
+							};
+
+							device->CreateShaderResourceView(depthPyramidTexture.Get(), &viewDesc, cpuHandle);
+							cpuHandle.ptr += srvOffset;
+						}
+
+						// Depth pyramid mips: reduction destinations.
+						for (uint32_t i = 0u; i < depthPyramidMipCount; ++i)
+						{
+							const D3D12_UNORDERED_ACCESS_VIEW_DESC viewDesc{
+								.Format = depthPyramidFormat,
+								.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D,
+								.Texture2D{
+									.MipSlice = i,
+								},
+							};
 
-								device->CreateShaderResourceView(rustedIron2RoughnessTexture.Get(), &viewDesc, cpuHandle);
-								cpuHandle.ptr += srvOffset;
-							}
+							device->CreateUnorderedAccessView(depthPyramidTexture.Get(), nullptr, &viewDesc, cpuHandle);
+							cpuHandle.ptr += srvOffset;
 						}
 					}
 				}
+#endif // USE_OCCLUSION_CULLING
 			}
 
 
@@ -3356,59 +5371,82 @@ int main()
 
 					// Set the fence value for the next frame.
 					swapchainFenceValues[swapchainFrameIndex] = prevFenceValue + 1;
+
+					++frameNumber;
 				}
 
+#ifdef USE_CULLING_STATS
+				// Counters of the last frame recorded in this slot (bufferingCount frames ago).
+				ReadCullingStats(swapchainFrameIndex);
+#endif // USE_CULLING_STATS
+
+
+#ifdef USE_INSTANCING
+				// Animate instances: the rotated window slides over the instances, only its ranges are uploaded.
+				if (animatedInstanceFraction > 0.0f)
+				{
+					animationTime += deltaTime * 0.001f;
+
+					const uint32_t animatedCount = std::max(static_cast<uint32_t>(animatedInstanceFraction * instanceCount), 1u);
+
+					for (uint32_t i = 0u; i < animatedCount; ++i)
+					{
+						const uint32_t index = (animatedInstanceCursor + i) % instanceCount;
+						const float halfAngle = 0.5f * (animationTime + 0.1f * index);
+
+						sceneObjects[index] = MakeObjectUBO(GetInstanceGridPosition(index), SA::Quatf(std::cos(halfAngle), 0.0f, std::sin(halfAngle), 0.0f));
+						sceneObjectsDirty.MarkDirty(index);
+					}
+
+					animatedInstanceCursor = (animatedInstanceCursor + animatedCount) % instanceCount;
+				}
+#endif // USE_INSTANCING
 
 				// Update scene.
 				auto sceneBuffer = sceneBuffers[swapchainFrameIndex];
 				{
 
+#ifdef USE_MULTI_VIEW
+					// Each view covers 1 / multiViewCount of the window width.
+					const float windowsAspect = float(windowSize.x) / float(windowSize.y * multiViewCount);
+#else
 					const float windowsAspect = float(windowSize.x) / float(windowSize.y);
-					const SA::Mat4f perspective = SA::Mat4f::MakePerspective(cameraFOV, windowsAspect, cameraNear, cameraFar);
-					const SA::Mat4f cameraTransform = cameraTr.Matrix();
-					const SA::Mat4f viewMatrix = cameraTransform.GetInversed();
-					const SA::Mat4f viewProjection = perspective * viewMatrix;
-					const SA::Mat4f invViewProjection = viewProjection.GetInversed();
+#endif
 
 					// Fill Data with updated values.
 					SceneUBO sceneUBO;
-					sceneUBO.camera.view = cameraTransform;
-					sceneUBO.camera.invViewProj = viewProjection;
+					FillSceneCamera(sceneUBO.camera, cameraTr, windowsAspect);
 
-#if defined(USE_MESHSHADER) && defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
-					const SA::Vec3f viewDirection = cameraTr.Forward().GetNormalized();
-
-					FrustumPlane planeLeft, planeRight, planeTop, planeBottom, planeNear, planeFar;
-					GetFrustumPlanes(invViewProjection, viewDirection, &planeLeft, &planeRight, &planeTop, &planeBottom, &planeNear, &planeFar);
-					sceneUBO.camera.frustum.planes[FRUSTUM_PLANE_LEFT]	 = { planeLeft.normal,	 0.0f, planeLeft.position,   0.0f };
-					sceneUBO.camera.frustum.planes[FRUSTUM_PLANE_RIGHT]  = { planeRight.normal,  0.0f, planeRight.position,  0.0f };
-					sceneUBO.camera.frustum.planes[FRUSTUM_PLANE_TOP]	 = { planeTop.normal,	 0.0f, planeTop.position,    0.0f };
-					sceneUBO.camera.frustum.planes[FRUSTUM_PLANE_BOTTOM] = { planeBottom.normal, 0.0f, planeBottom.position, 0.0f };
-					sceneUBO.camera.frustum.planes[FRUSTUM_PLANE_NEAR]	 = { planeNear.normal,	 0.0f, planeNear.position,   0.0f };
-					sceneUBO.camera.frustum.planes[FRUSTUM_PLANE_FAR]	 = { planeFar.normal,	 0.0f, planeFar.position,    0.0f };
-
-					FrustumCone cone = GetFrustumCone(invViewProjection, cameraTr.position, viewDirection, cameraFar, cameraFOV, true);
-					
-					sceneUBO.camera.frustum.cone =
+#ifdef USE_MULTI_VIEW
+					for (uint32_t i = 0; i < multiViewCount; ++i)
 					{
-						.tipPosition = cone.tipPosition,
-						.height = cone.height,
-						.direction = cone.direction,
-						.angle = cone.angle
-					};
-					SA::Vec3f frustumBoundingSphereCenter;
-					float frustumBoundingSphereRadius;
-					GetFrustumSphere(invViewProjection, frustumBoundingSphereCenter, frustumBoundingSphereRadius);
+						SA::TransformPRf viewTr = cameraTr;
+						viewTr.position += (static_cast<float>(i) - 0.5f * static_cast<float>(multiViewCount - 1u)) * multiViewSeparation * cameraTr.Right();
+
+						FillSceneCamera(sceneUBO.views[i], viewTr, windowsAspect);
+					}
+#endif // USE_MULTI_VIEW
 
-					SA_LOG(frustumBoundingSphereCenter);
-					sceneUBO.camera.frustum.boundingSphere = SA::Vec4f(frustumBoundingSphereCenter, frustumBoundingSphereRadius);
+#if defined(USE_MESHSHADER) && defined(USE_AMPLIFICATIONSHADER) && defined(USE_CULLING)
+#ifdef USE_MULTI_VIEW
+					sceneUBO.screen.viewportSize = SA::Vec2f(multiViewViewports[0].Width, multiViewViewports[0].Height);
+#else
+					sceneUBO.screen.viewportSize = SA::Vec2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y));
+#endif
+					sceneUBO.screen.smallMeshletThreshold = smallMeshletThreshold;
 #endif // USE_MESHSHADER && USE_AMPLIFICATION_SHADER && USE_CULLING
 
 #ifdef USE_MESHSHADER
-					sceneUBO.meshletCount = static_cast<uint32_t>(meshletCount);
+#if defined(USE_CLUSTER_LOD) || defined(USE_DISCRETE_LOD)
+					sceneUBO.lod.errorScale = static_cast<float>(windowSize.y) / (2.0f * std::tan(SA::Maths::DegToRad<float> * cameraFOV / 2.0f));
+#endif
+					sceneUBO.meshletChunkCount = meshletChunkCount;
 #ifdef USE_INSTANCING
 					sceneUBO.instanceCount = static_cast<uint32_t>(instanceCount);
+					sceneUBO.asGroupSize = asGroupSize;
 #endif
+					sceneUBO.cullingFlags = cullingFlags;
+					sceneUBO.payloadMeshletIndexBits = payloadMeshletIndexBits;
 #endif
 					// Memory mapping and Upload (CPU to GPU transfer).
 					const D3D12_RANGE range{ .Begin = 0, .End = 0 };
@@ -3469,9 +5507,160 @@ int main()
 					}
 
 
+#ifdef USE_INSTANCING
+					/**
+					* Dirty instance upload
+					* The dirty ranges are written in this frame's ring slot and copied before any pass reads the objects.
+					* Earlier frames still in flight read sphereObjectsBuffer before this copy: same queue, ordered by the barriers.
+					*/
+					{
+						const uint32_t uploadCount = sceneObjectsDirty.TakeRanges(objectUploadMaxGap, objectUploadCapacity, objectUploadRanges);
+
+						if (uploadCount > 0u)
+						{
+							// Buffers decay to COMMON at the end of each ExecuteCommandLists.
+							{
+								const D3D12_RESOURCE_BARRIER barrier{
+									.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+									.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+									.Transition = {
+										.pResource = sphereObjectsBuffer.Get(),
+										.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+										.StateBefore = D3D12_RESOURCE_STATE_COMMON,
+										.StateAfter = D3D12_RESOURCE_STATE_COPY_DEST,
+									},
+								};
+
+								cmd->ResourceBarrier(1, &barrier);
+							}
+
+							// Ranges packed back to back in the ring slot.
+							ObjectUBO* const uploadData = objectUploadData[swapchainFrameIndex];
+							uint32_t uploadOffset = 0u;
+
+							for (const Renderer::InstanceRange& range : objectUploadRanges)
+							{
+								std::memcpy(uploadData + uploadOffset, sceneObjects.data() + range.first, range.count * sizeof(ObjectUBO));
+
+								cmd->CopyBufferRegion(sphereObjectsBuffer.Get(), uint64_t(range.first) * sizeof(ObjectUBO),
+									objectUploadBuffers[swapchainFrameIndex].Get(), uint64_t(uploadOffset) * sizeof(ObjectUBO), uint64_t(range.count) * sizeof(ObjectUBO));
+
+								uploadOffset += range.count;
+							}
+
+							{
+								const D3D12_RESOURCE_BARRIER barrier{
+									.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+									.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+									.Transition = {
+										.pResource = sphereObjectsBuffer.Get(),
+										.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+										.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST,
+										.StateAfter = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+									},
+								};
+
+								cmd->ResourceBarrier(1, &barrier);
+							}
+						}
+					}
+#endif // USE_INSTANCING
+
+#ifdef USE_INSTANCE_CULLING
+					/**
+					* Instance Culling
+					* First culling level: compacts the visible instances and writes the DispatchMesh arguments of the Lit Pipeline.
+					* USE_OCCLUSION_CULLING: recorded once per culling phase.
+					*/
+					const auto RecordInstanceCulling = [&](D3D12_RESOURCE_STATES _visibleInstanceState, [[maybe_unused]] uint32_t _cullingPhase)
+					{
+						// Reset ThreadGroupCountX and the visible instance count.
+						{
+							const D3D12_RESOURCE_BARRIER barrier{
+								.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+								.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+								.Transition = {
+									.pResource = visibleInstanceBuffer.Get(),
+									.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+									.StateBefore = _visibleInstanceState,
+									.StateAfter = D3D12_RESOURCE_STATE_COPY_DEST,
+								},
+							};
+
+							cmd->ResourceBarrier(1, &barrier);
+
+							cmd->CopyBufferRegion(visibleInstanceBuffer.Get(), 0, visibleInstanceResetBuffer.Get(), 0, sizeof(VisibleInstanceHeader));
+						}
+
+						{
+							const D3D12_RESOURCE_BARRIER barrier{
+								.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+								.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+								.Transition = {
+									.pResource = visibleInstanceBuffer.Get(),
+									.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+									.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST,
+									.StateAfter = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+								},
+							};
+
+							cmd->ResourceBarrier(1, &barrier);
+						}
+
+						cmd->SetComputeRootSignature(instanceCullingRootSign.Get());
+						cmd->SetComputeRootConstantBufferView(0, sceneBuffer->GetGPUVirtualAddress()); // Scene UBO
+						cmd->SetComputeRootShaderResourceView(1, sphereObjectsBuffer->GetGPUVirtualAddress()); // Objects
+						cmd->SetComputeRootUnorderedAccessView(2, visibleInstanceBuffer->GetGPUVirtualAddress()); // Visible instances
+
+#ifdef USE_OCCLUSION_CULLING
+						D3D12_GPU_DESCRIPTOR_HANDLE depthPyramidHandle = pbrSphereSRVHeap->GetGPUDescriptorHandleForHeapStart();
+						depthPyramidHandle.ptr += device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV) * (pbrSphereSRVCount + 1u);
+
+						cmd->SetComputeRoot32BitConstant(3, _cullingPhase, 0); // Culling phase
+						cmd->SetComputeRootDescriptorTable(4, depthPyramidHandle); // Depth pyramid
+						cmd->SetComputeRootUnorderedAccessView(5, visibilityBitsBuffer->GetGPUVirtualAddress()); // Visibility bits
+#endif // USE_OCCLUSION_CULLING
+
+						cmd->SetComputeRootShaderResourceView(instanceCullingGeometryPoolRootIndex, meshRecordBuffer->GetGPUVirtualAddress()); // Mesh records
+						cmd->SetComputeRootShaderResourceView(instanceCullingGeometryPoolRootIndex + 1u, instanceMeshBuffer->GetGPUVirtualAddress()); // Instance meshes
+
+#ifdef USE_CULLING_STATS
+						cmd->SetComputeRootUnorderedAccessView(instanceCullingStatsRootIndex, cullingStatsBuffer->GetGPUVirtualAddress()); // Culling stats
+#endif // USE_CULLING_STATS
+
+						cmd->SetPipelineState(instanceCullingPipelineState.Get());
+
+						// Must match INSTANCE_CULLING_GROUP_SIZE in MeshLitShader.hlsl.
+						constexpr UINT instanceCullingGroupSize = 64u;
+						cmd->Dispatch((static_cast<UINT>(instanceCount) + instanceCullingGroupSize - 1u) / instanceCullingGroupSize, 1u, 1u);
+
+						{
+							const D3D12_RESOURCE_BARRIER barrier{
+								.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+								.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+								.Transition = {
+									.pResource = visibleInstanceBuffer.Get(),
+									.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+									.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+									.StateAfter = D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+								},
+							};
+
+							cmd->ResourceBarrier(1, &barrier);
+						}
+					};
+#endif // USE_INSTANCE_CULLING
+
+
 					// Pipeline commons
+#ifdef USE_MULTI_VIEW
+					cmd->RSSetViewports(multiViewCount, multiViewViewports.data());
+					cmd->RSSetScissorRects(multiViewCount, multiViewScissorRects.data());
+					cmd->SetViewInstanceMask((1u << multiViewCount) - 1u);
+#else
 					cmd->RSSetViewports(1, &viewport);
 					cmd->RSSetScissorRects(1, &scissorRect);
+#endif // USE_MULTI_VIEW
 
 
 					// Lit Pipeline
@@ -3484,6 +5673,137 @@ int main()
 						ID3D12DescriptorHeap* descriptorHeaps[] = { pbrSphereSRVHeap.Get() };
 						cmd->SetDescriptorHeaps(_countof(descriptorHeaps), descriptorHeaps);
 
+#ifdef USE_CULLING_STATS
+						// Clear the counters of the frame.
+						{
+							{
+								const D3D12_RESOURCE_BARRIER barrier{
+									.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+									.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+									.Transition = {
+										.pResource = cullingStatsBuffer.Get(),
+										.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+										.StateBefore = D3D12_RESOURCE_STATE_COMMON,
+										.StateAfter = D3D12_RESOURCE_STATE_COPY_DEST,
+									},
+								};
+
+								cmd->ResourceBarrier(1, &barrier);
+							}
+
+							cmd->CopyBufferRegion(cullingStatsBuffer.Get(), 0, cullingStatsResetBuffer.Get(), 0, sizeof(CullingStats));
+
+							{
+								const D3D12_RESOURCE_BARRIER barrier{
+									.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+									.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+									.Transition = {
+										.pResource = cullingStatsBuffer.Get(),
+										.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+										.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST,
+										.StateAfter = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+									},
+								};
+
+								cmd->ResourceBarrier(1, &barrier);
+							}
+						}
+#endif // USE_CULLING_STATS
+
+#ifdef USE_OCCLUSION_CULLING
+						// Buffers decay to COMMON at the end of each ExecuteCommandLists.
+						{
+							const D3D12_RESOURCE_BARRIER barrier{
+								.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+								.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+								.Transition = {
+									.pResource = visibilityBitsBuffer.Get(),
+									.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+									.StateBefore = D3D12_RESOURCE_STATE_COMMON,
+									.StateAfter = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+								},
+							};
+
+							cmd->ResourceBarrier(1, &barrier);
+						}
+
+						RecordInstanceCulling(D3D12_RESOURCE_STATE_COMMON, CULLING_PHASE_EARLY);
+#elif defined(USE_INSTANCE_CULLING)
+						RecordInstanceCulling(D3D12_RESOURCE_STATE_COMMON, 0u);
+#elif defined(USE_INDIRECT_DRAW)
+						/**
+						* Indirect Culling
+						* Compacts the visible instances and writes the DrawIndexedInstanced arguments of the Lit Pipeline.
+						*/
+						{
+							// Reset the arguments and the visible instance count.
+							{
+								const D3D12_RESOURCE_BARRIER barrier{
+									.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+									.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+									.Transition = {
+										.pResource = indirectDrawBuffer.Get(),
+										.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+										.StateBefore = D3D12_RESOURCE_STATE_COMMON,
+										.StateAfter = D3D12_RESOURCE_STATE_COPY_DEST,
+									},
+								};
+
+								cmd->ResourceBarrier(1, &barrier);
+
+								cmd->CopyBufferRegion(indirectDrawBuffer.Get(), 0, indirectDrawResetBuffer.Get(), 0, sizeof(IndirectDrawHeader));
+							}
+
+							{
+								const D3D12_RESOURCE_BARRIER barrier{
+									.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+									.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+									.Transition = {
+										.pResource = indirectDrawBuffer.Get(),
+										.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+										.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST,
+										.StateAfter = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+									},
+								};
+
+								cmd->ResourceBarrier(1, &barrier);
+							}
+
+							IndirectCullingConstants constants;
+							constants.meshBoundingSphere = sphereBoundingSphere;
+							constants.instanceCount = static_cast<uint32_t>(instanceCount);
+							constants.cullingFlags = cullingFlags;
+							constants.indexCount = sphereIndexCount;
+
+							cmd->SetComputeRootSignature(indirectCullingRootSign.Get());
+							cmd->SetComputeRootConstantBufferView(0, sceneBuffer->GetGPUVirtualAddress()); // Scene UBO
+							cmd->SetComputeRootShaderResourceView(1, sphereObjectsBuffer->GetGPUVirtualAddress()); // Objects
+							cmd->SetComputeRoot32BitConstants(2, sizeof(IndirectCullingConstants) / sizeof(uint32_t), &constants, 0); // Indirect culling constants
+							cmd->SetComputeRootUnorderedAccessView(3, indirectDrawBuffer->GetGPUVirtualAddress()); // Indirect draw arguments
+
+							cmd->SetPipelineState(indirectCullingPipelineState.Get());
+
+							// Must match INDIRECT_CULLING_GROUP_SIZE in LitShader.hlsl.
+							constexpr UINT indirectCullingGroupSize = 64u;
+							cmd->Dispatch((static_cast<UINT>(instanceCount) + indirectCullingGroupSize - 1u) / indirectCullingGroupSize, 1u, 1u);
+
+							{
+								const D3D12_RESOURCE_BARRIER barrier{
+									.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+									.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+									.Transition = {
+										.pResource = indirectDrawBuffer.Get(),
+										.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+										.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+										.StateAfter = D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+									},
+								};
+
+								cmd->ResourceBarrier(1, &barrier);
+							}
+						}
+#endif // USE_OCCLUSION_CULLING
+
 
 						/**
 						* 0011-U-2
@@ -3491,7 +5811,7 @@ int main()
 						*/
 						cmd->SetGraphicsRootSignature(litRootSign.Get());
 						cmd->SetGraphicsRootConstantBufferView(0, sceneBuffer->GetGPUVirtualAddress()); // Scene UBO
-						cmd->SetGraphicsRootConstantBufferView(1, sphereObjectsBuffer->GetGPUVirtualAddress()); // Object UBO
+						cmd->SetGraphicsRootShaderResourceView(1, sphereObjectsBuffer->GetGPUVirtualAddress()); // Objects
 
 						const UINT srvOffset = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 						D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle = pbrSphereSRVHeap->GetGPUDescriptorHandleForHeapStart();
@@ -3512,29 +5832,194 @@ int main()
 
 #ifdef USE_MESHSHADER
 						gpuHandle.ptr += srvOffset * 4u;
-						cmd->SetGraphicsRootDescriptorTable(4, gpuHandle); // Meshlets, meshlet vertices, meshlet triangles, vertices, bounds
+						cmd->SetGraphicsRootDescriptorTable(4, gpuHandle); // Meshlets, meshlet vertices, meshlet triangles, vertices, bounds, LODs
 
-						UINT uMeshletCount = static_cast<UINT>(meshletCount);
+						cmd->SetGraphicsRootShaderResourceView(litGeometryPoolRootIndex, meshRecordBuffer->GetGPUVirtualAddress()); // Mesh records
+						cmd->SetGraphicsRootShaderResourceView(litGeometryPoolRootIndex + 1u, instanceMeshBuffer->GetGPUVirtualAddress()); // Instance meshes
 
-#ifdef USE_AMPLIFICATIONSHADER
-#ifdef USE_INSTANCING
-						UINT uInstanceCount = static_cast<UINT>(instanceCount);
+#ifdef USE_CULLING_STATS
+						cmd->SetGraphicsRootUnorderedAccessView(litCullingStatsRootIndex, cullingStatsBuffer->GetGPUVirtualAddress()); // Culling stats
+#endif // USE_CULLING_STATS
 
-						const UINT threadGroupCountX = (uMeshletCount * uInstanceCount / AS_GROUP_SIZE) + 1;
-#else
-						const UINT threadGroupCountX = (uMeshletCount / AS_GROUP_SIZE) + 1;
-#endif
+#ifdef USE_INSTANCE_CULLING
+						cmd->SetGraphicsRootShaderResourceView(5, visibleInstanceBuffer->GetGPUVirtualAddress()); // Visible instances
+
+#ifdef USE_OCCLUSION_CULLING
+						D3D12_GPU_DESCRIPTOR_HANDLE depthPyramidHandle = pbrSphereSRVHeap->GetGPUDescriptorHandleForHeapStart();
+						depthPyramidHandle.ptr += srvOffset * pbrSphereSRVCount;
+
+						cmd->SetGraphicsRoot32BitConstant(6, CULLING_PHASE_EARLY, 0); // Culling phase
+						cmd->SetGraphicsRootDescriptorTable(7, { depthPyramidHandle.ptr + srvOffset }); // Depth pyramid (every mip)
+						cmd->SetGraphicsRootUnorderedAccessView(8, visibilityBitsBuffer->GetGPUVirtualAddress()); // Visibility bits
+#endif // USE_OCCLUSION_CULLING
+
+						// Second culling level: the amplification shader only runs over the meshlets of the visible instances.
+						cmd->ExecuteIndirect(dispatchMeshCommandSignature.Get(), 1u, visibleInstanceBuffer.Get(), 0u, nullptr, 0u);
+
+#ifdef USE_OCCLUSION_CULLING
+						/**
+						* Depth Pyramid
+						* Reduction of the early phase depth: farthest depth per texel, one dispatch per mip.
+						*/
+						{
+							{
+								const D3D12_RESOURCE_BARRIER barriers[]{
+									{
+										.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+										.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+										.Transition = {
+											.pResource = sceneDepthTexture.Get(),
+											.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+											.StateBefore = D3D12_RESOURCE_STATE_DEPTH_WRITE,
+											.StateAfter = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+										},
+									},
+									{
+										.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+										.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+										.Transition = {
+											.pResource = depthPyramidTexture.Get(),
+											.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+											.StateBefore = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+											.StateAfter = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+										},
+									},
+								};
+
+								cmd->ResourceBarrier(_countof(barriers), barriers);
+							}
+
+							cmd->SetComputeRootSignature(depthPyramidRootSign.Get());
+							cmd->SetPipelineState(depthPyramidPipelineState.Get());
+
+							for (uint32_t i = 0u; i < depthPyramidMipCount; ++i)
+							{
+								const uint32_t sizes[4]{
+									i == 0u ? windowSize.x : std::max(depthPyramidWidth >> (i - 1u), 1u),
+									i == 0u ? windowSize.y : std::max(depthPyramidHeight >> (i - 1u), 1u),
+									std::max(depthPyramidWidth >> i, 1u),
+									std::max(depthPyramidHeight >> i, 1u),
+								};
+
+								// Scene depth, then the mip views (see Depth Pyramid Views).
+								const UINT64 sourceIndex = i == 0u ? 0u : 2u + (i - 1u);
+								const UINT64 destinationIndex = 2u + depthPyramidMipCount + i;
+
+								cmd->SetComputeRoot32BitConstants(0, _countof(sizes), sizes, 0);
+								cmd->SetComputeRootDescriptorTable(1, { depthPyramidHandle.ptr + srvOffset * sourceIndex });
+								cmd->SetComputeRootDescriptorTable(2, { depthPyramidHandle.ptr + srvOffset * destinationIndex });
+
+								cmd->Dispatch((sizes[2] + depthPyramidGroupSize - 1u) / depthPyramidGroupSize, (sizes[3] + depthPyramidGroupSize - 1u) / depthPyramidGroupSize, 1u);
+
+								// Source of the next mip.
+								const D3D12_RESOURCE_BARRIER barrier{
+									.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+									.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+									.Transition = {
+										.pResource = depthPyramidTexture.Get(),
+										.Subresource = i,
+										.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+										.StateAfter = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+									},
+								};
+
+								cmd->ResourceBarrier(1, &barrier);
+							}
+
+							{
+								const D3D12_RESOURCE_BARRIER barriers[]{
+									{
+										.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+										.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+										.Transition = {
+											.pResource = sceneDepthTexture.Get(),
+											.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+											.StateBefore = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+											.StateAfter = D3D12_RESOURCE_STATE_DEPTH_WRITE,
+										},
+									},
+									// Early phase bits read before the late phase writes.
+									{
+										.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV,
+										.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+										.UAV = {
+											.pResource = visibilityBitsBuffer.Get(),
+										},
+									},
+								};
+
+								cmd->ResourceBarrier(_countof(barriers), barriers);
+							}
+						}
+
+						// Late phase: instances and meshlets tested against the depth pyramid.
+						RecordInstanceCulling(D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, CULLING_PHASE_LATE);
+
+						{
+							const D3D12_RESOURCE_BARRIER barrier{
+								.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV,
+								.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+								.UAV = {
+									.pResource = visibilityBitsBuffer.Get(),
+								},
+							};
+
+							cmd->ResourceBarrier(1, &barrier);
+						}
+
+						cmd->SetPipelineState(litPipelineState.Get());
+						cmd->SetGraphicsRoot32BitConstant(6, CULLING_PHASE_LATE, 0); // Culling phase
+
+						cmd->ExecuteIndirect(dispatchMeshCommandSignature.Get(), 1u, visibleInstanceBuffer.Get(), 0u, nullptr, 0u);
+#endif // USE_OCCLUSION_CULLING
+#else // USE_INSTANCE_CULLING
+#ifdef USE_AMPLIFICATIONSHADER
+						// Every meshlet chunk of every instance (of mesh 0 without USE_INSTANCING).
+						const UINT threadGroupCount = (meshletChunkCount * meshletChunkSize + asGroupSize - 1) / asGroupSize;
+						// Rows of asDispatchGroupCountX groups, see mainAS.
+						const UINT threadGroupCountX = std::min(threadGroupCount, asDispatchGroupCountX);
+						const UINT threadGroupCountY = (threadGroupCount + asDispatchGroupCountX - 1) / asDispatchGroupCountX;
 #else // USE_AMPLIFICATIONSHADER
-						const UINT threadGroupCountX = uMeshletCount;
+						const UINT threadGroupCountX = meshletCount;
+						const UINT threadGroupCountY = 1u;
 #endif // USE_AMPLIFICATIONSHADER
-						cmd->DispatchMesh(threadGroupCountX, 1u, 1u);
+						cmd->DispatchMesh(threadGroupCountX, threadGroupCountY, 1u);
+#endif // USE_INSTANCE_CULLING
 #else // USE_MESHSHADER
 						// Draw Sphere
 						cmd->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 						cmd->IASetVertexBuffers(0, static_cast<UINT>(sphereVertexBufferViews.size()), sphereVertexBufferViews.data());
 						cmd->IASetIndexBuffer(&sphereIndexBufferView);
+#ifdef USE_INDIRECT_DRAW
+						cmd->SetGraphicsRootShaderResourceView(4, indirectDrawBuffer->GetGPUVirtualAddress()); // Visible instances
+
+						// Every visible instance in a single draw: InstanceCount written by the indirect culling pass.
+						cmd->ExecuteIndirect(drawIndexedCommandSignature.Get(), 1u, indirectDrawBuffer.Get(), 0u, nullptr, 0u);
+#else // USE_INDIRECT_DRAW
 						cmd->DrawIndexedInstanced(sphereIndexCount, 1, 0, 0, 0);
+#endif // USE_INDIRECT_DRAW
 #endif // USE_MESHSHADER
+
+#ifdef USE_CULLING_STATS
+						// Copy to the readback slot of this frame: read when the slot is reused (see ReadCullingStats).
+						{
+							const D3D12_RESOURCE_BARRIER barrier{
+								.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+								.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+								.Transition = {
+									.pResource = cullingStatsBuffer.Get(),
+									.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+									.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+									.StateAfter = D3D12_RESOURCE_STATE_COPY_SOURCE,
+								},
+							};
+
+							cmd->ResourceBarrier(1, &barrier);
+
+							cmd->CopyBufferRegion(cullingStatsReadbackBuffers[swapchainFrameIndex].Get(), 0, cullingStatsBuffer.Get(), 0, sizeof(CullingStats));
+							cullingStatsReadbackFrames[swapchainFrameIndex] = frameNumber;
+						}
+#endif // USE_CULLING_STATS
 					}
 
 
@@ -3629,21 +6114,9 @@ int main()
 						sphereIndexBuffer = nullptr;
 						sphereIndexBufferView = D3D12_INDEX_BUFFER_VIEW{};
 
-						SA_LOG(L"Destroying Sphere Vertex Position Buffer...", Info, DX12, sphereVertexBuffers[0].Get());
-						sphereVertexBuffers[0] = nullptr;
-						sphereVertexBufferViews[0] = D3D12_VERTEX_BUFFER_VIEW{};
-
-						SA_LOG(L"Destroying Sphere Normal Position Buffer...", Info, DX12, sphereVertexBuffers[1].Get());
-						sphereVertexBuffers[1] = nullptr;
-						sphereVertexBufferViews[1] = D3D12_VERTEX_BUFFER_VIEW{};
-
-						SA_LOG(L"Destroying Sphere Tangent Position Buffer...", Info, DX12, sphereVertexBuffers[2].Get());
-						sphereVertexBuffers[2] = nullptr;
-						sphereVertexBufferViews[2] = D3D12_VERTEX_BUFFER_VIEW{};
-
-						SA_LOG(L"Destroying Sphere UV Position Buffer...", Info, DX12, sphereVertexBuffers[3].Get());
-						sphereVertexBuffers[3] = nullptr;
-						sphereVertexBufferViews[3] = D3D12_VERTEX_BUFFER_VIEW{};
+						SA_LOG(L"Destroying Sphere Vertex Buffer...", Info, DX12, sphereVertexBuffer.Get());
+						sphereVertexBuffer = nullptr;
+						sphereVertexBufferViews.fill(D3D12_VERTEX_BUFFER_VIEW{});
 					}
 				}
 			}
@@ -3666,6 +6139,66 @@ int main()
 					sphereObjectsBuffer = nullptr;
 				}
 
+#ifdef USE_INSTANCING
+				// Object Upload Buffers
+				for (uint32_t i = 0; i < bufferingCount; ++i)
+				{
+					SA_LOG((L"Destroying Object Upload Buffer [%1]...", i), Info, DX12, objectUploadBuffers[i].Get());
+					objectUploadBuffers[i]->Unmap(0, nullptr);
+					objectUploadData[i] = nullptr;
+					objectUploadBuffers[i] = nullptr;
+				}
+#endif // USE_INSTANCING
+
+#ifdef USE_INSTANCE_CULLING
+				// Visible Instance Buffers
+				{
+					SA_LOG(L"Destroying Visible Instance Buffer...", Info, DX12, visibleInstanceBuffer.Get());
+					visibleInstanceBuffer = nullptr;
+
+					SA_LOG(L"Destroying Visible Instance Reset Buffer...", Info, DX12, visibleInstanceResetBuffer.Get());
+					visibleInstanceResetBuffer = nullptr;
+				}
+#endif // USE_INSTANCE_CULLING
+
+#ifdef USE_INDIRECT_DRAW
+				// Indirect Draw Buffers
+				{
+					SA_LOG(L"Destroying Indirect Draw Buffer...", Info, DX12, indirectDrawBuffer.Get());
+					indirectDrawBuffer = nullptr;
+
+					SA_LOG(L"Destroying Indirect Draw Reset Buffer...", Info, DX12, indirectDrawResetBuffer.Get());
+					indirectDrawResetBuffer = nullptr;
+				}
+#endif // USE_INDIRECT_DRAW
+
+#ifdef USE_CULLING_STATS
+				// Culling Stats Buffers
+				{
+					for (uint32_t i = 0; i < bufferingCount; ++i)
+					{
+						SA_LOG((L"Destroying Culling Stats Readback Buffer [%1]...", i), Info, DX12, cullingStatsReadbackBuffers[i].Get());
+						cullingStatsReadbackBuffers[i] = nullptr;
+					}
+
+					SA_LOG(L"Destroying Culling Stats Reset Buffer...", Info, DX12, cullingStatsResetBuffer.Get());
+					cullingStatsResetBuffer = nullptr;
+
+					SA_LOG(L"Destroying Culling Stats Buffer...", Info, DX12, cullingStatsBuffer.Get());
+					cullingStatsBuffer = nullptr;
+
+					cullingStatsCSV.close();
+				}
+#endif // USE_CULLING_STATS
+
+#ifdef USE_OCCLUSION_CULLING
+				// Visibility Bits Buffer
+				{
+					SA_LOG(L"Destroying Visibility Bits Buffer...", Info, DX12, visibilityBitsBuffer.Get());
+					visibilityBitsBuffer = nullptr;
+				}
+#endif // USE_OCCLUSION_CULLING
+
 #ifdef USE_MESHSHADER
 				// Meshlet Buffers
 				{
@@ -3682,6 +6215,20 @@ int main()
 					SA_LOG(L"Destroying Meshlet Bounds Buffers...", Info, DX12, meshletBoundsBuffer.Get());
 					meshletBoundsBuffer = nullptr;
 #endif
+#ifdef USE_CLUSTER_LOD
+					SA_LOG(L"Destroying Meshlet LOD Buffers...", Info, DX12, meshletLodBuffer.Get());
+					meshletLodBuffer = nullptr;
+#endif
+#ifdef USE_DISCRETE_LOD
+					SA_LOG(L"Destroying Mesh LOD Buffers...", Info, DX12, meshLodBuffer.Get());
+					meshLodBuffer = nullptr;
+#endif
+
+					SA_LOG(L"Destroying Mesh Record Buffers...", Info, DX12, meshRecordBuffer.Get());
+					meshRecordBuffer = nullptr;
+
+					SA_LOG(L"Destroying Instance Mesh Buffers...", Info, DX12, instanceMeshBuffer.Get());
+					instanceMeshBuffer = nullptr;
 				}
 #endif
 
@@ -3701,6 +6248,54 @@ int main()
 
 			// Pipeline /* 0008-D */
 			{
+#ifdef USE_INSTANCE_CULLING
+				// Instance Culling
+				{
+					SA_LOG(L"Destroying DispatchMesh CommandSignature...", Info, DX12, dispatchMeshCommandSignature.Get());
+					dispatchMeshCommandSignature = nullptr;
+
+					SA_LOG(L"Destroying Instance Culling PipelineState...", Info, DX12, instanceCullingPipelineState.Get());
+					instanceCullingPipelineState = nullptr;
+
+					SA_LOG(L"Destroying Instance Culling Compute Shader...", Info, DX12, instanceCullingComputeShader.Get());
+					instanceCullingComputeShader = nullptr;
+
+					SA_LOG(L"Destroying Instance Culling RootSignature...", Info, DX12, instanceCullingRootSign.Get());
+					instanceCullingRootSign = nullptr;
+				}
+#endif // USE_INSTANCE_CULLING
+
+#ifdef USE_INDIRECT_DRAW
+				// Indirect Culling
+				{
+					SA_LOG(L"Destroying DrawIndexed CommandSignature...", Info, DX12, drawIndexedCommandSignature.Get());
+					drawIndexedCommandSignature = nullptr;
+
+					SA_LOG(L"Destroying Indirect Culling PipelineState...", Info, DX12, indirectCullingPipelineState.Get());
+					indirectCullingPipelineState = nullptr;
+
+					SA_LOG(L"Destroying Indirect Culling Compute Shader...", Info, DX12, indirectCullingComputeShader.Get());
+					indirectCullingComputeShader = nullptr;
+
+					SA_LOG(L"Destroying Indirect Culling RootSignature...", Info, DX12, indirectCullingRootSign.Get());
+					indirectCullingRootSign = nullptr;
+				}
+#endif // USE_INDIRECT_DRAW
+
+#ifdef USE_OCCLUSION_CULLING
+				// Depth Pyramid
+				{
+					SA_LOG(L"Destroying Depth Pyramid PipelineState...", Info, DX12, depthPyramidPipelineState.Get());
+					depthPyramidPipelineState = nullptr;
+
+					SA_LOG(L"Destroying Depth Pyramid Compute Shader...", Info, DX12, depthPyramidComputeShader.Get());
+					depthPyramidComputeShader = nullptr;
+
+					SA_LOG(L"Destroying Depth Pyramid RootSignature...", Info, DX12, depthPyramidRootSign.Get());
+					depthPyramidRootSign = nullptr;
+				}
+#endif // USE_OCCLUSION_CULLING
+
 				// Lit
 				{
 					// PipelineState
@@ -3756,6 +6351,11 @@ int main()
 
 				SA_LOG(L"Destroying Scene Depth Texture...", Info, DX12, sceneDepthTexture.Get());
 				sceneDepthTexture = nullptr;
+
+#ifdef USE_OCCLUSION_CULLING
+				SA_LOG(L"Destroying Depth Pyramid Texture...", Info, DX12, depthPyramidTexture.Get());
+				depthPyramidTexture = nullptr;
+#endif
 			}
 
 
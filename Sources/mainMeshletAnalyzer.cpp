@@ -0,0 +1,222 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+* Sapphire Suite Debugger:
+* Maxime's custom Log and Assert macros for easy debug.
+*/
+#include <SA/Collections/Debug>
+
+#include <MeshletCooker/MeshletCooker.hpp>
+
+/**
+* Meshlet quality analyzer: cooks a source file with the cooker settings and reports the LOD 0 meshlet statistics
+* (fill, vertex duplication, bounding sphere tightness, cone cutoff) of the whole file and of each submesh as JSON.
+* Usage: FVTDX12_mainMeshletAnalyzer <source> [--output path.json] [--preset N] [--max-vertices N] [--max-triangles N] [--cone-weight F] [--optimize] [--threads N]
+*                                    [--min-vertex-fill F] [--min-triangle-fill F] [--max-vertex-duplication F] [--max-sphere-hull-ratio F]
+*
+* The thresholds are checked on the whole file (average fill, duplication, median sphere/hull ratio):
+* the tool fails (and "passed" is false) if one is exceeded, so an asset pipeline can reject a cook regression.
+*/
+
+struct Thresholds
+{
+	float minVertexFill = 0.0f;
+	float minTriangleFill = 0.0f;
+
+	/// 0: unchecked.
+	float maxVertexDuplication = 0.0f;
+	float maxSphereHullRatio = 0.0f;
+};
+
+std::string EscapeJson(const std::string& _str)
+{
+	std::string escaped;
+	escaped.reserve(_str.size());
+
+	for (char c : _str)
+	{
+		if (c == '"' || c == '\\')
+			escaped += '\\';
+
+		escaped += c;
+	}
+
+	return escaped;
+}
+
+void WriteDistribution(std::ostream& _out, const char* _name, const MeshletCooker::Distribution& _distribution, const char* _indent)
+{
+	_out << _indent << "\"" << _name << "\": { \"average\": " << _distribution.average << ", \"min\": " << _distribution.min <<
+		", \"p10\": " << _distribution.p10 << ", \"p50\": " << _distribution.p50 << ", \"p90\": " << _distribution.p90 << ", \"max\": " << _distribution.max << " }";
+}
+
+void WriteStatistics(std::ostream& _out, const MeshletCooker::MeshletStatistics& _statistics, const char* _indent)
+{
+	const std::string indent = std::string(_indent) + "\t";
+
+	_out << "{\n";
+	_out << indent << "\"meshletCount\": " << _statistics.meshletCount << ",\n";
+	_out << indent << "\"triangleCount\": " << _statistics.triangleCount << ",\n";
+	_out << indent << "\"vertexCount\": " << _statistics.vertexCount << ",\n";
+	_out << indent << "\"meshletVertexCount\": " << _statistics.meshletVertexCount << ",\n";
+	WriteDistribution(_out, "vertexFill", _statistics.vertexFill, indent.c_str());
+	_out << ",\n";
+	WriteDistribution(_out, "triangleFill", _statistics.triangleFill, indent.c_str());
+	_out << ",\n";
+	_out << indent << "\"vertexDuplication\": " << _statistics.vertexDuplication << ",\n";
+	WriteDistribution(_out, "sphereHullRatio", _statistics.sphereHullRatio, indent.c_str());
+	_out << ",\n";
+	_out << indent << "\"flatMeshletCount\": " << _statistics.flatMeshletCount << ",\n";
+	WriteDistribution(_out, "coneCutoff", _statistics.coneCutoff, indent.c_str());
+	_out << ",\n";
+	_out << indent << "\"unculledMeshletCount\": " << _statistics.unculledMeshletCount << "\n";
+	_out << _indent << "}";
+}
+
+int main(int argc, char** argv)
+{
+	SA::Debug::InitDefaultLogger();
+
+	if (argc < 2)
+	{
+		SA_LOG(L"Usage: FVTDX12_mainMeshletAnalyzer <source> [--output path.json] [--preset N] [--max-vertices N] [--max-triangles N] [--cone-weight F] [--optimize] [--threads N] "
+			"[--min-vertex-fill F] [--min-triangle-fill F] [--max-vertex-duplication F] [--max-sphere-hull-ratio F]", Error, MeshletCooker);
+		return EXIT_FAILURE;
+	}
+
+	const std::string sourcePath = argv[1];
+	std::string outputPath;
+
+	MeshletCooker::Settings settings;
+	Thresholds thresholds;
+	uint32_t threadCount = 0u;
+
+	for (int i = 2; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+
+		if (arg == "--optimize")
+		{
+			settings.bOptimize = true;
+			continue;
+		}
+
+		if (i + 1 >= argc)
+		{
+			SA_LOG((L"Missing value for argument {%1}", arg), Error, MeshletCooker);
+			return EXIT_FAILURE;
+		}
+
+		if (arg == "--output")
+			outputPath = argv[++i];
+		else if (arg == "--preset")
+		{
+			const uint32_t preset = static_cast<uint32_t>(std::stoul(argv[++i]));
+
+			if (preset >= MeshletCooker::meshletPresets.size())
+			{
+				SA_LOG((L"Unknown meshlet preset {%1}", preset), Error, MeshletCooker);
+				return EXIT_FAILURE;
+			}
+
+			settings.maxVertices = MeshletCooker::meshletPresets[preset].maxVertices;
+			settings.maxTriangles = MeshletCooker::meshletPresets[preset].maxTriangles;
+		}
+		else if (arg == "--max-vertices")
+			settings.maxVertices = static_cast<uint32_t>(std::stoul(argv[++i]));
+		else if (arg == "--max-triangles")
+			settings.maxTriangles = static_cast<uint32_t>(std::stoul(argv[++i]));
+		else if (arg == "--cone-weight")
+			settings.coneWeight = std::stof(argv[++i]);
+		else if (arg == "--threads")
+			threadCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+		else if (arg == "--min-vertex-fill")
+			thresholds.minVertexFill = std::stof(argv[++i]);
+		else if (arg == "--min-triangle-fill")
+			thresholds.minTriangleFill = std::stof(argv[++i]);
+		else if (arg == "--max-vertex-duplication")
+			thresholds.maxVertexDuplication = std::stof(argv[++i]);
+		else if (arg == "--max-sphere-hull-ratio")
+			thresholds.maxSphereHullRatio = std::stof(argv[++i]);
+		else
+		{
+			SA_LOG((L"Unknown argument {%1}", arg), Error, MeshletCooker);
+			return EXIT_FAILURE;
+		}
+	}
+
+	MeshletCooker::CookedMesh mesh;
+	if (!MeshletCooker::CookFile(sourcePath, settings, mesh, threadCount))
+		return EXIT_FAILURE;
+
+	const MeshletCooker::MeshletStatistics total = MeshletCooker::AnalyzeMeshlets(mesh, mesh.submeshes, settings, threadCount);
+
+	std::vector<MeshletCooker::MeshletStatistics> submeshStatistics;
+	submeshStatistics.reserve(mesh.submeshes.size());
+
+	for (size_t i = 0; i < mesh.submeshes.size(); ++i)
+		submeshStatistics.push_back(MeshletCooker::AnalyzeMeshlets(mesh, std::span(mesh.submeshes).subspan(i, 1), settings, threadCount));
+
+	// Thresholds.
+	std::vector<std::string> failures;
+
+	if (total.vertexFill.average < thresholds.minVertexFill)
+		failures.push_back("vertexFill.average " + std::to_string(total.vertexFill.average) + " < " + std::to_string(thresholds.minVertexFill));
+
+	if (total.triangleFill.average < thresholds.minTriangleFill)
+		failures.push_back("triangleFill.average " + std::to_string(total.triangleFill.average) + " < " + std::to_string(thresholds.minTriangleFill));
+
+	if (thresholds.maxVertexDuplication > 0.0f && total.vertexDuplication > thresholds.maxVertexDuplication)
+		failures.push_back("vertexDuplication " + std::to_string(total.vertexDuplication) + " > " + std::to_string(thresholds.maxVertexDuplication));
+
+	if (thresholds.maxSphereHullRatio > 0.0f && total.sphereHullRatio.p50 > thresholds.maxSphereHullRatio)
+		failures.push_back("sphereHullRatio.p50 " + std::to_string(total.sphereHullRatio.p50) + " > " + std::to_string(thresholds.maxSphereHullRatio));
+
+	// JSON report.
+	std::ofstream outputFile;
+	if (!outputPath.empty())
+	{
+		outputFile.open(outputPath, std::ios::trunc);
+
+		if (!outputFile.is_open())
+		{
+			SA_LOG((L"Can't open output file {%1}", outputPath), Error, MeshletCooker);
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::ostream& out = outputPath.empty() ? std::cout : outputFile;
+
+	out << "{\n";
+	out << "\t\"source\": \"" << EscapeJson(sourcePath) << "\",\n";
+	out << "\t\"settings\": { \"maxVertices\": " << settings.maxVertices << ", \"maxTriangles\": " << settings.maxTriangles <<
+		", \"coneWeight\": " << settings.coneWeight << ", \"optimize\": " << (settings.bOptimize ? "true" : "false") << " },\n";
+	out << "\t\"passed\": " << (failures.empty() ? "true" : "false") << ",\n";
+
+	out << "\t\"failures\": [";
+	for (size_t i = 0; i < failures.size(); ++i)
+		out << (i ? ", " : " ") << "\"" << EscapeJson(failures[i]) << "\"" << (i + 1 == failures.size() ? " " : "");
+	out << "],\n";
+
+	out << "\t\"total\": ";
+	WriteStatistics(out, total, "\t");
+	out << ",\n";
+
+	out << "\t\"submeshes\": [";
+	for (size_t i = 0; i < submeshStatistics.size(); ++i)
+	{
+		out << (i ? ",\n\t\t" : "\n\t\t");
+		WriteStatistics(out, submeshStatistics[i], "\t\t");
+	}
+	out << (submeshStatistics.empty() ? "]\n" : "\n\t]\n");
+	out << "}\n";
+
+	for (const std::string& failure : failures)
+		SA_LOG((L"Threshold failed: %1", failure), Error, MeshletCooker);
+
+	return failures.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
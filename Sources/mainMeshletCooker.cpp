@@ -0,0 +1,301 @@
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+* Sapphire Suite Debugger:
+* Maxime's custom Log and Assert macros for easy debug.
+*/
+#include <SA/Collections/Debug>
+
+#include <MeshletCooker/MeshletCooker.hpp>
+
+/**
+* Offline meshlet cooker.
+* Usage: FVTDX12_mainMeshletCooker <source> <output> [--preset N] [--max-vertices N] [--max-triangles N] [--cone-weight F] [--chunk-triangles N] [--encoding uint32|compact] [--vertex-format float32|quantized] [--cluster-lod N] [--lods N] [--optimize] [--threads N] [--validate]
+*
+* The output file can be dropped in the renderer's meshlet cache directory (see MeshletCooker::GetCachePath()).
+*/
+int main(int argc, char** argv)
+{
+	SA::Debug::InitDefaultLogger();
+
+	if (argc < 3)
+	{
+		SA_LOG(L"Usage: FVTDX12_mainMeshletCooker <source> <output> [--preset N] [--max-vertices N] [--max-triangles N] [--cone-weight F] [--chunk-triangles N] [--encoding uint32|compact] [--vertex-format float32|quantized] [--cluster-lod N] [--lods N] [--optimize] [--threads N] [--validate]", Error, MeshletCooker);
+		return EXIT_FAILURE;
+	}
+
+	const std::string sourcePath = argv[1];
+	const std::string outputPath = argv[2];
+
+	MeshletCooker::Settings settings;
+	uint32_t threadCount = 0u;
+	bool bValidate = false;
+
+	// Command line
+	{
+		// std::stoul and std::stof throw on non-numeric or out of range values.
+		int i = 3;
+		try
+		{
+			for (; i < argc; ++i)
+			{
+				const std::string arg = argv[i];
+
+				if (arg == "--validate")
+				{
+					bValidate = true;
+					continue;
+				}
+
+				if (arg == "--optimize")
+				{
+					settings.bOptimize = true;
+					continue;
+				}
+
+				if (i + 1 >= argc)
+				{
+					SA_LOG((L"Missing value for argument {%1}", arg), Error, MeshletCooker);
+					return EXIT_FAILURE;
+				}
+
+				if (arg == "--preset")
+				{
+					const uint32_t preset = static_cast<uint32_t>(std::stoul(argv[++i]));
+
+					if (preset >= MeshletCooker::meshletPresets.size())
+					{
+						SA_LOG((L"Unknown meshlet preset {%1}", preset), Error, MeshletCooker);
+						return EXIT_FAILURE;
+					}
+
+					settings.maxVertices = MeshletCooker::meshletPresets[preset].maxVertices;
+					settings.maxTriangles = MeshletCooker::meshletPresets[preset].maxTriangles;
+				}
+				else if (arg == "--max-vertices")
+					settings.maxVertices = static_cast<uint32_t>(std::stoul(argv[++i]));
+				else if (arg == "--max-triangles")
+					settings.maxTriangles = static_cast<uint32_t>(std::stoul(argv[++i]));
+				else if (arg == "--cone-weight")
+					settings.coneWeight = std::stof(argv[++i]);
+				else if (arg == "--chunk-triangles")
+					settings.chunkTriangleCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+				else if (arg == "--encoding")
+				{
+					const std::string encoding = argv[++i];
+
+					if (encoding == "uint32")
+						settings.encoding = MeshletCooker::MeshletEncoding::Uint32;
+					else if (encoding == "compact")
+						settings.encoding = MeshletCooker::MeshletEncoding::Compact;
+					else
+					{
+						SA_LOG((L"Unknown encoding {%1}", encoding), Error, MeshletCooker);
+						return EXIT_FAILURE;
+					}
+				}
+				else if (arg == "--vertex-format")
+				{
+					const std::string vertexFormat = argv[++i];
+
+					if (vertexFormat == "float32")
+						settings.vertexFormat = MeshletCooker::VertexFormat::Float32;
+					else if (vertexFormat == "quantized")
+						settings.vertexFormat = MeshletCooker::VertexFormat::Quantized;
+					else
+					{
+						SA_LOG((L"Unknown vertex format {%1}", vertexFormat), Error, MeshletCooker);
+						return EXIT_FAILURE;
+					}
+				}
+				else if (arg == "--cluster-lod")
+					settings.clusterGroupSize = static_cast<uint32_t>(std::stoul(argv[++i]));
+				else if (arg == "--lods")
+					settings.lodCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+				else if (arg == "--threads")
+					threadCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+				else
+				{
+					SA_LOG((L"Unknown argument {%1}", arg), Error, MeshletCooker);
+					return EXIT_FAILURE;
+				}
+			}
+		}
+		catch (const std::invalid_argument&)
+		{
+			SA_LOG((L"Invalid value {%1} for argument {%2}", argv[i], argv[i - 1]), Error, MeshletCooker);
+			return EXIT_FAILURE;
+		}
+		catch (const std::out_of_range&)
+		{
+			SA_LOG((L"Out of range value {%1} for argument {%2}", argv[i], argv[i - 1]), Error, MeshletCooker);
+			return EXIT_FAILURE;
+		}
+	}
+
+	// meshopt_buildMeshlets asserts on these limits.
+	if (settings.maxVertices < 3u || settings.maxVertices > 256u)
+	{
+		SA_LOG((L"Max vertices {%1} must be in [3, 256]", settings.maxVertices), Error, MeshletCooker);
+		return EXIT_FAILURE;
+	}
+
+	if (settings.maxTriangles < 4u || settings.maxTriangles > 512u || settings.maxTriangles % 4u != 0u)
+	{
+		SA_LOG((L"Max triangles {%1} must be a multiple of 4 in [4, 512]", settings.maxTriangles), Error, MeshletCooker);
+		return EXIT_FAILURE;
+	}
+
+	// The renderer only has Mesh Shader permutations for the MeshletLimits.h presets.
+	if (MeshletCooker::FindMeshletPreset(settings.maxVertices, settings.maxTriangles) == MeshletCooker::meshletPresets.size())
+		SA_LOG((L"Meshlet limits {%1, %2} match no preset (MeshletLimits.h): the file can't be drawn by the renderer.", settings.maxVertices, settings.maxTriangles), Warning, MeshletCooker);
+
+	uint64_t sourceHash = 0u;
+	if (!MeshletCooker::HashSourceFile(sourcePath, sourceHash))
+		return EXIT_FAILURE;
+
+	MeshletCooker::CookedMesh mesh;
+	if (!MeshletCooker::CookFile(sourcePath, settings, mesh, threadCount))
+		return EXIT_FAILURE;
+
+	if (bValidate && !MeshletCooker::ValidateMeshletCoverage(mesh))
+		return EXIT_FAILURE;
+
+	// Vertex cache, vertex fetch and meshlet fill statistics.
+	{
+		auto logStatistics = [](const std::string& _label, const MeshletCooker::MeshStatistics& _statistics)
+		{
+			SA_LOG((L"%1: ACMR %2, ATVR %3, overfetch %4, meshlet fill %5% vertices, %6% triangles.", _label, _statistics.acmr, _statistics.atvr,
+				_statistics.overfetch, _statistics.meshletVertexFill * 100.0f, _statistics.meshletTriangleFill * 100.0f), Info, MeshletCooker);
+		};
+
+		if (settings.bOptimize)
+		{
+			MeshletCooker::Settings sourceSettings = settings;
+			sourceSettings.bOptimize = false;
+
+			MeshletCooker::CookedMesh sourceMesh;
+			if (MeshletCooker::CookFile(sourcePath, sourceSettings, sourceMesh, threadCount))
+				logStatistics("Before optimization", MeshletCooker::AnalyzeMesh(sourceMesh, sourceSettings));
+
+			logStatistics("After optimization", MeshletCooker::AnalyzeMesh(mesh, settings));
+		}
+		else
+			logStatistics("Mesh", MeshletCooker::AnalyzeMesh(mesh, settings));
+	}
+
+	// Vertex quantization error.
+	{
+		std::vector<MeshletCooker::QuantizedVertex> quantizedVertices;
+		MeshletCooker::VertexQuantization quantization;
+		MeshletCooker::EncodeQuantizedVertices(mesh.vertices, quantizedVertices, quantization);
+
+		const MeshletCooker::QuantizationError error = MeshletCooker::MeasureQuantizationError(mesh.vertices, quantizedVertices, quantization);
+
+		SA_LOG((L"Vertex size: %1 bytes (float32), %2 bytes (quantized).", sizeof(MeshletCooker::Vertex), sizeof(MeshletCooker::QuantizedVertex)), Info, MeshletCooker);
+		SA_LOG((L"Quantization max error: position %1 (extent %2, %3, %4), normal %5 deg, tangent %6 deg, uv %7.", error.maxPositionError,
+			quantization.positionExtent.x, quantization.positionExtent.y, quantization.positionExtent.z, error.maxNormalError, error.maxTangentError, error.maxUVError), Info, MeshletCooker);
+	}
+
+	// Cluster LOD levels.
+	if (settings.clusterGroupSize > 1u)
+	{
+		std::vector<size_t> levelMeshletCounts;
+		std::vector<size_t> levelTriangleCounts;
+
+		for (size_t i = 0; i < mesh.meshlets.size(); ++i)
+		{
+			// Discrete LOD meshlets.
+			if (mesh.meshletLods[i].selfError == std::numeric_limits<float>::max())
+				continue;
+
+			const uint32_t level = mesh.meshletLods[i].level;
+
+			if (level >= levelMeshletCounts.size())
+			{
+				levelMeshletCounts.resize(level + 1, 0u);
+				levelTriangleCounts.resize(level + 1, 0u);
+			}
+
+			++levelMeshletCounts[level];
+			levelTriangleCounts[level] += mesh.meshlets[i].triangleCount;
+		}
+
+		for (size_t level = 0; level < levelMeshletCounts.size(); ++level)
+			SA_LOG((L"Cluster LOD level %1: %2 meshlets, %3 triangles.", level, levelMeshletCounts[level], levelTriangleCounts[level]), Info, MeshletCooker);
+	}
+
+	// Discrete LODs.
+	if (settings.lodCount > 1u)
+	{
+		for (size_t i = 0; i < mesh.submeshes.size(); ++i)
+		{
+			const MeshletCooker::Submesh& submesh = mesh.submeshes[i];
+
+			for (uint32_t lodIndex = 0; lodIndex < submesh.lodCount; ++lodIndex)
+			{
+				const MeshletCooker::MeshLod& lod = mesh.meshLods[submesh.lodOffset + lodIndex];
+				SA_LOG((L"Submesh %1 LOD %2: %3 meshlets, %4 triangles, error %5.", i, lodIndex, lod.meshletCount, lod.triangleCount, lod.error), Info, MeshletCooker);
+			}
+		}
+	}
+
+	// Meshlet index data size: meshlets + meshlet vertices + meshlet triangles.
+	{
+		const size_t triangleCount = std::max<size_t>(1u, mesh.indices.size() / 3);
+
+		const size_t uint32Size = mesh.meshlets.size() * sizeof(MeshletCooker::Meshlet) +
+			mesh.meshletVertices.size() * sizeof(uint32_t) + mesh.meshletTriangles.size() * sizeof(uint32_t);
+
+		SA_LOG((L"Uint32 encoding: %1 bytes, %2 bytes/triangle.", uint32Size, static_cast<double>(uint32Size) / triangleCount), Info, MeshletCooker);
+
+		MeshletCooker::CompactMeshletData compactData;
+		if (MeshletCooker::EncodeCompactMeshlets(mesh, compactData))
+		{
+			const size_t compactSize = compactData.meshlets.size() * sizeof(MeshletCooker::CompactMeshlet) +
+				compactData.meshletVertices.size() * sizeof(uint16_t) + compactData.meshletTriangles.size() * sizeof(uint8_t);
+
+			SA_LOG((L"Compact encoding: %1 bytes, %2 bytes/triangle.", compactSize, static_cast<double>(compactSize) / triangleCount), Info, MeshletCooker);
+
+			if (bValidate)
+			{
+				std::vector<MeshletCooker::Meshlet> decodedMeshlets;
+				std::vector<uint32_t> decodedMeshletVertices;
+				std::vector<uint32_t> decodedMeshletTriangles;
+				MeshletCooker::DecodeCompactMeshlets(compactData.meshlets, compactData.meshletVertices, compactData.meshletTriangles,
+					decodedMeshlets, decodedMeshletVertices, decodedMeshletTriangles);
+
+				// Same meshlets once decoded: offsets are recomputed, only vertices and triangles must match.
+				bool bSame = decodedMeshlets.size() == mesh.meshlets.size();
+
+				for (size_t i = 0; bSame && i < mesh.meshlets.size(); ++i)
+				{
+					const MeshletCooker::Meshlet& meshlet = mesh.meshlets[i];
+					const MeshletCooker::Meshlet& decoded = decodedMeshlets[i];
+
+					bSame = meshlet.vertexCount == decoded.vertexCount && meshlet.triangleCount == decoded.triangleCount &&
+						std::equal(&mesh.meshletVertices[meshlet.vertexOffset], &mesh.meshletVertices[meshlet.vertexOffset] + meshlet.vertexCount, &decodedMeshletVertices[decoded.vertexOffset]) &&
+						std::equal(&mesh.meshletTriangles[meshlet.triangleOffset], &mesh.meshletTriangles[meshlet.triangleOffset] + meshlet.triangleCount, &decodedMeshletTriangles[decoded.triangleOffset]);
+				}
+
+				if (!bSame)
+				{
+					SA_LOG(L"Compact encoding round trip failed!", Error, MeshletCooker);
+					return EXIT_FAILURE;
+				}
+			}
+		}
+	}
+
+	if (!MeshletCooker::WriteMeshletFile(outputPath, mesh, sourceHash, settings))
+		return EXIT_FAILURE;
+
+	SA_LOG((L"Cooked {%1}: %2 vertices, %3 triangles, %4 meshlets.", sourcePath, mesh.vertices.size(), mesh.indices.size() / 3, mesh.meshlets.size()), Info, MeshletCooker);
+
+	return EXIT_SUCCESS;
+}
@@ -1,6 +1,9 @@
+#include <algorithm>
 #include <array>
 #include <fstream>
 #include <sstream>
+#include <stdexcept>
+#include <string>
 
 /**
 * Sapphire Suite Debugger:
@@ -25,6 +28,13 @@
 GLFWwindow* window = nullptr;
 constexpr SA::Vec2ui windowSize = { 1200, 900 };
 
+/**
+* --headless: no window, surface nor swapchain. Renders headlessFrameCount frames (--frames) in offscreen images.
+* Runs on software Vulkan implementations (lavapipe, SwiftShader) without a display.
+*/
+bool bHeadless = false;
+uint32_t headlessFrameCount = 16u;
+
 void GLFWErrorCallback(int32_t error, const char* description)
 {
 	SA_LOG((L"GLFW Error [%1]: %2", error, description), Error, GLFW.API);
@@ -137,7 +147,8 @@ struct QueueFamilyIndices
 VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
 QueueFamilyIndices deviceQueueFamilyIndices;
 
-const std::vector<const char*> vkDeviceReqExts{
+/// Cleared in headless: nothing is presented.
+std::vector<const char*> vkDeviceReqExts{
 	VK_KHR_SWAPCHAIN_EXTENSION_NAME
 };
 
@@ -156,6 +167,9 @@ VkSwapchainKHR swapchain = VK_NULL_HANDLE;
 std::array<VkImage, bufferingCount> swapchainImages{ VK_NULL_HANDLE };
 std::array<VkImageView, bufferingCount> swapchainImageViews{ VK_NULL_HANDLE };
 uint32_t swapchainFrameIndex = 0u;
+
+/// Headless: memories of the offscreen images replacing the swapchain backbuffers (swapchainImages).
+std::array<VkDeviceMemory, bufferingCount> headlessImageMemories{ VK_NULL_HANDLE };
 uint32_t swapchainImageIndex = 0u;
 
 /* 0003.1 */
@@ -234,6 +248,32 @@ VkShaderModule litFragmentShader = VK_NULL_HANDLE;
 VkPipelineLayout litPipelineLayout = VK_NULL_HANDLE; /* 0008-1 */
 VkPipeline litPipeline = VK_NULL_HANDLE;
 
+// = Instance Culling =
+/**
+* Compute pass writing one VkDrawIndexedIndirectCommand per visible instance (InstanceCulling.comp),
+* drawn by vkCmdDrawIndexedIndirectCount.
+*/
+constexpr uint32_t instanceCullingGroupSize = 64u; // INSTANCE_CULLING_GROUP_SIZE in InstanceCulling.comp
+
+VkDescriptorSetLayout instanceCullingDescSetLayout = VK_NULL_HANDLE;
+
+VkShaderModule instanceCullingComputeShader = VK_NULL_HANDLE;
+
+VkPipelineLayout instanceCullingPipelineLayout = VK_NULL_HANDLE;
+VkPipeline instanceCullingPipeline = VK_NULL_HANDLE;
+
+/// Push constants of InstanceCulling.comp (CullingConstants).
+struct InstanceCullingConstants
+{
+	std::array<SA::Vec4f, 6> frustumPlanes;
+
+	SA::Vec4f meshBoundingSphere; // position = meshBoundingSphere.xyz, radius = meshBoundingSphere.w
+
+	uint32_t instanceCount = 0u;
+
+	uint32_t indexCount = 0u;
+};
+
 
 // === Scene Objects === /* 0009 */
 
@@ -256,15 +296,74 @@ constexpr float cameraFOV = 90.0f;
 std::array<VkBuffer, bufferingCount> cameraBuffers;
 std::array<VkDeviceMemory, bufferingCount> cameraBufferMemories;
 
+/**
+* Frustum planes (InstanceCullingConstants::frustumPlanes): xyz normal pointing inside, w distance.
+* Built from the 8 corners unprojected by _invViewProj, oriented toward the frustum center: independent of the handedness and depth range.
+*/
+void GetFrustumPlanes(const SA::CMat4f& _invViewProj, std::array<SA::Vec4f, 6>& _outPlanes)
+{
+	std::array<SA::Vec3f, 8> corners;
+	SA::Vec3f center(0.0f, 0.0f, 0.0f);
+
+	for (uint32_t i = 0u; i < 8u; ++i)
+	{
+		const SA::Vec4f ndc((i & 1u) ? 1.0f : -1.0f, (i & 2u) ? 1.0f : -1.0f, (i & 4u) ? 1.0f : -1.0f, 1.0f);
+		const SA::Vec4f world = _invViewProj * ndc;
+
+		corners[i] = SA::Vec3f(world) / world.w;
+		center += corners[i] / 8.0f;
+	}
+
+	// Left, Right, Bottom, Top, Near, Far: 3 corners of each face.
+	constexpr uint32_t faces[6][3]{
+		{ 0, 2, 4 },
+		{ 1, 3, 5 },
+		{ 0, 1, 4 },
+		{ 2, 3, 6 },
+		{ 0, 1, 2 },
+		{ 4, 5, 6 },
+	};
+
+	for (uint32_t i = 0u; i < 6u; ++i)
+	{
+		const SA::Vec3f& position = corners[faces[i][0]];
+		SA::Vec3f normal = SA::Vec3f::Cross(corners[faces[i][1]] - position, corners[faces[i][2]] - position).GetNormalized();
+
+		if (SA::Vec3f::Dot(normal, center - position) < 0.0f)
+			normal *= -1.0f;
+
+		_outPlanes[i] = SA::Vec4f(normal, -SA::Vec3f::Dot(normal, position));
+	}
+}
+
 // = Object Buffer =
 struct ObjectUBO
 {
-	SA::Mat4f transform;
+	SA::CMat4f transform;
 };
 constexpr SA::Vec3f spherePosition(0.5f, 0.0f, 2.0f);
+constexpr uint32_t numInstanceRowsCount = 10u;
+constexpr uint32_t numInstanceColsCount = 40u;
+constexpr uint32_t instanceCount = numInstanceRowsCount * numInstanceColsCount;
 VkBuffer sphereObjectBuffer;
 VkDeviceMemory sphereObjectBufferMemory;
 
+// = Indirect Draw Buffers =
+/// Draw commands of the visible instances, compacted by the instance culling pass.
+VkBuffer indirectDrawBuffer;
+VkDeviceMemory indirectDrawBufferMemory;
+
+/// Visible instance count: draw count of vkCmdDrawIndexedIndirectCount.
+VkBuffer indirectCountBuffer;
+VkDeviceMemory indirectCountBufferMemory;
+
+/// Host copies of indirectCountBuffer, read bufferingCount frames later.
+std::array<VkBuffer, bufferingCount> indirectCountReadbackBuffers;
+std::array<VkDeviceMemory, bufferingCount> indirectCountReadbackBufferMemories;
+
+VkDescriptorPool instanceCullingDescPool = VK_NULL_HANDLE;
+VkDescriptorSet instanceCullingDescSet = VK_NULL_HANDLE;
+
 // = PointLights Buffer =
 struct PointLightUBO
 {
@@ -287,6 +386,12 @@ VkDeviceMemory pointLightBufferMemory;
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
+/**
+* Meshlet cooker:
+* Shares the mesh optimize stage (vertex cache, vertex fetch and spatial order) with the DX12 renderer.
+*/
+#include <MeshletCooker/MeshletCooker.hpp>
+
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
@@ -711,6 +816,7 @@ bool CompileShaderFromFile(const std::string& _path, shaderc_shader_kind _stage,
 std::array<VkBuffer, 4> sphereVertexBuffers { VK_NULL_HANDLE };
 std::array<VkDeviceMemory, 4> sphereVertexBufferMemories{ VK_NULL_HANDLE };
 
+SA::Vec4f sphereBoundingSphere; // position = xyz, radius = w
 uint32_t sphereIndexCount = 0u;
 VkBuffer sphereIndexBuffer = VK_NULL_HANDLE;
 VkDeviceMemory sphereIndexBufferMemory = VK_NULL_HANDLE;
@@ -735,13 +841,50 @@ VkDeviceMemory rustedIron2RoughnessImageMemory = VK_NULL_HANDLE;
 VkImageView rustedIron2RoughnessImageView = VK_NULL_HANDLE;
 
 
-int main()
+int main(int argc, char** argv)
 {
 	// Initialization
 	{
 		SA::Debug::InitDefaultLogger();
 
+		// Command line
+		{
+			// std::stoul throws on non-numeric or out of range values.
+			int i = 1;
+			try
+			{
+				for (; i < argc; ++i)
+				{
+					const std::string arg = argv[i];
+
+					if (arg == "--headless")
+					{
+						bHeadless = true;
+					}
+					else if (arg == "--frames" && i + 1 < argc)
+					{
+						headlessFrameCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+					}
+					else
+					{
+						SA_LOG((L"Unknown argument {%1}", arg), Warning, VK);
+					}
+				}
+			}
+			catch (const std::invalid_argument&)
+			{
+				SA_LOG((L"Invalid value {%1} for argument {%2}", argv[i], argv[i - 1]), Error, VK);
+				return EXIT_FAILURE;
+			}
+			catch (const std::out_of_range&)
+			{
+				SA_LOG((L"Out of range value {%1} for argument {%2}", argv[i], argv[i - 1]), Error, VK);
+				return EXIT_FAILURE;
+			}
+		}
+
 		// GLFW
+		if (!bHeadless)
 		{
 			glfwSetErrorCallback(GLFWErrorCallback);
 			glfwInit();
@@ -894,7 +1037,7 @@ int main()
 
 
 			// Surface /* 0003-0-I */
-			if (true)
+			if (!bHeadless)
 			{
 				/**
 				* Create Vulkan Surface from GLFW window.
@@ -916,6 +1059,10 @@ int main()
 			// Device /* 0002-I */
 			if (true)
 			{
+				// Headless: no swapchain extension nor present support required.
+				if (bHeadless)
+					vkDeviceReqExts.clear();
+
 				// Query physical devices
 				uint32_t deviceCount = 0;
 				const VkResult vrEnumPhysDeviceCount = vkEnumeratePhysicalDevices(instance, &deviceCount, nullptr);
@@ -990,6 +1137,31 @@ int main()
 							continue; // go to next device.
 					}
 
+					// Check features support: vkCmdDrawIndexedIndirectCount (Vulkan 1.2) with more than 1 draw.
+					{
+						VkPhysicalDeviceProperties properties;
+						vkGetPhysicalDeviceProperties(currPhysicalDevice, &properties);
+
+						if (properties.apiVersion < VK_API_VERSION_1_2)
+							continue; // go to next device.
+
+						VkPhysicalDeviceVulkan12Features supportedFeatures12{
+							.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+							.pNext = nullptr,
+						};
+
+						VkPhysicalDeviceFeatures2 supportedFeatures{
+							.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+							.pNext = &supportedFeatures12,
+						};
+
+						vkGetPhysicalDeviceFeatures2(currPhysicalDevice, &supportedFeatures);
+
+						// The culling pass writes one command per visible instance: firstInstance is the instance index.
+						if (!supportedFeatures.features.multiDrawIndirect || !supportedFeatures.features.drawIndirectFirstInstance || !supportedFeatures12.drawIndirectCount)
+							continue; // go to next device.
+					}
+
 					// Find Queue Families
 					{
 						QueueFamilyIndices currPhysicalDeviceQueueFamilies;
@@ -1013,7 +1185,9 @@ int main()
 							//	currPhysicalDeviceQueueFamilies.computeFamily = i;
 
 							// Present family.
-							if (currPhysicalDeviceQueueFamilies.presentFamily == uint32_t(-1) ||
+							if (bHeadless)
+								currPhysicalDeviceQueueFamilies.presentFamily = currPhysicalDeviceQueueFamilies.graphicsFamily;
+							else if (currPhysicalDeviceQueueFamilies.presentFamily == uint32_t(-1) ||
 								currPhysicalDeviceQueueFamilies.graphicsFamily == currPhysicalDeviceQueueFamilies.presentFamily)
 							{
 								VkBool32 presentSupport = false;
@@ -1054,7 +1228,20 @@ int main()
 
 
 				// Create Logical Device.
-				const VkPhysicalDeviceFeatures deviceFeatures{};
+				VkPhysicalDeviceVulkan12Features deviceFeatures12{
+					.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+					.pNext = nullptr,
+					.drawIndirectCount = VK_TRUE,
+				};
+
+				const VkPhysicalDeviceFeatures2 deviceFeatures{
+					.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+					.pNext = &deviceFeatures12,
+					.features{
+						.multiDrawIndirect = VK_TRUE,
+						.drawIndirectFirstInstance = VK_TRUE,
+					},
+				};
 
 				const float queuePriority = 1.0f;
 				const std::array<VkDeviceQueueCreateInfo, 2> queueCreateInfo{
@@ -1084,17 +1271,20 @@ int main()
 					}
 				};
 
+				// Same family: a single queue serves graphics and present.
+				const uint32_t queueCreateInfoCount = deviceQueueFamilyIndices.graphicsFamily == deviceQueueFamilyIndices.presentFamily ? 1u : 2u;
+
 				VkDeviceCreateInfo deviceCreateInfo{
 					.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-					.pNext = nullptr,
+					.pNext = &deviceFeatures,
 					.flags = 0,
-					.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfo.size()),
+					.queueCreateInfoCount = queueCreateInfoCount,
 					.pQueueCreateInfos = queueCreateInfo.data(),
 					.enabledLayerCount = 0,
 					.ppEnabledLayerNames = nullptr,
 					.enabledExtensionCount = static_cast<uint32_t>(vkDeviceReqExts.size()),
 					.ppEnabledExtensionNames = vkDeviceReqExts.data(),
-					.pEnabledFeatures = &deviceFeatures,
+					.pEnabledFeatures = nullptr, // deviceFeatures in pNext.
 				};
 
 #if SA_DEBUG
@@ -1129,7 +1319,7 @@ int main()
 
 
 			// Swapchain /* 0003-I */
-			if (true)
+			if (!bHeadless)
 			{
 				// Query Support Details
 				VkSurfaceCapabilitiesKHR capabilities;
@@ -1384,6 +1574,144 @@ int main()
 			}
 
 
+			// Headless Backbuffers
+			if (bHeadless)
+			{
+				// Same format as the prefered swapchain format.
+				sceneColorFormat = VK_FORMAT_R8G8B8A8_UNORM;
+
+				for (uint32_t i = 0; i < bufferingCount; ++i)
+				{
+					// Image
+					{
+						const VkImageCreateInfo imageCreateInfo{
+							.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+							.pNext = nullptr,
+							.flags = 0,
+							.imageType = VK_IMAGE_TYPE_2D,
+							.format = sceneColorFormat,
+							.extent = VkExtent3D{ windowSize.x, windowSize.y, 1u },
+							.mipLevels = 1,
+							.arrayLayers = 1,
+							.samples = VK_SAMPLE_COUNT_1_BIT,
+							.tiling = VK_IMAGE_TILING_OPTIMAL,
+							.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+							.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+							.queueFamilyIndexCount = 0,
+							.pQueueFamilyIndices = nullptr,
+							.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+						};
+
+						const VkResult vrImageCreated = vkCreateImage(device, &imageCreateInfo, nullptr, &swapchainImages[i]);
+						if (vrImageCreated != VK_SUCCESS)
+						{
+							SA_LOG((L"Create Headless Backbuffer Image [%1] failed!", i), Error, VK, (L"Error Code: %1", vrImageCreated));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG((L"Create Headless Backbuffer Image [%1] success.", i), Info, VK, swapchainImages[i]);
+						}
+					}
+
+
+					// Image Memory
+					{
+						VkMemoryRequirements memRequirements;
+						vkGetImageMemoryRequirements(device, swapchainImages[i], &memRequirements);
+
+						const VkMemoryAllocateInfo allocInfo{
+							.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+							.pNext = nullptr,
+							.allocationSize = memRequirements.size,
+							.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+						};
+
+						const VkResult vrImgAlloc = vkAllocateMemory(device, &allocInfo, nullptr, &headlessImageMemories[i]);
+						if (vrImgAlloc != VK_SUCCESS)
+						{
+							SA_LOG((L"Create Headless Backbuffer Image Memory [%1] failed!", i), Error, VK, (L"Error Code: %1", vrImgAlloc));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG((L"Create Headless Backbuffer Image Memory [%1] success.", i), Info, VK, headlessImageMemories[i]);
+						}
+
+
+						const VkResult vrImgMemBind = vkBindImageMemory(device, swapchainImages[i], headlessImageMemories[i], 0);
+						if (vrImgMemBind != VK_SUCCESS)
+						{
+							SA_LOG((L"Bind Headless Backbuffer Image Memory [%1] failed!", i), Error, VK, (L"Error Code: %1", vrImgMemBind));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG((L"Bind Headless Backbuffer Image Memory [%1] success.", i), Info, VK);
+						}
+					}
+
+
+					// Image View
+					{
+						const VkImageViewCreateInfo viewInfo{
+							.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+							.pNext = nullptr,
+							.flags = 0,
+							.image = swapchainImages[i],
+							.viewType = VK_IMAGE_VIEW_TYPE_2D,
+							.format = sceneColorFormat,
+							.components{
+								.r = VK_COMPONENT_SWIZZLE_IDENTITY,
+								.g = VK_COMPONENT_SWIZZLE_IDENTITY,
+								.b = VK_COMPONENT_SWIZZLE_IDENTITY,
+								.a = VK_COMPONENT_SWIZZLE_IDENTITY
+							},
+							.subresourceRange{
+								.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+								.baseMipLevel = 0,
+								.levelCount = 1,
+								.baseArrayLayer = 0,
+								.layerCount = 1,
+							}
+						};
+
+						const VkResult vrImgViewCreated = vkCreateImageView(device, &viewInfo, nullptr, &swapchainImageViews[i]);
+						if (vrImgViewCreated != VK_SUCCESS)
+						{
+							SA_LOG((L"Create Headless Backbuffer Image View [%1] failed!", i), Error, VK, (L"Error Code: %1", vrImgViewCreated));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG((L"Create Headless Backbuffer Image View [%1] success.", i), Info, VK, swapchainImageViews[i]);
+						}
+					}
+
+
+					// Fence (no acquire nor present semaphores)
+					{
+						const VkFenceCreateInfo fenceCreateInfo{
+							.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+							.pNext = nullptr,
+							.flags = VK_FENCE_CREATE_SIGNALED_BIT,
+						};
+
+						const VkResult vrFenceCreated = vkCreateFence(device, &fenceCreateInfo, nullptr, &swapchainSyncs[i].fence);
+						if (vrFenceCreated != VK_SUCCESS)
+						{
+							SA_LOG((L"Create Headless Fence [%1] failed!", i), Error, VK, (L"Error Code: %1", vrFenceCreated));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG((L"Create Headless Fence [%1] success", i), Info, VK, swapchainSyncs[i].fence);
+						}
+					}
+				}
+			}
+
+
 			// Commands  /* 0004-I */
 			if (true)
 			{
@@ -1562,7 +1890,7 @@ int main()
 						.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
 						.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
 						.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-						.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+						.finalLayout = bHeadless ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
 					},
 					VkAttachmentDescription{
 						.flags = 0,
@@ -1704,9 +2032,9 @@ int main()
 								.stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
 								.pImmutableSamplers = nullptr,
 							},
-							VkDescriptorSetLayoutBinding{ // Object buffer
+							VkDescriptorSetLayoutBinding{ // Object buffer (instance transforms)
 								.binding = 1,
-								.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+								.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
 								.descriptorCount = 1,
 								.stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
 								.pImmutableSamplers = nullptr,
@@ -2069,44 +2397,232 @@ int main()
 						}
 					}
 				}
-			}
-
-
-			const VkCommandBufferBeginInfo beginInfo{
-				.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-				.pNext = nullptr,
-				.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
-				.pInheritanceInfo = nullptr,
-			};
-			vkBeginCommandBuffer(cmdBuffers[0], &beginInfo);
-
-
-			// Resources /* 00010-I */
-			if (true)
-			{
-				Assimp::Importer importer;
 
-				// Meshes
+				// Instance Culling
 				{
-					// Sphere
+					// DescriptorSetLayout
 					{
-						const char* path = "Resources/Models/Shapes/sphere.obj";
-						const aiScene* scene = importer.ReadFile(path, aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded);
-						if (!scene)
+						std::array<VkDescriptorSetLayoutBinding, 3> bindings{
+							VkDescriptorSetLayoutBinding{ // Object buffer
+								.binding = 0,
+								.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+								.descriptorCount = 1,
+								.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+								.pImmutableSamplers = nullptr,
+							},
+							VkDescriptorSetLayoutBinding{ // Draw command buffer
+								.binding = 1,
+								.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+								.descriptorCount = 1,
+								.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+								.pImmutableSamplers = nullptr,
+							},
+							VkDescriptorSetLayoutBinding{ // Draw count buffer
+								.binding = 2,
+								.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+								.descriptorCount = 1,
+								.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+								.pImmutableSamplers = nullptr,
+							},
+						};
+
+						const VkDescriptorSetLayoutCreateInfo layoutInfo{
+							.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+							.pNext = nullptr,
+							.flags = 0u,
+							.bindingCount = static_cast<uint32_t>(bindings.size()),
+							.pBindings = bindings.data(),
+						};
+
+						const VkResult vrDescLayoutCreated = vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &instanceCullingDescSetLayout);
+						if (vrDescLayoutCreated != VK_SUCCESS)
 						{
-							SA_LOG(L"Assimp loading failed!", Error, Assimp, path);
+							SA_LOG(L"Create Instance Culling DescriptorSet Layout failed!", Error, VK, (L"Error Code: %1", vrDescLayoutCreated));
 							return EXIT_FAILURE;
 						}
+						else
+						{
+							SA_LOG(L"Create Instance Culling DescriptorSet Layout success.", Info, VK, instanceCullingDescSetLayout);
+						}
+					}
 
-						const aiMesh* inMesh = scene->mMeshes[0];
 
-						// Position
-						{
+					// Pipeline Layout
+					{
+						const VkPushConstantRange pushConstantRange{
+							.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+							.offset = 0u,
+							.size = sizeof(InstanceCullingConstants),
+						};
+
+						const VkPipelineLayoutCreateInfo pipelineLayoutInfo{
+							.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+							.pNext = nullptr,
+							.flags = 0,
+							.setLayoutCount = 1u,
+							.pSetLayouts = &instanceCullingDescSetLayout,
+							.pushConstantRangeCount = 1u,
+							.pPushConstantRanges = &pushConstantRange,
+						};
+
+						const VkResult vrPipLayoutCreated = vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &instanceCullingPipelineLayout);
+						if (vrPipLayoutCreated != VK_SUCCESS)
+						{
+							SA_LOG(L"Create Instance Culling Pipeline Layout failed!", Error, VK, (L"Error Code: %1", vrPipLayoutCreated));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Instance Culling Pipeline Layout success", Info, VK, instanceCullingPipelineLayout);
+						}
+					}
+
+
+					// Compute Shader
+					{
+						std::vector<uint32_t> shCode;
+
+						CompileShaderFromFile("Resources/Shaders/GLSL/InstanceCulling.comp", shaderc_compute_shader, shCode);
+
+						const VkShaderModuleCreateInfo createInfo{
+							.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+							.pNext = nullptr,
+							.flags = 0u,
+							.codeSize = static_cast<uint32_t>(shCode.size()) * sizeof(uint32_t),
+							.pCode = shCode.data(),
+						};
+
+						const VkResult vrShaderCompile = vkCreateShaderModule(device, &createInfo, nullptr, &instanceCullingComputeShader);
+						if (vrShaderCompile != VK_SUCCESS)
+						{
+							SA_LOG(L"Create Instance Culling Compute Shader failed!", Info, VK, (L"Error code: %1", vrShaderCompile));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Instance Culling Compute Shader success", Info, VK, instanceCullingComputeShader);
+						}
+					}
+
+
+					// Pipeline
+					{
+						const VkComputePipelineCreateInfo pipelineInfo{
+							.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+							.pNext = nullptr,
+							.flags = 0u,
+							.stage = VkPipelineShaderStageCreateInfo{
+								.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+								.pNext = nullptr,
+								.flags = 0u,
+								.stage = VK_SHADER_STAGE_COMPUTE_BIT,
+								.module = instanceCullingComputeShader,
+								.pName = "main",
+								.pSpecializationInfo = nullptr,
+							},
+							.layout = instanceCullingPipelineLayout,
+							.basePipelineHandle = VK_NULL_HANDLE,
+							.basePipelineIndex = -1,
+						};
+
+						const VkResult vrCreatePipeline = vkCreateComputePipelines(device, VK_NULL_HANDLE, 1u, &pipelineInfo, nullptr, &instanceCullingPipeline);
+						if (vrCreatePipeline != VK_SUCCESS)
+						{
+							SA_LOG(L"Create Instance Culling Pipeline failed!", Error, VK, (L"Error Code: %1", vrCreatePipeline));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Instance Culling Pipeline success", Info, VK, instanceCullingPipeline);
+						}
+					}
+				}
+			}
+
+
+			const VkCommandBufferBeginInfo beginInfo{
+				.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+				.pNext = nullptr,
+				.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+				.pInheritanceInfo = nullptr,
+			};
+			vkBeginCommandBuffer(cmdBuffers[0], &beginInfo);
+
+
+			// Resources /* 00010-I */
+			if (true)
+			{
+				Assimp::Importer importer;
+
+				// Meshes
+				{
+					// Sphere
+					{
+						const char* path = "Resources/Models/Shapes/sphere.obj";
+						const aiScene* scene = importer.ReadFile(path, aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded);
+						if (!scene)
+						{
+							SA_LOG(L"Assimp loading failed!", Error, Assimp, path);
+							return EXIT_FAILURE;
+						}
+
+						const aiMesh* inMesh = scene->mMeshes[0];
+
+						// Optimize: vertex cache, vertex fetch and spatial order (same stage as the meshlet cooker).
+						std::vector<MeshletCooker::Vertex> vertices;
+						std::vector<uint32_t> vertexIndices;
+						{
+							vertices.reserve(inMesh->mNumVertices);
+
+							for (uint32_t i = 0; i < inMesh->mNumVertices; ++i)
+							{
+								MeshletCooker::Vertex vertex;
+								vertex.position = SA::Vec3f(inMesh->mVertices[i].x, inMesh->mVertices[i].y, inMesh->mVertices[i].z);
+								vertex.normal = SA::Vec3f(inMesh->mNormals[i].x, inMesh->mNormals[i].y, inMesh->mNormals[i].z);
+								vertex.tangent = SA::Vec3f(inMesh->mTangents[i].x, inMesh->mTangents[i].y, inMesh->mTangents[i].z);
+								vertex.uv = SA::Vec2f(inMesh->mTextureCoords[0][i].x, inMesh->mTextureCoords[0][i].y);
+								vertices.push_back(vertex);
+							}
+
+							vertexIndices.reserve(inMesh->mNumFaces * 3);
+
+							for (unsigned int i = 0; i < inMesh->mNumFaces; ++i)
+							{
+								vertexIndices.push_back(inMesh->mFaces[i].mIndices[0]);
+								vertexIndices.push_back(inMesh->mFaces[i].mIndices[1]);
+								vertexIndices.push_back(inMesh->mFaces[i].mIndices[2]);
+							}
+
+							MeshletCooker::OptimizeMesh(vertices, vertexIndices);
+						}
+
+						// Bounding sphere (instance culling): bounding box center, farthest vertex.
+						{
+							SA::Vec3f boundsMin = vertices[0].position;
+							SA::Vec3f boundsMax = vertices[0].position;
+
+							for (const MeshletCooker::Vertex& vertex : vertices)
+							{
+								boundsMin = SA::Vec3f(std::min(boundsMin.x, vertex.position.x), std::min(boundsMin.y, vertex.position.y), std::min(boundsMin.z, vertex.position.z));
+								boundsMax = SA::Vec3f(std::max(boundsMax.x, vertex.position.x), std::max(boundsMax.y, vertex.position.y), std::max(boundsMax.z, vertex.position.z));
+							}
+
+							const SA::Vec3f center = (boundsMin + boundsMax) * 0.5f;
+							float radius = 0.0f;
+
+							for (const MeshletCooker::Vertex& vertex : vertices)
+								radius = std::max(radius, SA::Vec3f::Dist(center, vertex.position));
+
+							sphereBoundingSphere = SA::Vec4f(center, radius);
+						}
+
+						// Position
+						{
 							const VkBufferCreateInfo bufferInfo{
 								.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
 								.pNext = nullptr,
 								.flags = 0u,
-								.size = sizeof(SA::Vec3f) * inMesh->mNumVertices,
+								.size = sizeof(SA::Vec3f) * vertices.size(),
 								.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
 								.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
 								.queueFamilyIndexCount = 0u,
@@ -2160,8 +2676,17 @@ int main()
 							}
 
 
+							// Pack
+							std::vector<SA::Vec3f> positions;
+							positions.reserve(vertices.size());
+
+							for (const MeshletCooker::Vertex& vertex : vertices)
+							{
+								positions.push_back(vertex.position);
+							}
+
 							// Submit
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[0], bufferInfo.size, inMesh->mVertices);
+							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[0], bufferInfo.size, positions.data());
 							if (!bSubmitSuccess)
 							{
 								SA_LOG(L"Sphere Vertex Position Buffer submit failed!", Error, VK);
@@ -2175,7 +2700,7 @@ int main()
 								.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
 								.pNext = nullptr,
 								.flags = 0u,
-								.size = sizeof(SA::Vec3f) * inMesh->mNumVertices,
+								.size = sizeof(SA::Vec3f) * vertices.size(),
 								.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
 								.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
 								.queueFamilyIndexCount = 0u,
@@ -2229,8 +2754,17 @@ int main()
 							}
 
 
+							// Pack
+							std::vector<SA::Vec3f> normals;
+							normals.reserve(vertices.size());
+
+							for (const MeshletCooker::Vertex& vertex : vertices)
+							{
+								normals.push_back(vertex.normal);
+							}
+
 							// Submit
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[1], bufferInfo.size, inMesh->mNormals);
+							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[1], bufferInfo.size, normals.data());
 							if (!bSubmitSuccess)
 							{
 								SA_LOG(L"Sphere Vertex Normal Buffer submit failed!", Error, VK);
@@ -2244,7 +2778,7 @@ int main()
 								.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
 								.pNext = nullptr,
 								.flags = 0u,
-								.size = sizeof(SA::Vec3f) * inMesh->mNumVertices,
+								.size = sizeof(SA::Vec3f) * vertices.size(),
 								.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
 								.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
 								.queueFamilyIndexCount = 0u,
@@ -2298,8 +2832,17 @@ int main()
 							}
 
 
+							// Pack
+							std::vector<SA::Vec3f> tangents;
+							tangents.reserve(vertices.size());
+
+							for (const MeshletCooker::Vertex& vertex : vertices)
+							{
+								tangents.push_back(vertex.tangent);
+							}
+
 							// Submit
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[2], bufferInfo.size, inMesh->mTangents);
+							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[2], bufferInfo.size, tangents.data());
 							if (!bSubmitSuccess)
 							{
 								SA_LOG(L"Sphere Vertex Tangent Buffer submit failed!", Error, VK);
@@ -2313,7 +2856,7 @@ int main()
 								.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
 								.pNext = nullptr,
 								.flags = 0u,
-								.size = sizeof(SA::Vec2f) * inMesh->mNumVertices,
+								.size = sizeof(SA::Vec2f) * vertices.size(),
 								.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
 								.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
 								.queueFamilyIndexCount = 0u,
@@ -2369,11 +2912,11 @@ int main()
 
 							// Pack
 							std::vector<SA::Vec2f> uvs;
-							uvs.reserve(inMesh->mNumVertices);
+							uvs.reserve(vertices.size());
 
-							for (uint32_t i = 0; i < inMesh->mNumVertices; ++i)
+							for (const MeshletCooker::Vertex& vertex : vertices)
 							{
-								uvs.push_back(SA::Vec2f{ inMesh->mTextureCoords[0][i].x, inMesh->mTextureCoords[0][i].y });
+								uvs.push_back(vertex.uv);
 							}
 
 							// Submit
@@ -2391,7 +2934,7 @@ int main()
 								.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
 								.pNext = nullptr,
 								.flags = 0u,
-								.size = sizeof(uint16_t) * inMesh->mNumFaces * 3,
+								.size = sizeof(uint16_t) * vertexIndices.size(),
 								.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
 								.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
 								.queueFamilyIndexCount = 0u,
@@ -2447,14 +2990,12 @@ int main()
 
 							// Pack indices into uint16_t since max index < 65535.
 							std::vector<uint16_t> indices;
-							indices.resize(inMesh->mNumFaces * 3);
-							sphereIndexCount = inMesh->mNumFaces * 3;
+							indices.reserve(vertexIndices.size());
+							sphereIndexCount = static_cast<uint32_t>(vertexIndices.size());
 
-							for (unsigned int i = 0; i < inMesh->mNumFaces; ++i)
+							for (uint32_t index : vertexIndices)
 							{
-								indices[i * 3] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[0]);
-								indices[i * 3 + 1] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[1]);
-								indices[i * 3 + 2] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[2]);
+								indices.push_back(static_cast<uint16_t>(index));
 							}
 
 
@@ -3189,8 +3730,8 @@ int main()
 						.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
 						.pNext = nullptr,
 						.flags = 0u,
-						.size = sizeof(ObjectUBO),
-						.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+						.size = instanceCount * sizeof(ObjectUBO),
+						.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
 						.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
 						.queueFamilyIndexCount = 0u,
 						.pQueueFamilyIndices = nullptr,
@@ -3243,8 +3784,20 @@ int main()
 					}
 
 					// Submit
-					const SA::CMat4f transform = SA::CMat4f::MakeTranslation(spherePosition);
-					const bool bSubmitSuccess = SubmitBufferToGPU(sphereObjectBuffer, bufferInfo.size, &transform);
+					std::vector<ObjectUBO> objectsUBO;
+					objectsUBO.reserve(instanceCount);
+					for (uint32_t i = 0u; i < numInstanceRowsCount; i++)
+					{
+						for (uint32_t j = 0u; j < numInstanceColsCount; j++)
+						{
+							ObjectUBO instanceUBO;
+							const SA::Vec3f instancePosition = spherePosition + SA::Vec3f(5.f * i, 0.f, 5.f * j);
+							instanceUBO.transform = SA::CMat4f::MakeTranslation(instancePosition);
+							objectsUBO.push_back(instanceUBO);
+						}
+					}
+
+					const bool bSubmitSuccess = SubmitBufferToGPU(sphereObjectBuffer, bufferInfo.size, objectsUBO.data());
 					if (!bSubmitSuccess)
 					{
 						SA_LOG(L"Sphere Object Buffer submit failed!", Error, DX12);
@@ -3335,22 +3888,209 @@ int main()
 				}
 
 
+				// Indirect Draw Buffer
+				{
+					// Written by the instance culling pass: no upload.
+					const VkBufferCreateInfo bufferInfo{
+						.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+						.pNext = nullptr,
+						.flags = 0u,
+						.size = instanceCount * sizeof(VkDrawIndexedIndirectCommand),
+						.usage = VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+						.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+						.queueFamilyIndexCount = 0u,
+						.pQueueFamilyIndices = nullptr,
+					};
+
+					const VkResult vrBufferCreated = vkCreateBuffer(device, &bufferInfo, nullptr, &indirectDrawBuffer);
+					if (vrBufferCreated != VK_SUCCESS)
+					{
+						SA_LOG(L"Create Indirect Draw Buffer failed!", Error, VK, (L"Error code: %1", vrBufferCreated));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						SA_LOG(L"Create Indirect Draw Buffer success", Info, VK, indirectDrawBuffer);
+					}
+
+
+					// Memory
+					VkMemoryRequirements memRequirements;
+					vkGetBufferMemoryRequirements(device, indirectDrawBuffer, &memRequirements);
+
+					const VkMemoryAllocateInfo allocInfo{
+						.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+						.pNext = nullptr,
+						.allocationSize = memRequirements.size,
+						.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+					};
+
+					const VkResult vrBufferAlloc = vkAllocateMemory(device, &allocInfo, nullptr, &indirectDrawBufferMemory);
+					if (vrBufferAlloc != VK_SUCCESS)
+					{
+						SA_LOG(L"Create Indirect Draw Buffer Memory failed!", Error, VK, (L"Error code: %1", vrBufferAlloc));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						SA_LOG(L"Create Indirect Draw Buffer Memory success", Info, VK, indirectDrawBufferMemory);
+					}
+
+
+					const VkResult vrBindBufferMem = vkBindBufferMemory(device, indirectDrawBuffer, indirectDrawBufferMemory, 0);
+					if (vrBindBufferMem != VK_SUCCESS)
+					{
+						SA_LOG(L"Bind Indirect Draw Buffer Memory failed!", Error, VK, (L"Error code: %1", vrBindBufferMem));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						SA_LOG(L"Bind Indirect Draw Buffer Memory success", Info, VK);
+					}
+				}
+
+				// Indirect Count Buffer
+				{
+					// Cleared by vkCmdFillBuffer each frame, copied to indirectCountReadbackBuffers.
+					const VkBufferCreateInfo bufferInfo{
+						.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+						.pNext = nullptr,
+						.flags = 0u,
+						.size = sizeof(uint32_t),
+						.usage = VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+						.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+						.queueFamilyIndexCount = 0u,
+						.pQueueFamilyIndices = nullptr,
+					};
+
+					const VkResult vrBufferCreated = vkCreateBuffer(device, &bufferInfo, nullptr, &indirectCountBuffer);
+					if (vrBufferCreated != VK_SUCCESS)
+					{
+						SA_LOG(L"Create Indirect Count Buffer failed!", Error, VK, (L"Error code: %1", vrBufferCreated));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						SA_LOG(L"Create Indirect Count Buffer success", Info, VK, indirectCountBuffer);
+					}
+
+
+					// Memory
+					VkMemoryRequirements memRequirements;
+					vkGetBufferMemoryRequirements(device, indirectCountBuffer, &memRequirements);
+
+					const VkMemoryAllocateInfo allocInfo{
+						.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+						.pNext = nullptr,
+						.allocationSize = memRequirements.size,
+						.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+					};
+
+					const VkResult vrBufferAlloc = vkAllocateMemory(device, &allocInfo, nullptr, &indirectCountBufferMemory);
+					if (vrBufferAlloc != VK_SUCCESS)
+					{
+						SA_LOG(L"Create Indirect Count Buffer Memory failed!", Error, VK, (L"Error code: %1", vrBufferAlloc));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						SA_LOG(L"Create Indirect Count Buffer Memory success", Info, VK, indirectCountBufferMemory);
+					}
+
+
+					const VkResult vrBindBufferMem = vkBindBufferMemory(device, indirectCountBuffer, indirectCountBufferMemory, 0);
+					if (vrBindBufferMem != VK_SUCCESS)
+					{
+						SA_LOG(L"Bind Indirect Count Buffer Memory failed!", Error, VK, (L"Error code: %1", vrBindBufferMem));
+						return EXIT_FAILURE;
+					}
+					else
+					{
+						SA_LOG(L"Bind Indirect Count Buffer Memory success", Info, VK);
+					}
+				}
+
+				// Indirect Count Readback Buffers
+				{
+					const VkBufferCreateInfo bufferInfo{
+						.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+						.pNext = nullptr,
+						.flags = 0u,
+						.size = sizeof(uint32_t),
+						.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+						.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+						.queueFamilyIndexCount = 0u,
+						.pQueueFamilyIndices = nullptr,
+					};
+
+					for (uint32_t i = 0; i < bufferingCount; ++i)
+					{
+						const VkResult vrBufferCreated = vkCreateBuffer(device, &bufferInfo, nullptr, &indirectCountReadbackBuffers[i]);
+						if (vrBufferCreated != VK_SUCCESS)
+						{
+							SA_LOG((L"Create Indirect Count Readback Buffer [%1] failed!", i), Error, VK, (L"Error code: %1", vrBufferCreated));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG((L"Create Indirect Count Readback Buffer [%1] success", i), Info, VK, indirectCountReadbackBuffers[i]);
+						}
+
+
+						// Memory
+						VkMemoryRequirements memRequirements;
+						vkGetBufferMemoryRequirements(device, indirectCountReadbackBuffers[i], &memRequirements);
+
+						const VkMemoryAllocateInfo allocInfo{
+							.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+							.pNext = nullptr,
+							.allocationSize = memRequirements.size,
+							.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+						};
+
+						const VkResult vrBufferAlloc = vkAllocateMemory(device, &allocInfo, nullptr, &indirectCountReadbackBufferMemories[i]);
+						if (vrBufferAlloc != VK_SUCCESS)
+						{
+							SA_LOG((L"Create Indirect Count Readback Buffer Memory [%1] failed!", i), Error, VK, (L"Error code: %1", vrBufferAlloc));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG((L"Create Indirect Count Readback Buffer Memory [%1] success", i), Info, VK, indirectCountReadbackBufferMemories[i]);
+						}
+
+
+						const VkResult vrBindBufferMem = vkBindBufferMemory(device, indirectCountReadbackBuffers[i], indirectCountReadbackBufferMemories[i], 0);
+						if (vrBindBufferMem != VK_SUCCESS)
+						{
+							SA_LOG((L"Bind Indirect Count Readback Buffer Memory [%1] failed!", i), Error, VK, (L"Error code: %1", vrBindBufferMem));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG((L"Bind Indirect Count Readback Buffer Memory [%1] success", i), Info, VK);
+						}
+					}
+				}
+
+
 				// PBR Sphere Descriptor Sets /* 0011-2-I */
 				{
 					// Desc Pool
 					{
+						// Per set: camera, objects and point lights buffers, 4 PBR textures.
 						std::array<VkDescriptorPoolSize, 3> poolSize{
 							VkDescriptorPoolSize{
 								.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-								.descriptorCount = 2u,
+								.descriptorCount = 1u * bufferingCount,
 							},
 							VkDescriptorPoolSize{
 								.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-								.descriptorCount = 1u,
+								.descriptorCount = 2u * bufferingCount,
 							},
 							VkDescriptorPoolSize{
 								.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-								.descriptorCount = 4u,
+								.descriptorCount = 4u * bufferingCount,
 							},
 						};
 
@@ -3417,7 +4157,7 @@ int main()
 						const VkDescriptorBufferInfo objectBufferInfo{
 							.buffer = sphereObjectBuffer,
 							.offset = 0,
-							.range = sizeof(ObjectUBO),
+							.range = instanceCount * sizeof(ObjectUBO),
 						};
 						writes[1] = VkWriteDescriptorSet{
 							.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
@@ -3426,7 +4166,7 @@ int main()
 							.dstBinding = 1,
 							.dstArrayElement = 0,
 							.descriptorCount = 1,
-							.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+							.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
 							.pImageInfo = nullptr,
 							.pBufferInfo = &objectBufferInfo,
 							.pTexelBufferView = nullptr,
@@ -3536,6 +4276,83 @@ int main()
 							nullptr);
 					}
 				}
+
+
+				// Instance Culling Descriptor Set
+				{
+					// Desc Pool
+					{
+						const VkDescriptorPoolSize poolSize{
+							.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+							.descriptorCount = 3u,
+						};
+
+						const VkDescriptorPoolCreateInfo poolInfo{
+							.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+							.pNext = nullptr,
+							.flags = 0u,
+							.maxSets = 1u,
+							.poolSizeCount = 1u,
+							.pPoolSizes = &poolSize,
+						};
+
+						const VkResult vrDescPooolCreated = vkCreateDescriptorPool(device, &poolInfo, nullptr, &instanceCullingDescPool);
+						if (vrDescPooolCreated != VK_SUCCESS)
+						{
+							SA_LOG(L"Create Instance Culling Descriptor Pool failed!", Error, VK, (L"Error code: %1", vrDescPooolCreated));
+							return EXIT_FAILURE;
+						}
+						else
+						{
+							SA_LOG(L"Create Instance Culling Descriptor Pool success", Info, VK, instanceCullingDescPool);
+						}
+					}
+
+					// Alloc set: the culling pass only reads static and writes shared buffers (ordered by barriers).
+					const VkDescriptorSetAllocateInfo allocInfo{
+						.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+						.pNext = nullptr,
+						.descriptorPool = instanceCullingDescPool,
+						.descriptorSetCount = 1u,
+						.pSetLayouts = &instanceCullingDescSetLayout,
+					};
+
+					vkAllocateDescriptorSets(device, &allocInfo, &instanceCullingDescSet);
+
+					// Write set
+					const std::array<VkDescriptorBufferInfo, 3> bufferInfos{
+						VkDescriptorBufferInfo{
+							.buffer = sphereObjectBuffer,
+							.offset = 0,
+							.range = instanceCount * sizeof(ObjectUBO),
+						},
+						VkDescriptorBufferInfo{
+							.buffer = indirectDrawBuffer,
+							.offset = 0,
+							.range = instanceCount * sizeof(VkDrawIndexedIndirectCommand),
+						},
+						VkDescriptorBufferInfo{
+							.buffer = indirectCountBuffer,
+							.offset = 0,
+							.range = sizeof(uint32_t),
+						},
+					};
+
+					const VkWriteDescriptorSet write{
+						.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+						.pNext = nullptr,
+						.dstSet = instanceCullingDescSet,
+						.dstBinding = 0,
+						.dstArrayElement = 0,
+						.descriptorCount = static_cast<uint32_t>(bufferInfos.size()),
+						.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+						.pImageInfo = nullptr,
+						.pBufferInfo = bufferInfos.data(),
+						.pTexelBufferView = nullptr,
+					};
+
+					vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+				}
 			}
 
 
@@ -3553,13 +4370,17 @@ int main()
 		float dx = 0.0f;
 		float dy = 0.0f;
 
-		glfwGetCursorPos(window, &oldMouseX, &oldMouseY);
+		if (!bHeadless)
+			glfwGetCursorPos(window, &oldMouseX, &oldMouseY);
 
 		const float fixedTime = 0.0025f;
 		float accumulateTime = 0.0f;
 		auto start = std::chrono::steady_clock::now();
 
-		while (!glfwWindowShouldClose(window))
+		// Headless: fixed camera, headlessFrameCount frames.
+		uint32_t frameNumber = 0u;
+
+		while (bHeadless ? frameNumber < headlessFrameCount : !glfwWindowShouldClose(window))
 		{
 			auto end = std::chrono::steady_clock::now();
 			float deltaTime = std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(end - start).count();
@@ -3567,7 +4388,7 @@ int main()
 			start = end;
 
 			// Fixed Update
-			if (accumulateTime >= fixedTime)
+			if (!bHeadless && accumulateTime >= fixedTime)
 			{
 				accumulateTime -= fixedTime;
 
@@ -3626,16 +4447,38 @@ int main()
 					// Reset current Fence.
 					vkResetFences(device, 1, &swapchainSyncs[swapchainFrameIndex].fence);
 
-					const VkResult vrAcqImage = vkAcquireNextImageKHR(device, swapchain, UINT64_MAX, swapchainSyncs[swapchainFrameIndex].acquireSemaphore, VK_NULL_HANDLE, &swapchainImageIndex);
-					if (vrAcqImage != VK_SUCCESS)
+					// Headless: visible instance count of the frame recorded in this slot (bufferingCount frames ago).
+					if (bHeadless && frameNumber >= bufferingCount)
 					{
-						SA_LOG(L"Swapchain Acquire Next Image failed!", Error, VK, (L"Error code: %1", vrAcqImage));
-						return EXIT_FAILURE;
+						void* data = nullptr;
+						vkMapMemory(device, indirectCountReadbackBufferMemories[swapchainFrameIndex], 0u, sizeof(uint32_t), 0u, &data);
+
+						const uint32_t visibleInstanceCount = *static_cast<const uint32_t*>(data);
+
+						vkUnmapMemory(device, indirectCountReadbackBufferMemories[swapchainFrameIndex]);
+
+						SA_LOG((L"Frame [%1]: %2/%3 visible instances.", frameNumber - bufferingCount, visibleInstanceCount, instanceCount), Info, VK);
+					}
+
+					if (bHeadless)
+					{
+						// Offscreen backbuffers: no acquire.
+						swapchainImageIndex = swapchainFrameIndex;
+					}
+					else
+					{
+						const VkResult vrAcqImage = vkAcquireNextImageKHR(device, swapchain, UINT64_MAX, swapchainSyncs[swapchainFrameIndex].acquireSemaphore, VK_NULL_HANDLE, &swapchainImageIndex);
+						if (vrAcqImage != VK_SUCCESS)
+						{
+							SA_LOG(L"Swapchain Acquire Next Image failed!", Error, VK, (L"Error code: %1", vrAcqImage));
+							return EXIT_FAILURE;
+						}
 					}
 				}
 
 
 				// Update camera.
+				InstanceCullingConstants cullingConstants;
 				{
 
 					// Fill Data with updated values.
@@ -3644,6 +4487,11 @@ int main()
 					const SA::CMat4f perspective = SA::CMat4f::MakePerspective(cameraFOV, float(windowSize.x) / float(windowSize.y), cameraNear, cameraFar);
 					cameraUBO.invViewProj = perspective * cameraUBO.view.GetInversed();
 
+					GetFrustumPlanes(cameraUBO.invViewProj.GetInversed(), cullingConstants.frustumPlanes);
+					cullingConstants.meshBoundingSphere = sphereBoundingSphere;
+					cullingConstants.instanceCount = instanceCount;
+					cullingConstants.indexCount = sphereIndexCount;
+
 					// Memory mapping and Upload (CPU to GPU transfer).
 					void* data = nullptr;
 					vkMapMemory(device, cameraBufferMemories[swapchainFrameIndex], 0u, sizeof(CameraUBO), 0u, &data);
@@ -3668,6 +4516,78 @@ int main()
 					vkBeginCommandBuffer(cmd, &beginInfo);
 
 
+					// Instance Culling
+					{
+						// Previous frames: draw commands and count read before they are cleared and written again.
+						const VkMemoryBarrier reuseBarrier{
+							.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+							.pNext = nullptr,
+							.srcAccessMask = 0u,
+							.dstAccessMask = 0u,
+						};
+						vkCmdPipelineBarrier(cmd,
+							VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+							VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+							0u, 1u, &reuseBarrier, 0u, nullptr, 0u, nullptr);
+
+						vkCmdFillBuffer(cmd, indirectCountBuffer, 0u, sizeof(uint32_t), 0u);
+
+						const VkMemoryBarrier clearBarrier{
+							.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+							.pNext = nullptr,
+							.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+							.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+						};
+						vkCmdPipelineBarrier(cmd,
+							VK_PIPELINE_STAGE_TRANSFER_BIT,
+							VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+							0u, 1u, &clearBarrier, 0u, nullptr, 0u, nullptr);
+
+						vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, instanceCullingPipeline);
+						vkCmdBindDescriptorSets(cmd,
+							VK_PIPELINE_BIND_POINT_COMPUTE,
+							instanceCullingPipelineLayout, 0, 1,
+							&instanceCullingDescSet,
+							0, nullptr);
+						vkCmdPushConstants(cmd, instanceCullingPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0u, sizeof(InstanceCullingConstants), &cullingConstants);
+
+						vkCmdDispatch(cmd, (instanceCount + instanceCullingGroupSize - 1u) / instanceCullingGroupSize, 1u, 1u);
+
+						const VkMemoryBarrier cullingBarrier{
+							.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+							.pNext = nullptr,
+							.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+							.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT,
+						};
+						vkCmdPipelineBarrier(cmd,
+							VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+							VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+							0u, 1u, &cullingBarrier, 0u, nullptr, 0u, nullptr);
+
+						// Visible instance count readback (headless log).
+						if (bHeadless)
+						{
+							const VkBufferCopy copyRegion{
+								.srcOffset = 0u,
+								.dstOffset = 0u,
+								.size = sizeof(uint32_t),
+							};
+							vkCmdCopyBuffer(cmd, indirectCountBuffer, indirectCountReadbackBuffers[swapchainFrameIndex], 1, &copyRegion);
+
+							const VkMemoryBarrier readbackBarrier{
+								.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+								.pNext = nullptr,
+								.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+								.dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+							};
+							vkCmdPipelineBarrier(cmd,
+								VK_PIPELINE_STAGE_TRANSFER_BIT,
+								VK_PIPELINE_STAGE_HOST_BIT,
+								0u, 1u, &readbackBarrier, 0u, nullptr, 0u, nullptr);
+						}
+					}
+
+
 					// RenderPass Begin /* 0006-U1 */
 					std::array<VkClearValue, 2> clears{
 						sceneClearColor,
@@ -3713,7 +4633,12 @@ int main()
 						&pbrSphereDescSets[swapchainFrameIndex],
 						0, nullptr);
 
-					vkCmdDrawIndexed(cmd, sphereIndexCount, 1, 0, 0, 0);
+					// One command per visible instance (firstInstance: instance index), count written by the culling pass.
+					vkCmdDrawIndexedIndirectCount(cmd,
+						indirectDrawBuffer, 0u,
+						indirectCountBuffer, 0u,
+						instanceCount,
+						sizeof(VkDrawIndexedIndirectCommand));
 
 
 					// End Renderpass /* 0006-U2 */
@@ -3730,15 +4655,16 @@ int main()
 					{
 						const VkPipelineStageFlags waitStages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 
+						// Headless: no acquire nor present to synchronize.
 						const VkSubmitInfo submitInfo{
 							.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
 							.pNext = nullptr,
-							.waitSemaphoreCount = 1u,
+							.waitSemaphoreCount = bHeadless ? 0u : 1u,
 							.pWaitSemaphores = &swapchainSyncs[swapchainFrameIndex].acquireSemaphore,
 							.pWaitDstStageMask = &waitStages,
 							.commandBufferCount = 1,
 							.pCommandBuffers = &cmd,
-							.signalSemaphoreCount = 1u,
+							.signalSemaphoreCount = bHeadless ? 0u : 1u,
 							.pSignalSemaphores = &swapchainSyncs[swapchainFrameIndex].presentSemaphore,
 						};
 
@@ -3752,6 +4678,7 @@ int main()
 
 
 					// Submit present.
+					if (!bHeadless)
 					{
 						const VkPresentInfoKHR presentInfo{
 							.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
@@ -3774,6 +4701,7 @@ int main()
 
 					// Increment next frame.
 					swapchainFrameIndex = (swapchainFrameIndex + 1) % bufferingCount;
+					++frameNumber;
 				}
 			}
 		}
@@ -3915,6 +4843,31 @@ int main()
 				SA_LOG(L"Destroy Sphere Object Buffer Memory success.", Info, VK, sphereObjectBufferMemory);
 				sphereObjectBufferMemory = VK_NULL_HANDLE;
 
+				// Indirect Draw
+				vkDestroyBuffer(device, indirectDrawBuffer, nullptr);
+				SA_LOG(L"Destroy Indirect Draw Buffer success.", Info, VK, indirectDrawBuffer);
+				indirectDrawBuffer = VK_NULL_HANDLE;
+				vkFreeMemory(device, indirectDrawBufferMemory, nullptr);
+				SA_LOG(L"Destroy Indirect Draw Buffer Memory success.", Info, VK, indirectDrawBufferMemory);
+				indirectDrawBufferMemory = VK_NULL_HANDLE;
+
+				vkDestroyBuffer(device, indirectCountBuffer, nullptr);
+				SA_LOG(L"Destroy Indirect Count Buffer success.", Info, VK, indirectCountBuffer);
+				indirectCountBuffer = VK_NULL_HANDLE;
+				vkFreeMemory(device, indirectCountBufferMemory, nullptr);
+				SA_LOG(L"Destroy Indirect Count Buffer Memory success.", Info, VK, indirectCountBufferMemory);
+				indirectCountBufferMemory = VK_NULL_HANDLE;
+
+				for (uint32_t i = 0; i < bufferingCount; ++i)
+				{
+					vkDestroyBuffer(device, indirectCountReadbackBuffers[i], nullptr);
+					SA_LOG((L"Destroy Indirect Count Readback Buffer [%1] success.", i), Info, VK, indirectCountReadbackBuffers[i]);
+					indirectCountReadbackBuffers[i] = VK_NULL_HANDLE;
+					vkFreeMemory(device, indirectCountReadbackBufferMemories[i], nullptr);
+					SA_LOG((L"Destroy Indirect Count Readback Buffer Memory [%1] success.", i), Info, VK, indirectCountReadbackBufferMemories[i]);
+					indirectCountReadbackBufferMemories[i] = VK_NULL_HANDLE;
+				}
+
 				// Camera
 				for (uint32_t i = 0; i < bufferingCount; ++i)
 				{
@@ -3939,6 +4892,14 @@ int main()
 						SA_LOG(L"Destroy PBR Sphere Descriptor Sets Pool success.", Info, VK, pbrSphereDescPool);
 						pbrSphereDescPool = VK_NULL_HANDLE;
 					}
+
+					// Instance Culling Descriptor Set
+					{
+						vkDestroyDescriptorPool(device, instanceCullingDescPool, nullptr);
+						SA_LOG(L"Destroy Instance Culling Descriptor Set Pool success.", Info, VK, instanceCullingDescPool);
+						instanceCullingDescPool = VK_NULL_HANDLE;
+						instanceCullingDescSet = VK_NULL_HANDLE;
+					}
 				}
 			}
 
@@ -3975,6 +4936,21 @@ int main()
 						litPipelineLayout = VK_NULL_HANDLE;
 					}
 				}
+
+				// Instance Culling
+				{
+					vkDestroyPipeline(device, instanceCullingPipeline, nullptr);
+					SA_LOG(L"Destroy Instance Culling Pipeline success.", Info, VK, instanceCullingPipeline);
+					instanceCullingPipeline = VK_NULL_HANDLE;
+
+					vkDestroyShaderModule(device, instanceCullingComputeShader, nullptr);
+					SA_LOG(L"Destroy Instance Culling Compute Shader success.", Info, VK, instanceCullingComputeShader);
+					instanceCullingComputeShader = VK_NULL_HANDLE;
+
+					vkDestroyPipelineLayout(device, instanceCullingPipelineLayout, nullptr);
+					SA_LOG(L"Destroy Instance Culling PipelineLayout success.", Info, VK, instanceCullingPipelineLayout);
+					instanceCullingPipelineLayout = VK_NULL_HANDLE;
+				}
 			}
 
 
@@ -3986,6 +4962,13 @@ int main()
 					SA_LOG(L"Destroy Lit DescriptorSetLayout success.", Info, VK, litDescSetLayout);
 					litDescSetLayout = VK_NULL_HANDLE;
 				}
+
+				// Instance Culling
+				{
+					vkDestroyDescriptorSetLayout(device, instanceCullingDescSetLayout, nullptr);
+					SA_LOG(L"Destroy Instance Culling DescriptorSetLayout success.", Info, VK, instanceCullingDescSetLayout);
+					instanceCullingDescSetLayout = VK_NULL_HANDLE;
+				}
 			}
 
 
@@ -4084,6 +5067,7 @@ int main()
 
 
 				// ImageViews
+				if (!bHeadless)
 				{
 					for (uint32_t i = 0; i < bufferingCount; ++i)
 					{
@@ -4098,14 +5082,30 @@ int main()
 				for (uint32_t i = 0; i < bufferingCount; ++i)
 				{
 					// Do not destroy swapchain images manually, they are already attached to VkSwapchain lifetime.
+					// Headless: offscreen images owned by the application.
+					if (bHeadless)
+					{
+						vkDestroyImageView(device, swapchainImageViews[i], nullptr);
+						SA_LOG((L"Destroy Headless Backbuffer Image View [%1] success", i), Info, VK, swapchainImageViews[i]);
+						swapchainImageViews[i] = VK_NULL_HANDLE;
+
+						vkDestroyImage(device, swapchainImages[i], nullptr);
+						vkFreeMemory(device, headlessImageMemories[i], nullptr);
+						SA_LOG((L"Destroy Headless Backbuffer Image Memory [%1] success", i), Info, VK, headlessImageMemories[i]);
+						headlessImageMemories[i] = VK_NULL_HANDLE;
+					}
 
 					SA_LOG((L"Destroy Swapchain backbuffer image [%1] success", i), Info, VK, swapchainImages[i]);
 					swapchainImages[i] = VK_NULL_HANDLE;
 				}
 
-				vkDestroySwapchainKHR(device, swapchain, nullptr);
-				SA_LOG(L"Destroy Swapchain success", Info, VK, swapchain);
-				swapchain = VK_NULL_HANDLE;
+				// Headless: VK_KHR_swapchain is not enabled, its entry points must not be called.
+				if (!bHeadless)
+				{
+					vkDestroySwapchainKHR(device, swapchain, nullptr);
+					SA_LOG(L"Destroy Swapchain success", Info, VK, swapchain);
+					swapchain = VK_NULL_HANDLE;
+				}
 			}
 
 
@@ -4130,6 +5130,8 @@ int main()
 
 
 			// Surface /* 0003-0-D */
+			// Headless: VK_KHR_surface is not enabled (no GLFW instance extensions).
+			if (!bHeadless)
 			{
 				vkDestroySurfaceKHR(instance, windowSurface, nullptr);
 				SA_LOG(L"Destroy Window Surface success", Info, VK, windowSurface);
@@ -4161,6 +5163,7 @@ int main()
 
 
 		// GLFW
+		if (!bHeadless)
 		{
 			glfwDestroyWindow(window);
 			glfwTerminate();